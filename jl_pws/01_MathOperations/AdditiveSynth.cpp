@@ -10,12 +10,12 @@
 
 //#include "AdditiveSynth.h"
 
-// EN: Sets the frequency of the first oscillator and calculates its phase increment.
-// ES: Establece la frecuencia del primer oscilador y calcula su incremento de fase.
+// EN: Sets the frequency of the first oscillator (partial 0).
+// ES: Establece la frecuencia del primer oscilador (parcial 0).
 void AdditiveSynth::setFrequency1(float inFreqOsc1)
 {
     osc1 = inFreqOsc1;
-    phaseIncrement1 = twoPi * osc1 / sampleRate;
+    setPartial(0, osc1, amp1);
 }
 
 // EN: Sets the amplitude of the first oscillator.
@@ -23,14 +23,15 @@ void AdditiveSynth::setFrequency1(float inFreqOsc1)
 void AdditiveSynth::setAmplitud1(float inAmp1)
 {
     amp1 = inAmp1;
+    setPartial(0, osc1, amp1);
 }
 
-// EN: Sets the frequency of the second oscillator and calculates its phase increment.
-// ES: Establece la frecuencia del segundo oscilador y calcula su incremento de fase.
+// EN: Sets the frequency of the second oscillator (partial 1).
+// ES: Establece la frecuencia del segundo oscilador (parcial 1).
 void AdditiveSynth::setFrequency2(float inFreqOsc2)
 {
     osc2 = inFreqOsc2;
-    phaseIncrement2 = twoPi * osc2 / sampleRate;
+    setPartial(1, osc2, amp2);
 }
 
 // EN: Sets the amplitude of the second oscillator.
@@ -38,46 +39,47 @@ void AdditiveSynth::setFrequency2(float inFreqOsc2)
 void AdditiveSynth::setAmplitud2(float inAmp2)
 {
     amp2 = inAmp2;
+    setPartial(1, osc2, amp2);
 }
 
-// EN: Prepares the synthesizer by initializing the sample rate.
-// ES: Prepara el sintetizador inicializando la frecuencia de muestreo.
-void AdditiveSynth::prepare(double theSampleRate)
+// EN: Sets the number of partials rendered.
+// ES: Establece el número de parciales generados.
+void AdditiveSynth::setNumPartials(int inNumPartials)
 {
-    sampleRate = theSampleRate;
+    numPartials = juce::jlimit(2, maxPartials, inNumPartials);
+
+    partials.setNumPartials(numPartials);
 }
 
-// EN: Processes the audio buffer, generating sound using the two oscillators.
-// ES: Procesa el buffer de audio, generando sonido con los dos osciladores.
-void AdditiveSynth::process(juce::AudioBuffer<float>& buffer)
+// EN: Sets a partial on the bank.
+// ES: Establece un parcial en el banco.
+void AdditiveSynth::setPartial(int index, float inFrequency, float inAmplitude)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
-    {
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            // EN: Calculate the output sample by summing the sine waves of both oscillators.
-            // ES: Calculamos la muestra de salida sumando las ondas seno de ambos osciladores.
-            float outSample = amp1 * sinf(phase1[channel]) + amp2 * sinf(phase2[channel]);
-
-            // EN: Store the calculated sample in the audio buffer.
-            // ES: Guardamos la muestra calculada en el buffer de audio.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Increment the phase of the first oscillator, wrapping it within [0, 2π].
-            // ES: Incrementamos la fase del primer oscilador y la mantenemos en el rango [0, 2π].
-            phase1[channel] += phaseIncrement1;
+    partials.setPartial(index, inFrequency, inAmplitude);
+}
 
-            if (phase1[channel] >= twoPi)
-                phase1[channel] -= twoPi;
+// EN: Prepares the synthesizer by initializing the sample rate and the partials of the two oscillators.
+// ES: Prepara el sintetizador inicializando la frecuencia de muestreo y los parciales de los dos osciladores.
+void AdditiveSynth::prepare(double theSampleRate)
+{
+    sampleRate = theSampleRate;
 
-            // EN: Increment the phase of the second oscillator, wrapping it within [0, 2π].
-            // ES: Incrementamos la fase del segundo oscilador y la mantenemos en el rango [0, 2π].
-            phase2[channel] += phaseIncrement2;
+    partials.prepare(sampleRate, maxPartials);
+    partials.setNumPartials(numPartials);
+    partials.setPartial(0, osc1, amp1);
+    partials.setPartial(1, osc2, amp2);
+    partials.reset();
+}
 
-            if (phase2[channel] >= twoPi)
-                phase2[channel] -= twoPi;
-        }
-    }
+// EN: Processes the audio buffer, generating the sum of the partials (the two oscillators by default).
+// ES: Procesa el buffer de audio, generando la suma de los parciales (los dos osciladores por defecto).
+void AdditiveSynth::process(juce::AudioBuffer<float>& buffer)
+{
+    // EN: The bank rotates one phasor per partial instead of calling sinf, and ramps amplitude changes over the block.
+    //     The channels are identical, so the sum is rendered once into the first channel and copied to the others.
+    // ES: El banco rota un fasor por parcial en vez de llamar a sinf, y hace rampas de los cambios de amplitud durante el bloque.
+    //     Los canales son idénticos, así la suma se genera una vez en el primer canal y se copia a los demás.
+    partials.process(buffer);
 }
 
 // EN: Constructor for the AdditiveSynth class.
@@ -11,8 +11,8 @@
 #pragma once
 //#include <JuceHeader.h>
 
-// EN: Class AdditiveSynth: Implements a simple additive synthesizer with two oscillators.
-// ES: Clase AdditiveSynth: Implementa un sintetizador aditivo simple con dos osciladores.
+// EN: Class AdditiveSynth: Implements a simple additive synthesizer with two oscillators, extendable to maxPartials sine partials.
+// ES: Clase AdditiveSynth: Implementa un sintetizador aditivo simple con dos osciladores, ampliable a maxPartials parciales seno.
 
 class AdditiveSynth
 {
@@ -34,6 +34,14 @@ public:
     // ES: Establece la amplitud del segundo oscilador.
     void setAmplitud2(float inAmp1);
 
+    // EN: Sets the number of partials (2 to maxPartials). Partials 0 and 1 are the two oscillators.
+    // ES: Establece el número de parciales (2 a maxPartials). Los parciales 0 y 1 son los dos osciladores.
+    void setNumPartials(int inNumPartials);
+
+    // EN: Sets the frequency and amplitude of a partial, for additive synthesis beyond the two oscillators.
+    // ES: Establece la frecuencia y la amplitud de un parcial, para síntesis aditiva más allá de los dos osciladores.
+    void setPartial(int index, float inFrequency, float inAmplitude);
+
     // EN: Prepares the synthesizer with the given sample rate.
     // ES: Prepara el sintetizador con la frecuencia de muestreo dada.
     void prepare(double theSampleRate);
@@ -50,6 +58,10 @@ public:
     // ES: Destructor de la clase AdditiveSynth.
     ~AdditiveSynth();
 
+    // EN: Maximum number of partials.
+    // ES: Número máximo de parciales.
+    static constexpr int maxPartials = 512;
+
 private:
     // EN: Frequency of the first oscillator.
     // ES: Frecuencia del primer oscilador.
@@ -71,23 +83,11 @@ private:
     // ES: Frecuencia de muestreo para el procesamiento de audio.
     double sampleRate{};
 
-    // EN: Constant for 2pi, used in phase calculations.
-    // ES: Constante para 2pi, utilizada en c�lculos de fase.
-    float twoPi{ juce::MathConstants<float>::twoPi };
-
-    // EN: Phase increment for the first oscillator.
-    // ES: Incremento de fase para el primer oscilador.
-    float phaseIncrement1{};
-
-    // EN: Phase increment for the second oscillator.
-    // ES: Incremento de fase para el segundo oscilador.
-    float phaseIncrement2{};
-
-    // EN: Phase accumulator for the first oscillator, one per channel (stereo).
-    // ES: Acumulador de fase para el primer oscilador, uno por canal (est�reo).
-    float phase1[2]{};
+    // EN: Number of partials (at least the two oscillators).
+    // ES: Número de parciales (como mínimo los dos osciladores).
+    int numPartials{ 2 };
 
-    // EN: Phase accumulator for the second oscillator, one per channel (stereo).
-    // ES: Acumulador de fase para el segundo oscilador, uno por canal (est�reo).
-    float phase2[2]{};
+    // EN: Sine oscillator bank shared by the channels. Partials 0 and 1 are the two oscillators.
+    // ES: Banco de osciladores seno compartido por los canales. Los parciales 0 y 1 son los dos osciladores.
+    SineOscillatorBank partials;
 };
\ No newline at end of file
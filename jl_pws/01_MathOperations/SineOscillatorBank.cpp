@@ -0,0 +1,209 @@
+/*
+  ==============================================================================
+
+    SineOscillatorBank.cpp
+    Created: 19 Oct 2026 3:22:54am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "SineOscillatorBank.h"
+
+// EN: Constructor of SineOscillatorBank class.
+// ES: Constructor de la clase SineOscillatorBank.
+SineOscillatorBank::SineOscillatorBank()
+{
+}
+
+// EN: Destructor of SineOscillatorBank class.
+// ES: Destructor de la clase SineOscillatorBank.
+SineOscillatorBank::~SineOscillatorBank()
+{
+}
+
+// EN: The vectors are padded to a whole number of groups. New partials start at phase 0 with zero gain.
+// ES: Los vectores se completan a un número entero de grupos. Los parciales nuevos empiezan en fase 0 con ganancia cero.
+void SineOscillatorBank::prepare(double inSampleRate, int inMaxPartials)
+{
+    sampleRate = inSampleRate;
+    maxPartials = juce::jmax(0, inMaxPartials);
+
+    const size_t paddedSize = static_cast<size_t>((maxPartials + numLanes - 1) / numLanes * numLanes);
+
+    frequency.resize(paddedSize, 0.0f);
+    real.resize(paddedSize, 1.0f);
+    imag.resize(paddedSize, 0.0f);
+    rotationCos.resize(paddedSize, 1.0f);
+    rotationSin.resize(paddedSize, 0.0f);
+    gain.resize(paddedSize, 0.0f);
+    targetGain.resize(paddedSize, 0.0f);
+    gainStep.resize(paddedSize, 0.0f);
+    audible.resize(paddedSize, 0.0f);
+
+    for (int i = 0; i < static_cast<int>(paddedSize); i++)
+        updateRotation(i);
+
+    numPartials = juce::jmin(numPartials, maxPartials);
+}
+
+// EN: Partials past the new count are silenced, so they fade in from zero if they are enabled again.
+// ES: Los parciales más allá del nuevo número se silencian, así entran desde cero si se vuelven a activar.
+void SineOscillatorBank::setNumPartials(int inNumPartials)
+{
+    const int newNumPartials = juce::jlimit(0, maxPartials, inNumPartials);
+
+    for (int i = newNumPartials; i < numPartials; i++)
+        gain[static_cast<size_t>(i)] = 0.0f;
+
+    numPartials = newNumPartials;
+}
+
+// EN: Sets the frequency and the gain of a partial.
+// ES: Establece la frecuencia y la ganancia de un parcial.
+void SineOscillatorBank::setPartial(int index, float inFrequency, float inGain)
+{
+    setPartialFrequency(index, inFrequency);
+    setPartialGain(index, inGain);
+}
+
+// EN: Only the rotation changes, so the phasor keeps its phase.
+// ES: Solo cambia la rotación, así el fasor conserva su fase.
+void SineOscillatorBank::setPartialFrequency(int index, float inFrequency)
+{
+    if (index < 0 || index >= maxPartials)
+        return;
+
+    frequency[static_cast<size_t>(index)] = inFrequency;
+    updateRotation(index);
+}
+
+// EN: Sets the target gain of a partial.
+// ES: Establece la ganancia objetivo de un parcial.
+void SineOscillatorBank::setPartialGain(int index, float inGain)
+{
+    if (index < 0 || index >= maxPartials)
+        return;
+
+    targetGain[static_cast<size_t>(index)] = inGain;
+}
+
+// EN: The output is the imaginary part, so phase 0 starts every sine at zero.
+// ES: La salida es la parte imaginaria, así la fase 0 empieza cada seno en cero.
+void SineOscillatorBank::reset(float inPhase)
+{
+    std::fill(real.begin(), real.end(), std::cos(inPhase));
+    std::fill(imag.begin(), imag.end(), std::sin(inPhase));
+
+    for (size_t i = 0; i < gain.size(); i++)
+        gain[i] = static_cast<int>(i) < numPartials ? targetGain[i] * audible[i] : 0.0f;
+}
+
+// EN: The rotation is computed in double and rounded once, so the frequency error stays far below a cent.
+// ES: La rotación se calcula en double y se redondea una vez, así el error de frecuencia queda muy por debajo de un cent.
+void SineOscillatorBank::updateRotation(int index)
+{
+    const size_t i = static_cast<size_t>(index);
+    const double omega = juce::MathConstants<double>::twoPi * frequency[i] / sampleRate;
+
+    rotationCos[i] = static_cast<float>(std::cos(omega));
+    rotationSin[i] = static_cast<float>(std::sin(omega));
+    audible[i] = std::abs(frequency[i]) < 0.5 * sampleRate ? 1.0f : 0.0f;
+}
+
+// EN: 1. Sets the gain ramps of the block.
+//     2. Renders every group in spans of renormalizeInterval samples.
+//     3. Ends the ramps exactly on their targets.
+// ES: 1. Establece las rampas de ganancia del bloque.
+//     2. Genera cada grupo en tramos de renormalizeInterval muestras.
+//     3. Termina las rampas exactamente en sus objetivos.
+void SineOscillatorBank::render(float* output, int numSamples)
+{
+    juce::FloatVectorOperations::clear(output, numSamples);
+
+    if (numPartials == 0 || numSamples <= 0)
+        return;
+
+    const int numGroupPartials = (numPartials + numLanes - 1) / numLanes * numLanes;
+    const float rampScale = 1.0f / static_cast<float>(numSamples);
+
+    for (int i = 0; i < numGroupPartials; i++)
+    {
+        const float target = i < numPartials ? targetGain[static_cast<size_t>(i)] * audible[static_cast<size_t>(i)] : 0.0f;
+        gainStep[static_cast<size_t>(i)] = (target - gain[static_cast<size_t>(i)]) * rampScale;
+    }
+
+    for (int start = 0; start < numSamples; start += renormalizeInterval)
+    {
+        const int spanSize = juce::jmin(renormalizeInterval, numSamples - start);
+
+        for (int firstPartial = 0; firstPartial < numGroupPartials; firstPartial += numLanes)
+            renderGroup(output + start, spanSize, firstPartial);
+    }
+
+    for (int i = 0; i < numGroupPartials; i++)
+        gain[static_cast<size_t>(i)] = i < numPartials ? targetGain[static_cast<size_t>(i)] * audible[static_cast<size_t>(i)] : 0.0f;
+}
+
+// EN: The group is copied into local arrays, rotated for the whole span, and written back after the Newton step.
+// ES: El grupo se copia a arrays locales, se rota durante todo el tramo y se escribe de vuelta tras el paso de Newton.
+void SineOscillatorBank::renderGroup(float* output, int numSamples, int firstPartial)
+{
+    float re[numLanes], im[numLanes], c[numLanes], s[numLanes], g[numLanes], step[numLanes];
+
+    for (int l = 0; l < numLanes; l++)
+    {
+        const size_t k = static_cast<size_t>(firstPartial + l);
+        re[l] = real[k];
+        im[l] = imag[k];
+        c[l] = rotationCos[k];
+        s[l] = rotationSin[k];
+        g[l] = gain[k];
+        step[l] = gainStep[k];
+    }
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        float lanes[numLanes];
+
+        for (int l = 0; l < numLanes; l++)
+        {
+            lanes[l] = g[l] * im[l];
+
+            const float rotatedRe = re[l] * c[l] - im[l] * s[l];
+            im[l] = re[l] * s[l] + im[l] * c[l];
+            re[l] = rotatedRe;
+            g[l] += step[l];
+        }
+
+        float sum = 0.0f;
+        for (int l = 0; l < numLanes; l++)
+            sum += lanes[l];
+
+        output[i] += sum;
+    }
+
+    for (int l = 0; l < numLanes; l++)
+    {
+        const size_t k = static_cast<size_t>(firstPartial + l);
+        const float correction = 1.5f - 0.5f * (re[l] * re[l] + im[l] * im[l]);
+
+        real[k] = re[l] * correction;
+        imag[k] = im[l] * correction;
+        gain[k] = g[l];
+    }
+}
+
+// EN: Renders channel 0 and copies it to the other channels.
+// ES: Genera el canal 0 y lo copia a los demás canales.
+void SineOscillatorBank::process(juce::AudioBuffer<float>& buffer)
+{
+    if (buffer.getNumChannels() == 0)
+        return;
+
+    const int numSamples = buffer.getNumSamples();
+    render(buffer.getWritePointer(0), numSamples);
+
+    for (int channel = 1; channel < buffer.getNumChannels(); channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+}
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    SineOscillatorBank.h
+    Created: 19 Oct 2026 3:22:54am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: SineOscillatorBank renders hundreds of independent sine partials for additive synthesis without calling sinf.
+//     Each partial is a unit phasor (re, im) rotated every sample by its frequency:
+//         re' = re cos(w) - im sin(w),  im' = re sin(w) + im cos(w),  output += gain * im
+//     which costs four multiplies and two adds per partial.
+//     - The partials are stored lane by lane and processed in groups of numLanes. The state of a group stays in
+//       local arrays for a span of up to renormalizeInterval samples and every sample updates the whole group in
+//       one loop the compiler can vectorize, so the cost grows linearly with the number of partials.
+//     - Rounding makes the phasor length drift, so every renormalizeInterval samples it is pulled back to 1 with
+//       one Newton step, g = (3 - |z|^2) / 2.
+//     - Gains are ramped linearly over each block. Partials at or above Nyquist are muted.
+// ES: SineOscillatorBank genera cientos de parciales seno independientes para síntesis aditiva sin llamar a sinf.
+//     Cada parcial es un fasor unitario (re, im) que se rota en cada muestra según su frecuencia:
+//         re' = re cos(w) - im sin(w),  im' = re sin(w) + im cos(w),  salida += ganancia * im
+//     lo que cuesta cuatro multiplicaciones y dos sumas por parcial.
+//     - Los parciales se guardan carril por carril y se procesan en grupos de numLanes. El estado de un grupo se
+//       mantiene en arrays locales durante un tramo de hasta renormalizeInterval muestras y cada muestra actualiza
+//       el grupo completo en un bucle que el compilador puede vectorizar, así el coste crece linealmente con el
+//       número de parciales.
+//     - El redondeo hace que la longitud del fasor se desvíe, así cada renormalizeInterval muestras se devuelve a
+//       1 con un paso de Newton, g = (3 - |z|^2) / 2.
+//     - Las ganancias se hacen en rampa lineal durante cada bloque. Los parciales en o por encima de Nyquist se silencian.
+class SineOscillatorBank
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    SineOscillatorBank();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~SineOscillatorBank();
+
+    // EN: Sets the sample rate and allocates inMaxPartials partials, keeping the frequencies and gains already set.
+    // ES: Establece la frecuencia de muestreo y reserva inMaxPartials parciales, conservando las frecuencias y ganancias ya establecidas.
+    void prepare(double inSampleRate, int inMaxPartials);
+
+    // EN: Sets the number of partials rendered (0 to the maximum given to prepare).
+    // ES: Establece el número de parciales generados (0 al máximo dado a prepare).
+    void setNumPartials(int inNumPartials);
+
+    // EN: Sets the frequency (Hz) and gain of a partial.
+    // ES: Establece la frecuencia (Hz) y la ganancia de un parcial.
+    void setPartial(int index, float inFrequency, float inGain);
+
+    // EN: Sets the frequency of a partial in Hz. The phase continues from where it is.
+    // ES: Establece la frecuencia de un parcial en Hz. La fase continúa desde donde está.
+    void setPartialFrequency(int index, float inFrequency);
+
+    // EN: Sets the gain of a partial, reached at the end of the next block.
+    // ES: Establece la ganancia de un parcial, alcanzada al final del siguiente bloque.
+    void setPartialGain(int index, float inGain);
+
+    // EN: Sets the phase of every partial (in radians, 0 starts the sines at zero) and jumps the gains to their targets.
+    // ES: Establece la fase de todos los parciales (en radianes, 0 empieza los senos en cero) y salta las ganancias a sus objetivos.
+    void reset(float inPhase = 0.0f);
+
+    // EN: Writes the sum of the partials to output.
+    // ES: Escribe la suma de los parciales en output.
+    void render(float* output, int numSamples);
+
+    // EN: Renders the first channel and copies it to the others.
+    // ES: Genera el primer canal y lo copia a los demás.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    static constexpr int numLanes = 8;
+    static constexpr int renormalizeInterval = 256;
+
+private:
+    // EN: Recalculates the rotation of a partial and whether it is below Nyquist.
+    // ES: Recalcula la rotación de un parcial y si está por debajo de Nyquist.
+    void updateRotation(int index);
+
+    // EN: Renders at most renormalizeInterval samples of the group of lanes starting at firstPartial, adding to
+    //     output, and renormalizes its phasors.
+    // ES: Genera como mucho renormalizeInterval muestras del grupo de carriles que empieza en firstPartial, sumando
+    //     a output, y renormaliza sus fasores.
+    void renderGroup(float* output, int numSamples, int firstPartial);
+
+    double sampleRate{ 44100.0 };
+    int maxPartials{ 0 };
+    int numPartials{ 0 };
+
+    // EN: Partial state, padded to a multiple of numLanes. Padding partials have zero gain.
+    // ES: Estado de los parciales, completado a un múltiplo de numLanes. Los parciales de relleno tienen ganancia cero.
+    std::vector<float> frequency;
+    std::vector<float> real;
+    std::vector<float> imag;
+    std::vector<float> rotationCos;
+    std::vector<float> rotationSin;
+    std::vector<float> gain;
+    std::vector<float> targetGain;
+    std::vector<float> gainStep;
+    std::vector<float> audible;
+};
@@ -22,6 +22,14 @@ void AmpModulation::setSpeed(float inSpeedValue)
     // EN: Sets the speed (frequency) of the modulation, controlling how fast the amplitude changes over time.
     // ES: Establece la velocidad (frecuencia) de la modulaci�n, controlando qu� tan r�pido cambia la amplitud con el tiempo.
     speedValue = inSpeedValue;
+    phaseIncrement = speedValue / sampleRate;
+}
+
+void AmpModulation::setControlInterval(int inControlInterval)
+{
+    // EN: Sets the control interval of the modulation; it applies from the next control tick.
+    // ES: Establece el intervalo de control de la modulación; se aplica desde el siguiente tick de control.
+    modulationRamp.setInterval(inControlInterval);
 }
 
 void AmpModulation::prepare(double theSampleRate)
@@ -30,66 +38,57 @@ void AmpModulation::prepare(double theSampleRate)
     // ES: Prepara la modulaci�n configurando la frecuencia de muestreo e inicializando las variables de tiempo.
     sampleRate = static_cast<float>(theSampleRate);
 
-    // EN: Initializes the time and delta time for both channels (assumed to be stereo, so two channels).
-    // ES: Inicializa el tiempo y el delta de tiempo para ambos canales (se asume est�reo, por lo que hay dos canales).
-    for (int i = 0; i < 2; i++)
-    {
-        time[i] = 0.0f;
-        deltTime[i] = 1.0f / sampleRate; // EN: Sets the time step based on the sample rate. | ES: Ajusta el paso de tiempo basado en la frecuencia de muestreo.
-    }
+    // EN: Restarts the modulation signal; it starts at its value at phase 0 and the first sample is a control tick.
+    // ES: Reinicia la señal de modulación; empieza en su valor en la fase 0 y la primera muestra es un tick de control.
+    phase = 0.0f;
+    phaseIncrement = speedValue / sampleRate;
+    modulationRamp.reset(1.0f - 0.5f * (depthValue / 100.0f));
+}
+
+void AmpModulation::updateModulation()
+{
+    // EN: Calculates the amplitude modulation depth and offset.
+    //     The modulation depth is scaled down to be between 0 and 0.5.
+    // ES: Calcula la profundidad de modulación de amplitud y el offset.
+    //     La profundidad de modulación se escala para estar entre 0 y 0.5.
+    const float amplitud = 0.5f * (depthValue / 100.0f);
+    const float offset = 1.0f - amplitud;
+
+    // EN: Evaluates the sine wave at the last sample of the next control interval (with an interval of 1, at every
+    //     sample) and moves the phase to the first sample after the interval.
+    // ES: Evalúa la onda sinusoidal en la última muestra del siguiente intervalo de control (con un intervalo de 1, en
+    //     cada muestra) y lleva la fase a la primera muestra tras el intervalo.
+    const int interval = modulationRamp.getInterval();
+    const float sw = sinf(2.0f * pi * (phase + phaseIncrement * static_cast<float>(interval - 1)));
+
+    modulationRamp.setTarget((amplitud * sw) + offset);
+
+    phase += phaseIncrement * static_cast<float>(interval);
+    phase -= std::floor(phase);
 }
 
 void AmpModulation::process(juce::AudioBuffer<float>& buffer)
 {
-    // EN: Loops through each audio channel.
-    // ES: Recorre cada canal de audio.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // EN: The modulation is the same for every channel, so each chunk of it is rendered once and every channel is
+    //     multiplied by it. A chunk never crosses a control tick.
+    // ES: La modulación es la misma para todos los canales, así cada tramo se genera una vez y cada canal se
+    //     multiplica por él. Un tramo nunca cruza un tick de control.
+    for (int start = 0; start < numSamples;)
     {
-        // EN: Loops through each audio sample in the current channel.
-        // ES: Recorre cada muestra de audio en el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            // EN: Reads the input sample from the audio buffer.
-            // ES: Lee la muestra de entrada del buffer de audio.
-            float inSample = buffer.getSample(channel, i);
-
-            // EN: Calculates the amplitude modulation depth and offset.
-            //     The modulation depth is scaled down to be between 0 and 0.5.
-            // ES: Calcula la profundidad de modulaci�n de amplitud y el offset.
-            //     La profundidad de modulaci�n se escala para estar entre 0 y 0.5.
-            float amplitud = 0.5f * (depthValue / 100.0f);
-            float offset = 1.0f - amplitud;
-
-            // EN: Initializes the phase (phi) and the modulation frequency (f).
-            // ES: Inicializa la fase (phi) y la frecuencia de modulaci�n (f).
-            float phi = 0.0f;
-            float f = speedValue;
-
-            // EN: Applies the sine wave modulation (sw), using the time value for the current channel.
-            // ES: Aplica la modulaci�n con una onda sinusoidal (sw), usando el valor de tiempo del canal actual.
-            float sw = sinf(2.0f * pi * f * time[channel] + phi);
-
-            // EN: Computes the modulation value (mod) by applying the sine wave to the amplitude and adding the offset.
-            // ES: Calcula el valor de modulaci�n (mod) aplicando la onda sinusoidal a la amplitud y sumando el offset.
-            float mod = (amplitud * sw) + offset;
-
-            // EN: Modulates the input sample by multiplying it with the modulation value.
-            // ES: Modula la muestra de entrada multiplic�ndola con el valor de modulaci�n.
-            float outSample = inSample * mod;
-
-            // EN: Writes the modulated sample back to the buffer.
-            // ES: Escribe la muestra modulada de nuevo al buffer.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Advances the time for the current channel.
-            // ES: Avanza el tiempo para el canal actual.
-            time[channel] += deltTime[channel];
-
-            // EN: If the time exceeds 1.0 (a full cycle), it resets to 0.
-            // ES: Si el tiempo excede 1.0 (un ciclo completo), se reinicia a 0.
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
-        }
+        if (modulationRamp.getSamplesToTick() == 0)
+            updateModulation();
+
+        const int n = juce::jmin(chunkSize, numSamples - start, modulationRamp.getSamplesToTick());
+
+        modulationRamp.render(modulation.data(), n);
+
+        for (int channel = 0; channel < numChannels; channel++)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, start), modulation.data(), n);
+
+        start += n;
     }
 }
 
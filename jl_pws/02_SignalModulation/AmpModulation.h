@@ -10,6 +10,7 @@
 
 #pragma once
 //#include <JuceHeader.h>
+#include <array>
 
 // EN: Class AmpModulation: Implements amplitude modulation (tremolo) with configurable depth and speed.
 // ES: Clase AmpModulation: Implementa modulación de amplitud (tremolo) con profundidad y velocidad configurables.
@@ -29,6 +30,12 @@ public:
     // ES: Configura la velocidad de la modulación de amplitud en Hz (0-20 Hz).
     void setSpeed(float inSpeedValue);
 
+    // EN: Sets the control interval in samples (1 = audio rate, e.g. 16, 32 or 64): the modulation is computed once per
+    //     interval and interpolated linearly in between.
+    // ES: Configura el intervalo de control en muestras (1 = tasa de audio, p. ej. 16, 32 o 64): la modulación se calcula
+    //     una vez por intervalo y se interpola linealmente entre ellos.
+    void setControlInterval(int inControlInterval);
+
     // EN: Prepares the modulation by initializing the sample rate.
     // ES: Prepara la modulación inicializando la frecuencia de muestreo.
     void prepare(double theSampleRate);
@@ -42,10 +49,10 @@ private:
     // ES: Constante matemática pi (π).
     float pi{ juce::MathConstants<float>::pi };
 
-    // EN: Time and time increment for modulation signal per channel.
-    // ES: Tiempo e incremento de tiempo para la señal de modulación por canal.
-    float time[2];
-    float deltTime[2];
+    // EN: Phase of the modulation signal in cycles (0 to 1), shared by the channels, and its increment per sample.
+    // ES: Fase de la señal de modulación en ciclos (0 a 1), compartida por los canales, y su incremento por muestra.
+    float phase{ 0.0f };
+    float phaseIncrement{ 0.0f };
 
     // EN: Sample rate for audio processing.
     // ES: Frecuencia de muestreo para el procesamiento de audio.
@@ -59,6 +66,16 @@ private:
     float speedValue{ 5.0 }; // EN: Modulation speed in Hz (0-20 Hz).
                              // ES: Velocidad de modulación en Hz (0-20 Hz).
 
+    // EN: Computes the modulation at the end of the next control interval and advances the phase over it.
+    // ES: Calcula la modulación al final del siguiente intervalo de control y avanza la fase a lo largo de él.
+    void updateModulation();
+
+    // EN: Modulation ramped between control ticks and written into modulation by chunks of chunkSize samples.
+    // ES: Modulación en rampa entre ticks de control y escrita en modulation por tramos de chunkSize muestras.
+    static constexpr int chunkSize = 64;
+    ControlRateRamp modulationRamp;
+    std::array<float, chunkSize> modulation{};
+
 // EN: Additional parameters (commented out for now) for advanced modulation calculations.
 // ES: Parámetros adicionales (actualmente comentados) para cálculos avanzados de modulación.
 // float amp{0.5 * (depthValue / 100)};
@@ -22,6 +22,15 @@ void AutoPan::setDepth(float inDepthValue)
 void AutoPan::setSpeed(float inSpeedValue)
 {
     speedValue = inSpeedValue;  // EN: Assigns the speed value (0-20 Hz). | ES: Asigna el valor de velocidad (0-20 Hz).
+    phaseIncrement = speedValue / sampleRate;  // EN: Cycles advanced per sample. | ES: Ciclos avanzados por muestra.
+}
+
+// EN: Sets the control interval of both gains; it applies from the next control tick.
+// ES: Configura el intervalo de control de ambas ganancias; se aplica desde el siguiente tick de control.
+void AutoPan::setControlInterval(int inControlInterval)
+{
+    for (auto& ramp : gainRamp)
+        ramp.setInterval(inControlInterval);
 }
 
 // EN: Prepares the auto-pan effect by setting the sample rate and initializing time-related parameters.
@@ -30,60 +39,71 @@ void AutoPan::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate);  // EN: Stores the sample rate as a float. | ES: Almacena la tasa de muestreo como un float.
 
-    for (int i = 0; i < 2; i++)  // EN: Initializes time and delta time for both channels. | ES: Inicializa el tiempo y el delta de tiempo para ambos canales.
-    {
-        time[i] = 0.0f;
-        deltTime[i] = 1.0f / sampleRate;  // EN: Delta time is the reciprocal of the sample rate. | ES: Delta de tiempo es el rec�proco de la tasa de muestreo.
-    }
+    phase = 0.0f;  // EN: Restarts the sine wave. | ES: Reinicia la onda sinusoidal.
+    phaseIncrement = speedValue / sampleRate;  // EN: Cycles advanced per sample. | ES: Ciclos avanzados por muestra.
+
+    // EN: Both gains start at the value of the sine wave at phase 0 and the first sample is a control tick.
+    // ES: Ambas ganancias empiezan en el valor de la onda sinusoidal en la fase 0 y la primera muestra es un tick de control.
+    const float offset = 1.0f - 0.5f * (depthValue / 100.0f);
+    gainRamp[0].reset(powf(1 - offset, 0.75f));
+    gainRamp[1].reset(powf(offset, 0.75f));
+}
+
+// EN: Evaluates the sine wave at the last sample of the next control interval, so with an interval of 1 every sample
+//     gets its own gains, and moves the phase to the first sample after the interval.
+// ES: Evalúa la onda sinusoidal en la última muestra del siguiente intervalo de control, así con un intervalo de 1 cada
+//     muestra recibe sus propias ganancias, y lleva la fase a la primera muestra tras el intervalo.
+void AutoPan::updateGains()
+{
+    const int interval = gainRamp[0].getInterval();
+
+    // EN: Calculates modulation parameters for the sine wave. Depth controls the modulation intensity and the offset
+    //     ensures a minimum modulation level.
+    // ES: Calcula los parámetros de modulación para la onda sinusoidal. Depth controla la intensidad de la modulación y
+    //     el offset asegura un nivel mínimo de modulación.
+    const float amplitude = 0.5f * (depthValue / 100.0f);
+    const float offset = 1.0f - amplitude;
+
+    const float sw = sinf(2.0f * pi * (phase + phaseIncrement * static_cast<float>(interval - 1)));
+    const float mod = (amplitude * sw) + offset;
+
+    // EN: The left channel loses volume as the sine wave decreases and the right one gains volume as it increases;
+    //     one powf per gain per control tick.
+    // ES: El canal izquierdo pierde volumen a medida que la onda sinusoidal disminuye y el derecho lo gana a medida que
+    //     aumenta; un powf por ganancia por tick de control.
+    gainRamp[0].setTarget(powf(1 - mod, 0.75f));
+    gainRamp[1].setTarget(powf(mod, 0.75f));
+
+    phase += phaseIncrement * static_cast<float>(interval);
+    phase -= std::floor(phase);
 }
 
 // EN: Processes the audio buffer, applying the auto-pan effect by modulating the amplitude of each channel based on a sine wave.
+//     The gains do not depend on the sample values, so each chunk of them is rendered once and applied with a vector multiply:
+//     channel 0 takes the left gain and the other channels the right gain.
 // ES: Procesa el buffer de audio, aplicando el efecto de auto-pan modulando la amplitud de cada canal basado en una onda sinusoidal.
+//     Las ganancias no dependen de los valores de las muestras, así cada tramo se genera una vez y se aplica con una multiplicación
+//     vectorial: el canal 0 toma la ganancia izquierda y los demás canales la derecha.
 void AutoPan::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)  // EN: Loops through each channel in the buffer. | ES: Recorre cada canal en el buffer.
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    for (int start = 0; start < numSamples;)
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++)  // EN: Loops through each sample in the buffer. | ES: Recorre cada muestra en el buffer.
-        {
-            float sample = buffer.getSample(channel, i);  // EN: Gets the current sample from the buffer. | ES: Obtiene la muestra actual del buffer.
-
-            // EN: Calculates modulation parameters for the sine wave.
-            // ES: Calcula los par�metros de modulaci�n para la onda sinusoidal.
-            float amplitude = 0.5f * (depthValue / 100.0f);  // EN: Depth controls the modulation intensity. | ES: Depth controla la intensidad de la modulaci�n.
-            float offset = 1.0f - amplitude;  // EN: Offset ensures a minimum modulation level. | ES: Offset asegura un nivel m�nimo de modulaci�n.
-            float phi = 0.0f;  // EN: Phase offset for the sine wave. | ES: Desplazamiento de fase para la onda sinusoidal.
-            float f = speedValue;  // EN: Frequency of the modulation in Hz. | ES: Frecuencia de la modulaci�n en Hz.
-
-            // EN: Calculates the sine wave for modulation, using the current time and frequency.
-            // ES: Calcula la onda sinusoidal para la modulaci�n, usando el tiempo actual y la frecuencia.
-            float sw = sinf(2.0f * pi * f * time[channel] + phi);
-
-            // EN: Computes the modulation factor for this sample.
-            // ES: Calcula el factor de modulaci�n para esta muestra.
-            float mod = (amplitude * sw) + offset;
-
-            // EN: Modulates the left channel by reducing volume as the sine wave decreases.
-            // ES: Modula el canal izquierdo reduciendo el volumen a medida que la onda sinusoidal disminuye.
-            if (channel == 0)
-            {
-                sample *= powf(1 - mod, 0.75f);
-            }
-            // EN: Modulates the right channel by increasing volume as the sine wave increases.
-            // ES: Modula el canal derecho aumentando el volumen a medida que la onda sinusoidal aumenta.
-            else
-            {
-                sample *= powf(mod, 0.75f);
-            }
-
-            buffer.setSample(channel, i, sample);  // EN: Writes the modulated sample back to the buffer. | ES: Escribe la muestra modulada de vuelta en el buffer.
-
-            time[channel] += deltTime[channel];  // EN: Advances the time for the current channel. | ES: Avanza el tiempo para el canal actual.
-
-            // EN: Resets time to prevent overflow when it reaches 1 second.
-            // ES: Reinicia el tiempo para prevenir desbordamientos cuando alcanza 1 segundo.
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
-        }
+        if (gainRamp[0].getSamplesToTick() == 0)
+            updateGains();
+
+        // EN: A chunk never crosses a control tick. | ES: Un tramo nunca cruza un tick de control.
+        const int n = juce::jmin(chunkSize, numSamples - start, gainRamp[0].getSamplesToTick());
+
+        gainRamp[0].render(gains[0].data(), n);
+        gainRamp[1].render(gains[1].data(), n);
+
+        for (int channel = 0; channel < numChannels; channel++)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, start), gains[channel == 0 ? 0 : 1].data(), n);
+
+        start += n;
     }
 }
 
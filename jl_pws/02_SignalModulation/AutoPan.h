@@ -10,6 +10,7 @@
 
 #pragma once
 //#include <JuceHeader.h>
+#include <array>
 
 // EN: Class AutoPan: Implements an auto-pan effect that modulates the stereo field based on a sine wave.
 // ES: Clase AutoPan: Implementa un efecto de auto-pan que modula el campo est�reo basado en una onda sinusoidal.
@@ -22,6 +23,11 @@ public:
     // EN: Sets the speed of the auto-pan effect (0-20 Hz). | ES: Configura la velocidad del efecto de auto-pan (0-20 Hz).
     void setSpeed(float inSpeedValue);
 
+    // EN: Sets the control interval in samples (1 = audio rate, e.g. 16, 32 or 64): the pan gains are computed once per interval
+    //     and interpolated linearly in between. | ES: Configura el intervalo de control en muestras (1 = tasa de audio, p. ej. 16, 32
+    //     o 64): las ganancias de paneo se calculan una vez por intervalo y se interpolan linealmente entre ellos.
+    void setControlInterval(int inControlInterval);
+
     // EN: Prepares the auto-pan effect by setting the sample rate and initializing parameters.
     // ES: Prepara el efecto de auto-pan configurando la tasa de muestreo e inicializando par�metros.
     void prepare(double theSampleRate);
@@ -37,12 +43,22 @@ public:
 
 private:
     float pi{ juce::MathConstants<float>::pi };  // EN: Value of Pi for sine wave calculations. | ES: Valor de Pi para c�lculos de onda sinusoidal.
-    float time[2];  // EN: Time variables for each stereo channel. | ES: Variables de tiempo para cada canal est�reo.
-    float deltTime[2];  // EN: Delta time for advancing the sine wave. | ES: Delta de tiempo para avanzar la onda sinusoidal.
+    float phase{ 0.0f };  // EN: Phase of the sine wave in cycles (0 to 1), shared by the channels. | ES: Fase de la onda sinusoidal en ciclos (0 a 1), compartida por los canales.
+    float phaseIncrement{ 0.0f };  // EN: Phase increment per sample, in cycles. | ES: Incremento de fase por muestra, en ciclos.
     float sampleRate{ 44100.0f };  // EN: Sample rate of the audio buffer. | ES: Tasa de muestreo del buffer de audio.
 
     // EN: Parameters for the tremolo modulation.
     // ES: Par�metros para la modulaci�n del tremolo.
     float depthValue{ 0 };  // EN: Depth of the modulation (0-100). | ES: Profundidad de la modulaci�n (0-100).
     float speedValue{ 5.0 };  // EN: Speed of the modulation in Hz (0-20). | ES: Velocidad de la modulaci�n en Hz (0-20).
+
+    // EN: Computes the gains at the end of the next control interval and advances the phase over it.
+    // ES: Calcula las ganancias al final del siguiente intervalo de control y avanza la fase a lo largo de él.
+    void updateGains();
+
+    // EN: Left and right gains, ramped between control ticks and written into gains by chunks of chunkSize samples.
+    // ES: Ganancias izquierda y derecha, en rampa entre ticks de control y escritas en gains por tramos de chunkSize muestras.
+    static constexpr int chunkSize = 64;
+    ControlRateRamp gainRamp[2];
+    std::array<float, chunkSize> gains[2]{};
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+
+    ControlRateRamp.cpp
+    Created: 19 Oct 2026 3:47:38am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "ControlRateRamp.h"
+
+// EN: Constructor of ControlRateRamp class.
+// ES: Constructor de la clase ControlRateRamp.
+ControlRateRamp::ControlRateRamp()
+{
+}
+
+// EN: Destructor of ControlRateRamp class.
+// ES: Destructor de la clase ControlRateRamp.
+ControlRateRamp::~ControlRateRamp()
+{
+}
+
+// EN: Sets the control interval.
+// ES: Establece el intervalo de control.
+void ControlRateRamp::setInterval(int inInterval)
+{
+    interval = juce::jmax(1, inInterval);
+}
+
+// EN: Returns the control interval.
+// ES: Devuelve el intervalo de control.
+int ControlRateRamp::getInterval() const
+{
+    return interval;
+}
+
+// EN: Jumps to a value.
+// ES: Salta a un valor.
+void ControlRateRamp::reset(float inValue)
+{
+    value = inValue;
+    target = inValue;
+    step = 0.0f;
+    samplesToTick = 0;
+}
+
+// EN: Returns the samples left before the next tick.
+// ES: Devuelve las muestras que faltan para el siguiente tick.
+int ControlRateRamp::getSamplesToTick() const
+{
+    return samplesToTick;
+}
+
+// EN: Starts the ramp of the next interval.
+// ES: Empieza la rampa del siguiente intervalo.
+void ControlRateRamp::setTarget(float inTarget)
+{
+    target = inTarget;
+    step = (target - value) / static_cast<float>(interval);
+    samplesToTick = interval;
+}
+
+// EN: The values are start + (i + 1) * step, and the last sample of the interval is the target itself, so the ramp
+//     never drifts and an interval of 1 gives exactly the values set at each tick.
+// ES: Los valores son inicio + (i + 1) * paso, y la última muestra del intervalo es el propio objetivo, así la rampa
+//     nunca se desvía y un intervalo de 1 da exactamente los valores fijados en cada tick.
+void ControlRateRamp::render(float* output, int numSamples)
+{
+    jassert(numSamples <= samplesToTick);
+
+    if (numSamples <= 0)
+        return;
+
+    const float start = value;
+
+    for (int i = 0; i < numSamples; i++)
+        output[i] = start + static_cast<float>(i + 1) * step;
+
+    samplesToTick -= numSamples;
+
+    if (samplesToTick == 0)
+        output[numSamples - 1] = target;
+
+    value = output[numSamples - 1];
+}
+
+// EN: Returns the last value written.
+// ES: Devuelve el último valor escrito.
+float ControlRateRamp::getValue() const
+{
+    return value;
+}
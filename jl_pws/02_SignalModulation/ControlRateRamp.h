@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    ControlRateRamp.h
+    Created: 19 Oct 2026 3:47:38am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+
+// EN: ControlRateRamp lets a processor evaluate a modulation value (and anything derived from it, like a gain curve)
+//     once every interval samples instead of every sample. At each control tick the processor sets the value the
+//     ramp must reach at the end of the next interval, and the samples in between are a straight line from the
+//     previous tick. An interval of 1 is audio rate: every sample is a tick and the output is the target itself.
+// ES: ControlRateRamp permite a un procesador evaluar un valor de modulación (y todo lo que se deriva de él, como
+//     una curva de ganancia) una vez cada interval muestras en lugar de en cada muestra. En cada tick de control el
+//     procesador fija el valor que la rampa debe alcanzar al final del siguiente intervalo, y las muestras
+//     intermedias son una recta desde el tick anterior. Un intervalo de 1 es tasa de audio: cada muestra es un tick
+//     y la salida es el propio objetivo.
+class ControlRateRamp
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    ControlRateRamp();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~ControlRateRamp();
+
+    // EN: Sets the number of samples between control ticks (at least 1). It applies from the next tick.
+    // ES: Establece el número de muestras entre ticks de control (al menos 1). Se aplica desde el siguiente tick.
+    void setInterval(int inInterval);
+    int getInterval() const;
+
+    // EN: Jumps to a value; the next sample is a control tick.
+    // ES: Salta a un valor; la siguiente muestra es un tick de control.
+    void reset(float inValue);
+
+    // EN: Returns the samples left before the next control tick; 0 means a new target is due.
+    // ES: Devuelve las muestras que faltan para el siguiente tick de control; 0 significa que toca un objetivo nuevo.
+    int getSamplesToTick() const;
+
+    // EN: Starts a ramp from the current value that reaches inTarget after interval samples.
+    // ES: Empieza una rampa desde el valor actual que llega a inTarget tras interval muestras.
+    void setTarget(float inTarget);
+
+    // EN: Writes the next numSamples values (at most getSamplesToTick()) to output.
+    // ES: Escribe los siguientes numSamples valores (como mucho getSamplesToTick()) en output.
+    void render(float* output, int numSamples);
+
+    // EN: Returns the last value written.
+    // ES: Devuelve el último valor escrito.
+    float getValue() const;
+
+private:
+    int interval{ 1 };
+    int samplesToTick{ 0 };
+    float value{ 0.0f };
+    float target{ 0.0f };
+    float step{ 0.0f };
+};
@@ -0,0 +1,290 @@
+/*
+  ==============================================================================
+
+    Envelope.cpp
+    Created: 19 Oct 2026 3:43:14am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "Envelope.h"
+
+// EN: Constructor of Envelope class.
+// ES: Constructor de la clase Envelope.
+Envelope::Envelope()
+{
+}
+
+// EN: Destructor of Envelope class.
+// ES: Destructor de la clase Envelope.
+Envelope::~Envelope()
+{
+}
+
+// EN: Sets the sample rate.
+// ES: Establece la frecuencia de muestreo.
+void Envelope::prepare(double inSampleRate)
+{
+    sampleRate = inSampleRate;
+}
+
+// EN: Sets the attack time.
+// ES: Establece el tiempo de ataque.
+void Envelope::setAttackTime(float inAttackTime)
+{
+    attackTime = juce::jmax(0.0f, inAttackTime);
+}
+
+// EN: Sets the hold time.
+// ES: Establece el tiempo de mantenimiento.
+void Envelope::setHoldTime(float inHoldTime)
+{
+    holdTime = juce::jmax(0.0f, inHoldTime);
+}
+
+// EN: Sets the decay time.
+// ES: Establece el tiempo de caída.
+void Envelope::setDecayTime(float inDecayTime)
+{
+    decayTime = juce::jmax(0.0f, inDecayTime);
+}
+
+// EN: Sets the release time.
+// ES: Establece el tiempo de liberación.
+void Envelope::setReleaseTime(float inReleaseTime)
+{
+    releaseTime = juce::jmax(0.0f, inReleaseTime);
+}
+
+// EN: A sustaining envelope moves to the new level at once.
+// ES: Una envolvente sostenida pasa al nuevo nivel de inmediato.
+void Envelope::setSustainLevel(float inSustainLevel)
+{
+    sustainLevel = juce::jlimit(0.0f, 1.0f, inSustainLevel);
+
+    if (stage == Stage::Sustain)
+        enterStage(Stage::Sustain);
+}
+
+// EN: Sets the curve of the segments.
+// ES: Establece la curva de los segmentos.
+void Envelope::setCurve(Curve inCurve)
+{
+    curve = inCurve;
+}
+
+// EN: Starts the attack.
+// ES: Empieza el ataque.
+void Envelope::noteOn(float peak)
+{
+    peakLevel = juce::jlimit(0.0f, 1.0f, peak);
+    enterStage(Stage::Attack);
+}
+
+// EN: Starts the release, unless the envelope is already silent.
+// ES: Empieza la liberación, salvo que la envolvente ya esté en silencio.
+void Envelope::noteOff()
+{
+    if (stage != Stage::Idle)
+        enterStage(Stage::Release);
+}
+
+// EN: Jumps to silence.
+// ES: Salta al silencio.
+void Envelope::reset()
+{
+    stage = Stage::Idle;
+    value = 0.0f;
+    samplesLeft = 0;
+}
+
+// EN: Returns the stage.
+// ES: Devuelve la etapa.
+Envelope::Stage Envelope::getStage() const
+{
+    return stage;
+}
+
+// EN: Returns the current value.
+// ES: Devuelve el valor actual.
+float Envelope::getValue() const
+{
+    return value;
+}
+
+// EN: Returns whether the envelope is not idle.
+// ES: Devuelve si la envolvente no está inactiva.
+bool Envelope::isActive() const
+{
+    return stage != Stage::Idle;
+}
+
+// EN: Each timed stage starts its segment; an empty segment finishes at once, so zero times skip their stage. A
+//     sustain at 0 is silence, so the envelope goes idle instead of holding it.
+// ES: Cada etapa con tiempo empieza su segmento; un segmento vacío termina de inmediato, así los tiempos cero se
+//     saltan su etapa. Un sostenimiento en 0 es silencio, así la envolvente pasa a inactiva en lugar de mantenerlo.
+void Envelope::enterStage(Stage newStage)
+{
+    stage = newStage;
+
+    switch (stage)
+    {
+        case Stage::Attack:  startSegment(peakLevel, attackTime, attackRatio); break;
+        case Stage::Hold:    startSegment(value, holdTime, attackRatio); break;
+        case Stage::Decay:   startSegment(sustainLevel * peakLevel, decayTime, decayReleaseRatio); break;
+        case Stage::Release: startSegment(0.0f, releaseTime, decayReleaseRatio); break;
+        case Stage::Idle:    value = 0.0f; return;
+        case Stage::Sustain:
+            value = sustainLevel * peakLevel;
+
+            if (value == 0.0f)
+                stage = Stage::Idle;
+
+            return;
+    }
+
+    if (samplesLeft == 0)
+        finishSegment();
+}
+
+// EN: Attack, hold and decay lead to the next stage; the release ends in silence.
+// ES: Ataque, mantenimiento y caída llevan a la siguiente etapa; la liberación termina en silencio.
+void Envelope::finishSegment()
+{
+    value = target;
+
+    switch (stage)
+    {
+        case Stage::Attack: enterStage(Stage::Hold); break;
+        case Stage::Hold:   enterStage(Stage::Decay); break;
+        case Stage::Decay:  enterStage(Stage::Sustain); break;
+        default:            enterStage(Stage::Idle); break;
+    }
+}
+
+// EN: With start value v, the exponential asymptote is a = target + ratio * (target - v), so
+//     coeff^length = (target - a) / (v - a) = ratio / (1 + ratio) and the curve lands on the target.
+// ES: Con valor inicial v, la asíntota exponencial es a = objetivo + ratio * (objetivo - v), así
+//     coef^longitud = (objetivo - a) / (v - a) = ratio / (1 + ratio) y la curva llega al objetivo.
+void Envelope::startSegment(float inTarget, float inTime, float ratio)
+{
+    target = inTarget;
+    samplesLeft = static_cast<int>(inTime * sampleRate);
+
+    if (samplesLeft == 0)
+        return;
+
+    exponential = curve == Curve::Exponential && target != value;
+
+    if (exponential)
+    {
+        asymptote = target + ratio * (target - value);
+
+        const double coeff = std::pow(static_cast<double>(ratio) / (1.0 + ratio), 1.0 / samplesLeft);
+        double power = coeff;
+
+        for (auto& p : powers)
+        {
+            p = static_cast<float>(power);
+            power *= coeff;
+        }
+    }
+    else
+    {
+        step = (target - value) / static_cast<float>(samplesLeft);
+    }
+}
+
+// EN: Linear spans are start + (i + 1) * step. Exponential spans are numLanes samples at a time,
+//     a + delta * coeff^(k + 1), with delta scaled by coeff^numLanes after each group.
+// ES: Los tramos lineales son inicio + (i + 1) * paso. Los exponenciales van de numLanes en numLanes muestras,
+//     a + delta * coef^(k + 1), con delta escalado por coef^numLanes tras cada grupo.
+void Envelope::renderSegment(float* output, int numSamples)
+{
+    if (numSamples == 0)
+        return;
+
+    if (!exponential)
+    {
+        const float start = value;
+
+        for (int i = 0; i < numSamples; i++)
+            output[i] = start + static_cast<float>(i + 1) * step;
+    }
+    else
+    {
+        const float stride = powers[numLanes - 1];
+        float delta = value - asymptote;
+        int i = 0;
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+        {
+            for (int k = 0; k < numLanes; k++)
+                output[i + k] = asymptote + delta * powers[static_cast<size_t>(k)];
+
+            delta *= stride;
+        }
+
+        for (int k = 0; i < numSamples; i++, k++)
+            output[i] = asymptote + delta * powers[static_cast<size_t>(k)];
+    }
+
+    value = output[numSamples - 1];
+}
+
+// EN: Sustain and idle are constant fills; the other stages render up to the end of their segment, land exactly on
+//     the target and move on.
+// ES: Sostenimiento e inactivo son rellenos constantes; las demás etapas generan hasta el final de su segmento,
+//     llegan exactamente al objetivo y continúan.
+void Envelope::render(float* output, int numSamples)
+{
+    int done = 0;
+
+    while (done < numSamples)
+    {
+        if (stage == Stage::Idle || stage == Stage::Sustain)
+        {
+            juce::FloatVectorOperations::fill(output + done, value, numSamples - done);
+            return;
+        }
+
+        const int n = juce::jmin(samplesLeft, numSamples - done);
+
+        renderSegment(output + done, n);
+        done += n;
+        samplesLeft -= n;
+
+        if (samplesLeft == 0)
+        {
+            output[done - 1] = target;
+            finishSegment();
+        }
+    }
+}
+
+// EN: The envelope is rendered in chunks into gains and applied to every channel with a vector multiply.
+// ES: La envolvente se genera por tramos en gains y se aplica a cada canal con una multiplicación vectorial.
+void Envelope::process(juce::AudioBuffer<float>& buffer)
+{
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int n = juce::jmin(chunkSize, numSamples - start);
+
+        render(gains.data(), n);
+
+        for (int channel = 0; channel < numChannels; channel++)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, start), gains.data(), n);
+    }
+}
+
+// EN: Renders each envelope into its row.
+// ES: Genera cada envolvente en su fila.
+void Envelope::renderBatch(Envelope* envelopes, int numEnvelopes, float* output, int numSamples)
+{
+    for (int k = 0; k < numEnvelopes; k++)
+        envelopes[k].render(output + static_cast<size_t>(k) * static_cast<size_t>(numSamples), numSamples);
+}
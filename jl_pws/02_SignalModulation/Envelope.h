@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    Envelope.h
+    Created: 19 Oct 2026 3:43:14am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+
+// EN: Envelope is an AHDSR envelope generator (an ADSR when the hold time is 0) for voice gains and modulation.
+//     Each segment (attack, hold, decay, release) is rendered as a whole span: the samples left in the segment are
+//     computed in closed form from its start value, so the only branches are at the segment boundaries.
+//     - Linear segments: value[n] = start + n * step.
+//     - Exponential segments: value[n] = asymptote + (start - asymptote) * coeff^n, with the asymptote placed
+//       beyond the target so the curve reaches the target exactly at the end of the segment. The powers of coeff
+//       are kept for numLanes samples, so a span is computed numLanes samples at a time without a dependency
+//       between them.
+//     noteOn starts the attack from the current value and noteOff the release, so retriggers do not click.
+// ES: Envelope es un generador de envolvente AHDSR (un ADSR cuando el tiempo de mantenimiento es 0) para ganancias
+//     de voces y modulación. Cada segmento (ataque, mantenimiento, caída, liberación) se genera como un tramo
+//     completo: las muestras que quedan en el segmento se calculan en forma cerrada desde su valor inicial, así las
+//     únicas ramas están en los límites de los segmentos.
+//     - Segmentos lineales: valor[n] = inicio + n * paso.
+//     - Segmentos exponenciales: valor[n] = asíntota + (inicio - asíntota) * coef^n, con la asíntota situada más
+//       allá del objetivo para que la curva llegue exactamente al objetivo al final del segmento. Las potencias de
+//       coef se guardan para numLanes muestras, así un tramo se calcula de numLanes en numLanes muestras sin
+//       dependencia entre ellas.
+//     noteOn empieza el ataque desde el valor actual y noteOff la liberación, así los redisparos no producen clics.
+class Envelope
+{
+public:
+    enum class Stage
+    {
+        Idle,
+        Attack,
+        Hold,
+        Decay,
+        Sustain,
+        Release
+    };
+
+    enum class Curve
+    {
+        Linear,
+        Exponential
+    };
+
+    // EN: Constructor.
+    // ES: Constructor.
+    Envelope();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~Envelope();
+
+    // EN: Sets the sample rate.
+    // ES: Establece la frecuencia de muestreo.
+    void prepare(double inSampleRate);
+
+    // EN: Sets the segment times in seconds. A new time applies from the next segment that starts.
+    // ES: Establece los tiempos de los segmentos en segundos. Un tiempo nuevo se aplica desde el siguiente segmento que empieza.
+    void setAttackTime(float inAttackTime);
+    void setHoldTime(float inHoldTime);
+    void setDecayTime(float inDecayTime);
+    void setReleaseTime(float inReleaseTime);
+
+    // EN: Sets the sustain level as a fraction of the peak (0 to 1).
+    // ES: Establece el nivel de sostenimiento como fracción del pico (0 a 1).
+    void setSustainLevel(float inSustainLevel);
+
+    // EN: Sets the curve of the attack, decay and release segments.
+    // ES: Establece la curva de los segmentos de ataque, caída y liberación.
+    void setCurve(Curve inCurve);
+
+    // EN: Starts the attack towards peak (for example the velocity), from the current value.
+    // ES: Empieza el ataque hacia peak (por ejemplo la velocidad), desde el valor actual.
+    void noteOn(float peak = 1.0f);
+
+    // EN: Starts the release from the current value.
+    // ES: Empieza la liberación desde el valor actual.
+    void noteOff();
+
+    // EN: Jumps to silence.
+    // ES: Salta al silencio.
+    void reset();
+
+    // EN: Returns the stage, the current value and whether the envelope is not idle.
+    // ES: Devuelve la etapa, el valor actual y si la envolvente no está inactiva.
+    Stage getStage() const;
+    float getValue() const;
+    bool isActive() const;
+
+    // EN: Writes the next numSamples values of the envelope to output.
+    // ES: Escribe los siguientes numSamples valores de la envolvente en output.
+    void render(float* output, int numSamples);
+
+    // EN: Multiplies every channel of the buffer by the envelope.
+    // ES: Multiplica cada canal del buffer por la envolvente.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    // EN: Renders numEnvelopes envelopes into output, numSamples values per envelope one after another
+    //     (envelope k starts at output + k * numSamples). Idle and sustaining envelopes cost a fill.
+    // ES: Genera numEnvelopes envolventes en output, numSamples valores por envolvente uno tras otro
+    //     (la envolvente k empieza en output + k * numSamples). Las envolventes inactivas o sostenidas cuestan un relleno.
+    static void renderBatch(Envelope* envelopes, int numEnvelopes, float* output, int numSamples);
+
+    static constexpr int numLanes = 8;
+    static constexpr int chunkSize = 64;
+
+private:
+    // EN: Starts the segment of a stage, or moves on to the next stage when the segment is empty.
+    // ES: Empieza el segmento de una etapa, o pasa a la siguiente etapa cuando el segmento está vacío.
+    void enterStage(Stage newStage);
+
+    // EN: Jumps to the target of the segment and starts the next stage.
+    // ES: Salta al objetivo del segmento y empieza la siguiente etapa.
+    void finishSegment();
+
+    // EN: Prepares a segment from the current value to inTarget over inTime seconds.
+    // ES: Prepara un segmento desde el valor actual hasta inTarget durante inTime segundos.
+    void startSegment(float inTarget, float inTime, float ratio);
+
+    // EN: Writes numSamples values of the current segment and advances it.
+    // ES: Escribe numSamples valores del segmento actual y lo avanza.
+    void renderSegment(float* output, int numSamples);
+
+    // EN: Distance of the asymptote beyond the target, relative to the size of the segment. Small values give
+    //     a fast, analog-like exponential; the attack uses a larger one so it is less concave.
+    // ES: Distancia de la asíntota más allá del objetivo, relativa al tamaño del segmento. Valores pequeños dan una
+    //     exponencial rápida, como la analógica; el ataque usa uno mayor para que sea menos cóncavo.
+    static constexpr float attackRatio = 0.3f;
+    static constexpr float decayReleaseRatio = 0.001f;
+
+    double sampleRate{ 44100.0 };
+    float attackTime{ 0.01f };
+    float holdTime{ 0.0f };
+    float decayTime{ 0.1f };
+    float sustainLevel{ 1.0f };
+    float releaseTime{ 0.1f };
+    Curve curve{ Curve::Linear };
+
+    Stage stage{ Stage::Idle };
+    float value{ 0.0f };
+    float peakLevel{ 1.0f };
+
+    // EN: Current segment: target, samples left, and the linear step or the exponential asymptote and powers.
+    // ES: Segmento actual: objetivo, muestras restantes, y el paso lineal o la asíntota y potencias exponenciales.
+    float target{ 0.0f };
+    int samplesLeft{ 0 };
+    bool exponential{ false };
+    float step{ 0.0f };
+    float asymptote{ 0.0f };
+    std::array<float, numLanes> powers{};
+
+    std::array<float, chunkSize> gains{};
+};
@@ -0,0 +1,308 @@
+/*
+  ==============================================================================
+
+    ModulationMatrix.cpp
+    Created: 19 Oct 2026 3:45:28am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "ModulationMatrix.h"
+
+// EN: Constructor of ModulationMatrix class.
+// ES: Constructor de la clase ModulationMatrix.
+ModulationMatrix::ModulationMatrix()
+{
+}
+
+// EN: Destructor of ModulationMatrix class.
+// ES: Destructor de la clase ModulationMatrix.
+ModulationMatrix::~ModulationMatrix()
+{
+}
+
+// EN: The buffers are allocated here so process never allocates; the sources pick up the new sample rate.
+// ES: Los buffers se reservan aquí para que process nunca reserve memoria; las fuentes toman la nueva frecuencia de muestreo.
+void ModulationMatrix::prepare(double inSampleRate, int inMaxBlockSize)
+{
+    sampleRate = inSampleRate;
+    maxBlockSize = juce::jmax(1, inMaxBlockSize);
+
+    const size_t rowSize = static_cast<size_t>(maxBlockSize);
+    sourceBuffers.assign(rowSize * maxSources, 0.0f);
+    destinationBuffers.assign(rowSize * maxDestinations, 0.0f);
+    scratch.assign(rowSize, 0.0f);
+
+    for (int source = 0; source < maxSources; source++)
+    {
+        envelopes[static_cast<size_t>(source)].prepare(inSampleRate);
+        updateSource(source);
+    }
+}
+
+// EN: Adds a source. Oscillators start where their standalone classes start: the LFO at sin(0) and the
+//     MorphLfo at the middle of its sawtooth.
+// ES: Añade una fuente. Los osciladores empiezan donde empiezan sus clases independientes: el LFO en sin(0) y el
+//     MorphLfo en el centro de su diente de sierra.
+int ModulationMatrix::addSource(SourceType type)
+{
+    if (numSources == maxSources)
+        return -1;
+
+    const int index = numSources++;
+    Source& source = sources[static_cast<size_t>(index)];
+
+    source = Source();
+    source.type = type;
+    source.phase = type == SourceType::MorphLfo ? 0.5f : 0.0f;
+    source.ramp.setInterval(controlInterval);
+    updateSource(index);
+
+    if (type == SourceType::Lfo || type == SourceType::MorphLfo)
+        source.ramp.reset(oscillatorValue(index, source.phase));
+
+    return index;
+}
+
+// EN: Sets the rate of an oscillator source.
+// ES: Establece la frecuencia de una fuente osciladora.
+void ModulationMatrix::setSourceFrequency(int source, float inFrequency)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+
+    sources[static_cast<size_t>(source)].frequency = inFrequency;
+    updateSource(source);
+}
+
+// EN: Sets the control interval of every source; it applies from the next control tick of each one.
+// ES: Establece el intervalo de control de cada fuente; se aplica desde el siguiente tick de control de cada una.
+void ModulationMatrix::setControlInterval(int inControlInterval)
+{
+    controlInterval = juce::jmax(1, inControlInterval);
+
+    for (auto& source : sources)
+        source.ramp.setInterval(controlInterval);
+}
+
+// EN: Bakes the shape table of a MorphLfo source.
+// ES: Calcula la tabla de forma de una fuente MorphLfo.
+void ModulationMatrix::setSourceShape(int source, float inShapeValue)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+
+    shapeTables[static_cast<size_t>(source)].setShape(inShapeValue);
+}
+
+// EN: Sets the follower times.
+// ES: Establece los tiempos del seguidor.
+void ModulationMatrix::setFollowerTimes(int source, float inAttackTime, float inReleaseTime)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+
+    Source& follower = sources[static_cast<size_t>(source)];
+    follower.attackTime = juce::jmax(0.0f, inAttackTime);
+    follower.releaseTime = juce::jmax(0.0f, inReleaseTime);
+    updateSource(source);
+}
+
+// EN: Returns the envelope of a source.
+// ES: Devuelve la envolvente de una fuente.
+Envelope& ModulationMatrix::getEnvelope(int source)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+
+    return envelopes[static_cast<size_t>(source)];
+}
+
+// EN: Adds a destination.
+// ES: Añade un destino.
+int ModulationMatrix::addDestination(float baseValue)
+{
+    if (numDestinations == maxDestinations)
+        return -1;
+
+    baseValues[static_cast<size_t>(numDestinations)] = baseValue;
+    return numDestinations++;
+}
+
+// EN: Sets the base value of a destination.
+// ES: Establece el valor base de un destino.
+void ModulationMatrix::setDestinationBase(int destination, float baseValue)
+{
+    jassert(juce::isPositiveAndBelow(destination, numDestinations));
+
+    baseValues[static_cast<size_t>(destination)] = baseValue;
+}
+
+// EN: Adds a route.
+// ES: Añade una ruta.
+int ModulationMatrix::connect(int source, int destination, float depth)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+    jassert(juce::isPositiveAndBelow(destination, numDestinations));
+
+    if (numRoutes == maxRoutes)
+        return -1;
+
+    routes[static_cast<size_t>(numRoutes)] = { source, destination, depth };
+    return numRoutes++;
+}
+
+// EN: Sets the depth of a route.
+// ES: Establece la profundidad de una ruta.
+void ModulationMatrix::setDepth(int route, float depth)
+{
+    jassert(juce::isPositiveAndBelow(route, numRoutes));
+
+    routes[static_cast<size_t>(route)].depth = depth;
+}
+
+// EN: Oscillators advance frequency / sampleRate cycles per sample. The follower is a one-pole smoother on the
+//     rectified input with separate coefficients for rising (attack) and falling (release) levels.
+// ES: Los osciladores avanzan frecuencia / sampleRate ciclos por muestra. El seguidor es un suavizador de un polo
+//     sobre la entrada rectificada con coeficientes distintos para niveles que suben (ataque) y bajan (liberación).
+void ModulationMatrix::updateSource(int source)
+{
+    Source& s = sources[static_cast<size_t>(source)];
+
+    s.phaseIncrement = static_cast<float>(s.frequency / sampleRate);
+    s.attackCoeff = s.attackTime > 0.0f ? static_cast<float>(std::exp(-1.0 / (s.attackTime * sampleRate))) : 0.0f;
+    s.releaseCoeff = s.releaseTime > 0.0f ? static_cast<float>(std::exp(-1.0 / (s.releaseTime * sampleRate))) : 0.0f;
+}
+
+// EN: LFO formula: y = 0.5sin(2PIft) + 0.5, with the phase kept in cycles so it never loses precision; the
+//     MorphLfo reads its shape table.
+// ES: Fórmula del LFO: y = 0.5sin(2PIft) + 0.5, con la fase en ciclos para que nunca pierda precisión; el MorphLfo
+//     lee su tabla de forma.
+float ModulationMatrix::oscillatorValue(int source, float phase) const
+{
+    if (sources[static_cast<size_t>(source)].type == SourceType::MorphLfo)
+        return shapeTables[static_cast<size_t>(source)].getValue(phase);
+
+    return 0.5f * std::sin(juce::MathConstants<float>::twoPi * phase) + 0.5f;
+}
+
+// EN: Renders one source for the block.
+// ES: Genera una fuente para el bloque.
+void ModulationMatrix::renderSource(int source, const juce::AudioBuffer<float>& input, float* output, int numSamples)
+{
+    Source& s = sources[static_cast<size_t>(source)];
+
+    switch (s.type)
+    {
+        case SourceType::Lfo:
+        case SourceType::MorphLfo:
+        {
+            // EN: At each control tick the oscillator is evaluated at the last sample of the interval (every sample
+            //     when the interval is 1) and the phase jumps to the first sample after it.
+            // ES: En cada tick de control el oscilador se evalúa en la última muestra del intervalo (en cada muestra
+            //     cuando el intervalo es 1) y la fase salta a la primera muestra tras él.
+            for (int done = 0; done < numSamples;)
+            {
+                if (s.ramp.getSamplesToTick() == 0)
+                {
+                    const float interval = static_cast<float>(s.ramp.getInterval());
+                    const float end = s.phase + s.phaseIncrement * (interval - 1.0f);
+
+                    s.ramp.setTarget(oscillatorValue(source, end - std::floor(end)));
+
+                    s.phase += s.phaseIncrement * interval;
+                    s.phase -= std::floor(s.phase);
+                }
+
+                const int n = juce::jmin(numSamples - done, s.ramp.getSamplesToTick());
+
+                s.ramp.render(output + done, n);
+                done += n;
+            }
+
+            break;
+        }
+
+        case SourceType::Envelope:
+            envelopes[static_cast<size_t>(source)].render(output, numSamples);
+            break;
+
+        case SourceType::EnvelopeFollower:
+        {
+            // EN: Peak of the channels, then the attack / release smoother in place.
+            // ES: Pico de los canales, luego el suavizador de ataque / liberación en el mismo buffer.
+            const int numChannels = input.getNumChannels();
+
+            if (numChannels == 0)
+                juce::FloatVectorOperations::clear(output, numSamples);
+            else
+                juce::FloatVectorOperations::abs(output, input.getReadPointer(0), numSamples);
+
+            for (int channel = 1; channel < numChannels; channel++)
+            {
+                juce::FloatVectorOperations::abs(scratch.data(), input.getReadPointer(channel), numSamples);
+                juce::FloatVectorOperations::max(output, output, scratch.data(), numSamples);
+            }
+
+            float level = s.level;
+
+            for (int i = 0; i < numSamples; i++)
+            {
+                const float x = output[i];
+                const float coeff = x > level ? s.attackCoeff : s.releaseCoeff;
+
+                level = x + coeff * (level - x);
+                output[i] = level;
+            }
+
+            s.level = level;
+            break;
+        }
+    }
+}
+
+// EN: The cost is one render per source plus one multiply-add per route, so a source shared by several
+//     destinations is still computed only once.
+// ES: El coste es una generación por fuente más una multiplicación-suma por ruta, así una fuente compartida por
+//     varios destinos se sigue calculando una sola vez.
+void ModulationMatrix::process(const juce::AudioBuffer<float>& input)
+{
+    jassert(input.getNumSamples() <= maxBlockSize);
+
+    const int numSamples = juce::jmin(input.getNumSamples(), maxBlockSize);
+    const size_t rowSize = static_cast<size_t>(maxBlockSize);
+
+    for (int source = 0; source < numSources; source++)
+    {
+        shapeTables[static_cast<size_t>(source)].pullPendingShape();
+        renderSource(source, input, sourceBuffers.data() + static_cast<size_t>(source) * rowSize, numSamples);
+    }
+
+    for (int destination = 0; destination < numDestinations; destination++)
+        juce::FloatVectorOperations::fill(destinationBuffers.data() + static_cast<size_t>(destination) * rowSize,
+                                          baseValues[static_cast<size_t>(destination)], numSamples);
+
+    for (int route = 0; route < numRoutes; route++)
+    {
+        const Route& r = routes[static_cast<size_t>(route)];
+
+        juce::FloatVectorOperations::addWithMultiply(destinationBuffers.data() + static_cast<size_t>(r.destination) * rowSize,
+                                                     sourceBuffers.data() + static_cast<size_t>(r.source) * rowSize,
+                                                     r.depth, numSamples);
+    }
+}
+
+// EN: Returns the buffer of a source.
+// ES: Devuelve el buffer de una fuente.
+const float* ModulationMatrix::getSourceBuffer(int source) const
+{
+    jassert(juce::isPositiveAndBelow(source, numSources));
+
+    return sourceBuffers.data() + static_cast<size_t>(source) * static_cast<size_t>(maxBlockSize);
+}
+
+// EN: Returns the buffer of a destination.
+// ES: Devuelve el buffer de un destino.
+const float* ModulationMatrix::getDestinationBuffer(int destination) const
+{
+    jassert(juce::isPositiveAndBelow(destination, numDestinations));
+
+    return destinationBuffers.data() + static_cast<size_t>(destination) * static_cast<size_t>(maxBlockSize);
+}
@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    ModulationMatrix.h
+    Created: 19 Oct 2026 3:45:28am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: ModulationMatrix shares modulation sources between processors. Each source (a sine LFO, a MorphLfo shape,
+//     an Envelope or an envelope follower of the input) is rendered into its own block buffer once per block,
+//     however many destinations use it. A destination is a parameter with a base value; routes connect a source
+//     to a destination with a depth, and the destination buffer is base + sum(depth * source), ready for any
+//     process overload that takes per-sample values (ModulatedDelay delay times, the frequency and phase
+//     modulation buffers of the oscillators, and so on).
+//     Source ranges: Lfo 0 to 1 (like LFO), MorphLfo -1 to 1, Envelope 0 to its peak, EnvelopeFollower the peak
+//     level of the input.
+// ES: ModulationMatrix comparte fuentes de modulación entre procesadores. Cada fuente (un LFO senoidal, una forma
+//     de MorphLfo, una Envelope o un seguidor de envolvente de la entrada) se genera en su propio buffer de bloque
+//     una vez por bloque, sin importar cuántos destinos la usen. Un destino es un parámetro con un valor base; las
+//     rutas conectan una fuente con un destino con una profundidad, y el buffer del destino es
+//     base + suma(profundidad * fuente), listo para cualquier sobrecarga de process que reciba valores por muestra
+//     (los tiempos de retardo de ModulatedDelay, los buffers de frecuencia y modulación de fase de los osciladores,
+//     etc.).
+//     Rangos de las fuentes: Lfo 0 a 1 (como LFO), MorphLfo -1 a 1, Envelope 0 a su pico, EnvelopeFollower el nivel
+//     de pico de la entrada.
+class ModulationMatrix
+{
+public:
+    enum class SourceType
+    {
+        Lfo,
+        MorphLfo,
+        Envelope,
+        EnvelopeFollower
+    };
+
+    // EN: Constructor.
+    // ES: Constructor.
+    ModulationMatrix();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~ModulationMatrix();
+
+    // EN: Sets the sample rate and allocates the source and destination buffers for blocks of up to maxBlockSize samples.
+    // ES: Establece la frecuencia de muestreo y reserva los buffers de fuentes y destinos para bloques de hasta maxBlockSize muestras.
+    void prepare(double inSampleRate, int inMaxBlockSize);
+
+    // EN: Adds a source and returns its index, or -1 when all maxSources are in use.
+    // ES: Añade una fuente y devuelve su índice, o -1 cuando las maxSources están en uso.
+    int addSource(SourceType type);
+
+    // EN: Sets the rate in Hz of an Lfo or MorphLfo source.
+    // ES: Establece la frecuencia en Hz de una fuente Lfo o MorphLfo.
+    void setSourceFrequency(int source, float inFrequency);
+
+    // EN: Sets the shape of a MorphLfo source (0 to 10). Call it from the message thread, it bakes a table.
+    // ES: Establece la forma de una fuente MorphLfo (0 a 10). Se debe llamar desde el hilo de mensajes, calcula una tabla.
+    void setSourceShape(int source, float inShapeValue);
+
+    // EN: Sets the control interval in samples of the Lfo and MorphLfo sources (1 = audio rate, e.g. 16, 32 or 64): they are
+    //     evaluated once per interval and interpolated linearly in between.
+    // ES: Establece el intervalo de control en muestras de las fuentes Lfo y MorphLfo (1 = tasa de audio, p. ej. 16, 32 o 64):
+    //     se evalúan una vez por intervalo y se interpolan linealmente entre ellos.
+    void setControlInterval(int inControlInterval);
+
+    // EN: Sets the attack and release times in seconds of an EnvelopeFollower source.
+    // ES: Establece los tiempos de ataque y liberación en segundos de una fuente EnvelopeFollower.
+    void setFollowerTimes(int source, float inAttackTime, float inReleaseTime);
+
+    // EN: Returns the envelope of an Envelope source, to set its times and trigger it.
+    // ES: Devuelve la envolvente de una fuente Envelope, para configurar sus tiempos y dispararla.
+    Envelope& getEnvelope(int source);
+
+    // EN: Adds a destination with a base value and returns its index, or -1 when all maxDestinations are in use.
+    // ES: Añade un destino con un valor base y devuelve su índice, o -1 cuando los maxDestinations están en uso.
+    int addDestination(float baseValue);
+
+    // EN: Sets the base value of a destination (its value with no modulation).
+    // ES: Establece el valor base de un destino (su valor sin modulación).
+    void setDestinationBase(int destination, float baseValue);
+
+    // EN: Connects a source to a destination with a depth and returns the route index, or -1 when all maxRoutes are in use.
+    // ES: Conecta una fuente con un destino con una profundidad y devuelve el índice de la ruta, o -1 cuando las maxRoutes están en uso.
+    int connect(int source, int destination, float depth);
+
+    // EN: Sets the depth of a route.
+    // ES: Establece la profundidad de una ruta.
+    void setDepth(int route, float depth);
+
+    // EN: Renders every source once and builds every destination buffer for the block. The input buffer is only read,
+    //     by the envelope followers, and sets the block length.
+    // ES: Genera cada fuente una vez y construye cada buffer de destino para el bloque. El buffer de entrada solo se lee,
+    //     por los seguidores de envolvente, y fija la longitud del bloque.
+    void process(const juce::AudioBuffer<float>& input);
+
+    // EN: Returns the values of a source or a destination for the last processed block.
+    // ES: Devuelve los valores de una fuente o de un destino para el último bloque procesado.
+    const float* getSourceBuffer(int source) const;
+    const float* getDestinationBuffer(int destination) const;
+
+    static constexpr int maxSources = 8;
+    static constexpr int maxDestinations = 16;
+    static constexpr int maxRoutes = 32;
+
+private:
+    struct Source
+    {
+        SourceType type{ SourceType::Lfo };
+        float frequency{ 1.0f };
+        float phase{ 0.0f };
+        float phaseIncrement{ 0.0f };
+        float attackTime{ 0.01f };
+        float releaseTime{ 0.1f };
+        float attackCoeff{ 0.0f };
+        float releaseCoeff{ 0.0f };
+        float level{ 0.0f };
+        ControlRateRamp ramp;
+    };
+
+    struct Route
+    {
+        int source{ 0 };
+        int destination{ 0 };
+        float depth{ 0.0f };
+    };
+
+    // EN: Recomputes the phase increment or the follower coefficients of a source from the sample rate.
+    // ES: Recalcula el incremento de fase o los coeficientes del seguidor de una fuente a partir de la frecuencia de muestreo.
+    void updateSource(int source);
+
+    // EN: Value of an Lfo or MorphLfo source at a phase.
+    // ES: Valor de una fuente Lfo o MorphLfo en una fase.
+    float oscillatorValue(int source, float phase) const;
+
+    // EN: Writes numSamples values of a source to output.
+    // ES: Escribe numSamples valores de una fuente en output.
+    void renderSource(int source, const juce::AudioBuffer<float>& input, float* output, int numSamples);
+
+    double sampleRate{ 44100.0 };
+    int maxBlockSize{ 0 };
+    int controlInterval{ 1 };
+
+    std::array<Source, maxSources> sources{};
+    std::array<MorphShapeTable, maxSources> shapeTables{};
+    std::array<Envelope, maxSources> envelopes{};
+    int numSources{ 0 };
+
+    std::array<float, maxDestinations> baseValues{};
+    int numDestinations{ 0 };
+
+    std::array<Route, maxRoutes> routes{};
+    int numRoutes{ 0 };
+
+    // EN: Block buffers, maxBlockSize values per source and per destination one after another, plus a scratch row
+    //     for the follower.
+    // ES: Buffers de bloque, maxBlockSize valores por fuente y por destino uno tras otro, más una fila auxiliar para
+    //     el seguidor.
+    std::vector<float> sourceBuffers;
+    std::vector<float> destinationBuffers;
+    std::vector<float> scratch;
+};
@@ -15,6 +15,7 @@
 void MorphLfo::setShape(float inShapeValue)
 {
     shapeValue = inShapeValue;
+    shapeTable.setShape(shapeValue); // Calcula la curva fuera del bucle de audio.
 }
 
 // ES: Configura el valor de la profundidad (depth) del LFO.
@@ -28,7 +29,8 @@ void MorphLfo::setDepth(float inDepthValue)
 // EN: Sets the frequency of the LFO in Hz.
 void MorphLfo::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+    phaseIncrement = frequency / sampleRate;
 }
 
 // ES: Inicializa los par�metros internos del LFO en base a la frecuencia de muestreo proporcionada.
@@ -37,64 +39,47 @@ void MorphLfo::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate); // Almacena la frecuencia de muestreo.
 
-    for (int i = 0; i < 2; i++) // Configura las variables de tiempo y sus incrementos para cada canal.
-    {
-        time[i] = 0.0f;                   // Inicializa el tiempo a 0 para cada canal.
-        deltaTime[i] = 1.0f / sampleRate; // Calcula el incremento temporal por muestra.
-    }
+    phaseIncrement = frequency / sampleRate; // Calcula el incremento de fase por muestra.
+    phase = 0.5f;                            // La diente de sierra base empieza en la mitad del ciclo (en 0).
 }
 
 // ES: Aplica el LFO a un buffer de audio.
 // EN: Applies the LFO to an audio buffer.
 void MorphLfo::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // Recorre todos los canales.
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // ES: La amplitud y el desplazamiento solo dependen de la profundidad, así se calculan una vez por bloque.
+    // EN: The amplitude and offset only depend on the depth, so they are computed once per block.
+    const float amplitud = 0.5f * (depthValue / 100.0f);
+    const float offset = 1.0f - amplitud;
+
+    // ES: Toma la última forma calculada, así todo el bloque usa la misma curva.
+    // EN: Takes the last baked shape, so the whole block uses one curve.
+    shapeTable.pullPendingShape();
+
+    for (int start = 0; start < numSamples; start += chunkSize)
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++) // Recorre todas las muestras del canal actual.
+        const int n = juce::jmin(chunkSize, numSamples - start);
+
+        // ES: El LFO es el mismo para todos los canales, así se calcula una vez por tramo: acumula la fase, lee la
+        //     curva de la tabla y la escala con la amplitud y el desplazamiento.
+        // EN: The LFO is the same for every channel, so it is computed once per chunk: accumulate the phase, read the
+        //     curve from the table and scale it with the amplitude and offset.
+        for (int i = 0; i < n; i++)
         {
-            float inSample = buffer.getSample(channel, i); // Obtiene la muestra actual.
-            float amplitud = 0.5f * (depthValue / 100.0f); // Calcula la amplitud del LFO seg�n el valor de profundidad.
-            float offset = 1.0f - amplitud;                // Calcula el desplazamiento necesario.
-
-            // ES: Genera la forma de onda base del LFO (diente de sierra).
-            // EN: Generates the base waveform of the LFO (sawtooth wave).
-            float lfo = (2.0f * std::fmod(frequency * time[i] + 0.5f, 1.0f) - 1.0f);
-
-            float newLfo = 0.0f; // Valor modificado del LFO.
-            float outSample = 0.0f; // Valor de la muestra procesada.
-
-            // ES: Modifica la forma de onda del LFO seg�n el par�metro de shape.
-            // EN: Adjusts the LFO waveform based on the shape parameter.
-            if (lfo >= 0)
-            {
-                newLfo = std::pow(lfo, 1.0f / shapeValue);
-            }
-            else
-            {
-                newLfo = -std::pow(std::abs(lfo), 1.0f / shapeValue);
-            }
-
-            // ES: Combina la amplitud y el desplazamiento para calcular la modulaci�n final.
-            // EN: Combines amplitude and offset to calculate the final modulation.
-            float mod = (amplitud * newLfo) + offset;
-
-            // ES: Aplica la modulaci�n a la muestra original.
-            // EN: Applies the modulation to the original sample.
-            outSample = mod * inSample;
-
-            // ES: Guarda la muestra procesada en el buffer.
-            // EN: Stores the processed sample in the buffer.
-            buffer.setSample(channel, i, outSample);
-
-            // ES: Incrementa el tiempo para el canal actual.
-            // EN: Increments the time for the current channel.
-            time[channel] += deltaTime[channel];
-
-            // ES: Reinicia el tiempo si excede 1 (una oscilaci�n completa).
-            // EN: Resets the time if it exceeds 1 (a full oscillation).
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
+            modulation[static_cast<size_t>(i)] = amplitud * shapeTable.getValue(phase) + offset;
+
+            phase += phaseIncrement;
+            if (phase >= 1.0f)
+                phase -= 1.0f;
         }
+
+        // ES: Aplica la modulación a las muestras originales de cada canal.
+        // EN: Applies the modulation to the original samples of each channel.
+        for (int channel = 0; channel < numChannels; channel++)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, start), modulation.data(), n);
     }
 }
 
@@ -102,6 +87,7 @@ void MorphLfo::process(juce::AudioBuffer<float>& buffer)
 // EN: Constructor: Initializes the MorphLfo object.
 MorphLfo::MorphLfo()
 {
+    shapeTable.setShape(shapeValue);
 }
 
 // ES: Destructor: Libera recursos si es necesario.
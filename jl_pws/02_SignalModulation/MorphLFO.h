@@ -10,6 +10,7 @@
 
 #pragma once
 //#include <JuceHeader.h>
+#include <array>
 
 class MorphLfo
 {
@@ -51,8 +52,17 @@ private:
                                // EN: LFO depth (range: 0-100%).
     float sampleRate{ 44100 }; // ES: Frecuencia de muestreo actual (Hz).
                                // EN: Current sample rate (Hz).
-    float time[2]{};           // ES: Variables de tiempo independientes para cada canal.
-                               // EN: Independent time variables for each channel.
-    float deltaTime[2]{};      // ES: Incrementos de tiempo por muestra para cada canal.
-                               // EN: Time increments per sample for each channel.
+    float phase{ 0.5f };       // ES: Fase de la diente de sierra base en ciclos (0 a 1), compartida por los canales.
+                               // EN: Phase of the base sawtooth in cycles (0 to 1), shared by the channels.
+    float phaseIncrement{ 0.0f }; // ES: Incremento de fase por muestra, en ciclos.
+                                  // EN: Phase increment per sample, in cycles.
+
+    // ES: Curva de la forma calculada en una tabla cuando cambia shapeValue.
+    // EN: Shape curve baked into a table when shapeValue changes.
+    MorphShapeTable shapeTable;
+
+    // ES: El LFO se calcula por tramos de chunkSize muestras en modulation y se aplica a todos los canales.
+    // EN: The LFO is computed in chunks of chunkSize samples into modulation and applied to every channel.
+    static constexpr int chunkSize = 64;
+    std::array<float, chunkSize> modulation{};
 };
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    MorphShapeTable.cpp
+    Created: 19 Oct 2026 3:40:59am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "MorphShapeTable.h"
+
+// EN: Constructor of MorphShapeTable class (bakes a straight sawtooth).
+// ES: Constructor de la clase MorphShapeTable (calcula una diente de sierra recta).
+MorphShapeTable::MorphShapeTable()
+{
+    bake(curves[static_cast<size_t>(liveIndex)], bakedShape);
+}
+
+// EN: Destructor of MorphShapeTable class.
+// ES: Destructor de la clase MorphShapeTable.
+MorphShapeTable::~MorphShapeTable()
+{
+}
+
+// EN: Evaluates the same expression the per-sample code used, so a shape of 0 (an infinite exponent) still gives
+//     silence with a step to +-1 at the ends. The error of a cell is largest at its middle, and |x|^exponent bends
+//     most at x = 0 (exponent below 1) or at x = +-1 (exponent above 2), with the error shrinking monotonically
+//     away from there. So the exact cells run from the center outward and from the ends inward, each up to the
+//     first cell whose middle is within tolerance; the curve is odd, so one half covers both sides.
+// ES: Evalúa la misma expresión que usaba el código por muestra, así una forma de 0 (un exponente infinito) sigue
+//     dando silencio con un salto a +-1 en los extremos. El error de una celda es mayor en su centro, y |x|^exponente
+//     se curva más en x = 0 (exponente menor que 1) o en x = +-1 (exponente mayor que 2), y el error disminuye de
+//     forma monótona al alejarse. Así las celdas exactas van desde el centro hacia fuera y desde los extremos hacia
+//     dentro, cada una hasta la primera celda cuyo centro queda dentro de tolerance; la curva es impar, así una
+//     mitad cubre ambos lados.
+void MorphShapeTable::bake(Curve& curve, float inShapeValue)
+{
+    curve.exponent = 1.0f / inShapeValue;
+
+    for (int i = 0; i <= tableSize; i++)
+        curve.table[static_cast<size_t>(i)] = shape(2.0f * static_cast<float>(i) / static_cast<float>(tableSize) - 1.0f, curve.exponent);
+
+    const int center = tableSize / 2;
+    curve.exactCells = 0;
+
+    for (int cell = 0; cell < center; cell++)
+    {
+        const float middle = (2.0f * static_cast<float>(cell) + 1.0f) / static_cast<float>(tableSize);
+        const float interpolated = 0.5f * (curve.table[static_cast<size_t>(center + cell)] + curve.table[static_cast<size_t>(center + cell + 1)]);
+
+        if (std::abs(shape(middle, curve.exponent) - interpolated) <= tolerance)
+            break;
+
+        curve.exactCells = cell + 1;
+    }
+
+    curve.exactEndCells = 0;
+
+    for (int cell = 0; cell < center - curve.exactCells; cell++)
+    {
+        const float middle = 1.0f - (2.0f * static_cast<float>(cell) + 1.0f) / static_cast<float>(tableSize);
+        const float interpolated = 0.5f * (curve.table[static_cast<size_t>(tableSize - cell - 1)] + curve.table[static_cast<size_t>(tableSize - cell)]);
+
+        if (std::abs(shape(middle, curve.exponent) - interpolated) <= tolerance)
+            break;
+
+        curve.exactEndCells = cell + 1;
+    }
+}
+
+// EN: The new curve is baked into the back table, which no one else reads, and swapped with the handed-over one.
+//     The table that comes back is either one the audio thread has left or an older curve it never took.
+// ES: La nueva curva se calcula en la tabla trasera, que nadie más lee, y se intercambia con la entregada. La tabla
+//     que vuelve es una que el hilo de audio ya dejó o una curva anterior que nunca tomó.
+void MorphShapeTable::setShape(float inShapeValue)
+{
+    if (inShapeValue == bakedShape)
+        return;
+
+    bakedShape = inShapeValue;
+    bake(curves[static_cast<size_t>(backIndex)], inShapeValue);
+
+    backIndex = pendingIndex.exchange(backIndex | newCurveFlag, std::memory_order_acq_rel) & ~newCurveFlag;
+}
+
+// EN: Takes the handed-over curve and leaves the old live one in its place.
+// ES: Toma la curva entregada y deja la antigua en su lugar.
+void MorphShapeTable::pullPendingShape()
+{
+    if ((pendingIndex.load(std::memory_order_relaxed) & newCurveFlag) == 0)
+        return;
+
+    liveIndex = pendingIndex.exchange(liveIndex, std::memory_order_acq_rel) & ~newCurveFlag;
+}
+
+// EN: Linear interpolation between the two table points around the phase, or the exact curve near x = 0 and x = +-1.
+//     distance is the distance from the middle of the cell to x = 0 in half cells.
+// ES: Interpolación lineal entre los dos puntos de la tabla alrededor de la fase, o la curva exacta cerca de x = 0 y
+//     x = +-1. distance es la distancia del centro de la celda a x = 0 en medias celdas.
+float MorphShapeTable::getValue(float phase) const
+{
+    const Curve& curve = curves[static_cast<size_t>(liveIndex)];
+    const float position = phase * static_cast<float>(tableSize);
+    const int index = juce::jlimit(0, tableSize - 1, static_cast<int>(position));
+    const int distance = std::abs(2 * index + 1 - tableSize);
+
+    if (distance < 2 * curve.exactCells || distance > tableSize - 1 - 2 * curve.exactEndCells)
+        return shape(2.0f * phase - 1.0f, curve.exponent);
+
+    const float fraction = position - static_cast<float>(index);
+
+    const float a = curve.table[static_cast<size_t>(index)];
+    const float b = curve.table[static_cast<size_t>(index + 1)];
+
+    return a + fraction * (b - a);
+}
+
+// EN: sign(x) * |x|^exponent.
+// ES: signo(x) * |x|^exponente.
+float MorphShapeTable::shape(float x, float exponent)
+{
+    const float value = std::pow(std::abs(x), exponent);
+    return x >= 0.0f ? value : -value;
+}
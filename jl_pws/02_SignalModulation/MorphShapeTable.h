@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    MorphShapeTable.h
+    Created: 19 Oct 2026 3:40:59am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+
+// EN: MorphShapeTable holds the morphing curve of MorphLfo and MorphWave: a sawtooth x = 2 * phase - 1 bent by
+//     sign(x) * |x|^(1 / shape). The curve is baked into a table whenever the shape changes, so the audio loop
+//     reads it with linear interpolation instead of calling std::pow every sample. For large shapes the curve is
+//     almost vertical next to x = 0, and for small shapes next to x = +-1, where a straight line between table
+//     points is not accurate enough; the few cells there whose error is above tolerance are found when the table
+//     is baked and are computed exactly.
+//     There are three curves: the one the audio thread reads, the one setShape bakes into, and the one handed
+//     between them through an atomic index. The audio thread never sees a curve that is being written, and it
+//     switches only at the start of a block, so a block never mixes two shapes.
+// ES: MorphShapeTable guarda la curva de transformación de MorphLfo y MorphWave: una diente de sierra
+//     x = 2 * fase - 1 doblada por signo(x) * |x|^(1 / shape). La curva se calcula en una tabla cada vez que cambia
+//     la forma, así el bucle de audio la lee con interpolación lineal en lugar de llamar a std::pow en cada
+//     muestra. Con formas grandes la curva es casi vertical junto a x = 0, y con formas pequeñas junto a x = +-1,
+//     donde una recta entre puntos de la tabla no es lo bastante precisa; las pocas celdas de esas zonas cuyo error
+//     supera tolerance se buscan al calcular la tabla y se calculan de forma exacta.
+//     Hay tres curvas: la que lee el hilo de audio, la que calcula setShape y la que se pasan entre ambos mediante
+//     un índice atómico. El hilo de audio nunca ve una curva que se está escribiendo, y solo cambia al principio de
+//     un bloque, así un bloque nunca mezcla dos formas.
+class MorphShapeTable
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    MorphShapeTable();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~MorphShapeTable();
+
+    // EN: Bakes the curve for a shape value into a spare table and publishes it; it does nothing when the shape has
+    //     not changed. Call it from one thread at a time, preferably the message thread.
+    // ES: Calcula la curva para un valor de forma en una tabla libre y la publica; no hace nada si la forma no ha
+    //     cambiado. Se debe llamar desde un solo hilo a la vez, preferiblemente el hilo de mensajes.
+    void setShape(float inShapeValue);
+
+    // EN: Switches to the last published curve, if there is a new one. Call it from the audio thread at the start
+    //     of each block.
+    // ES: Cambia a la última curva publicada, si hay una nueva. Se debe llamar desde el hilo de audio al principio
+    //     de cada bloque.
+    void pullPendingShape();
+
+    // EN: Returns the shaped sawtooth at a phase (0 to 1).
+    // ES: Devuelve la diente de sierra transformada en una fase (0 a 1).
+    float getValue(float phase) const;
+
+    static constexpr int tableSize = 2048;
+    static constexpr float tolerance = 1.0e-4f;
+
+private:
+    struct Curve
+    {
+        // EN: Curve values at tableSize + 1 points from x = -1 to x = 1; the last point lets the interpolation
+        //     read one point past the end.
+        // ES: Valores de la curva en tableSize + 1 puntos desde x = -1 hasta x = 1; el último punto permite que la
+        //     interpolación lea un punto más allá del final.
+        std::array<float, tableSize + 1> table{};
+
+        // EN: Exponent of the curve, and the number of cells on each side of x = 0 and inside each end that are
+        //     computed exactly.
+        // ES: Exponente de la curva, y el número de celdas a cada lado de x = 0 y dentro de cada extremo que se
+        //     calculan de forma exacta.
+        float exponent{ 1.0f };
+        int exactCells{ 0 };
+        int exactEndCells{ 0 };
+    };
+
+    // EN: Bakes the curve of a shape value.
+    // ES: Calcula la curva de un valor de forma.
+    static void bake(Curve& curve, float inShapeValue);
+
+    // EN: Exact value of the curve at x (-1 to 1).
+    // ES: Valor exacto de la curva en x (-1 a 1).
+    static float shape(float x, float exponent);
+
+    // EN: Marks the handed-over index as a curve the audio thread has not taken yet.
+    // ES: Marca el índice intercambiado como una curva que el hilo de audio aún no ha tomado.
+    static constexpr int newCurveFlag = 4;
+
+    std::array<Curve, 3> curves{};
+    int liveIndex{ 0 };                 // EN: Read by the audio thread. | ES: Leída por el hilo de audio.
+    int backIndex{ 1 };                 // EN: Baked by setShape. | ES: Calculada por setShape.
+    std::atomic<int> pendingIndex{ 2 }; // EN: Handed between them. | ES: Intercambiada entre ambos.
+    float bakedShape{ 1.0f };
+};
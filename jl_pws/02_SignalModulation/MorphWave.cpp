@@ -17,13 +17,26 @@
 void MorphWave::setShape(float inShapeValue)
 {
     shapeValue = inShapeValue;
+    shapeTable.setShape(shapeValue); // Calcula la curva fuera del bucle de audio.
 }
 
 // ES: Configura la frecuencia del oscilador en Hz.
 // EN: Sets the oscillator frequency in Hz.
 void MorphWave::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+    phaseIncrement = frequency / sampleRate;
+}
+
+// ES: Mueve la fase de un canal según el cambio de su desfase, así el desfase puede cambiar mientras suena.
+// EN: Moves the phase of one channel by the change of its offset, so the offset can change while it plays.
+void MorphWave::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+    const float value = phase[index] + inPhaseOffset - phaseOffset[index];
+
+    phase[index] = value - std::floor(value);
+    phaseOffset[index] = inPhaseOffset;
 }
 
 // ES: Inicializa los par�metros del oscilador en funci�n de la frecuencia de muestreo proporcionada.
@@ -32,10 +45,12 @@ void MorphWave::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate); // Almacena la frecuencia de muestreo como un valor de coma flotante.
 
-    for (int i = 0; i < 2; i++) // Inicializa los valores de tiempo y sus incrementos para cada canal.
+    phaseIncrement = frequency / sampleRate; // Calcula el incremento de fase por muestra.
+
+    for (int i = 0; i < 2; i++) // Reinicia la fase de cada canal: la diente de sierra base empieza en la mitad del ciclo (en 0).
     {
-        time[i] = 0.0f;                   // Inicializa el tiempo a 0 para el canal actual.
-        deltaTime[i] = 1.0f / sampleRate; // Calcula el incremento de tiempo por muestra.
+        const float value = 0.5f + phaseOffset[i];
+        phase[i] = value - std::floor(value);
     }
 }
 
@@ -43,54 +58,56 @@ void MorphWave::prepare(double theSampleRate)
 // EN: Generates a modulated waveform and writes it to the audio buffer.
 void MorphWave::process(juce::AudioBuffer<float>& buffer)
 {
-    // Recorre todos los canales del buffer de audio.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // ES: El segundo canal solo necesita su propia pasada cuando su desfase es distinto del primero.
+    // EN: The second channel only needs its own pass when its phase offset differs from the first one.
+    const bool spread = numChannels > 1 && phaseOffset[1] != phaseOffset[0];
+    const int numRendered = spread ? 2 : juce::jmin(numChannels, 1);
+
+    // ES: Toma la última forma calculada, así todo el bloque usa la misma curva.
+    // EN: Takes the last baked shape, so the whole block uses one curve.
+    shapeTable.pullPendingShape();
+
+    // Recorre los canales que se generan.
+    for (int channel = 0; channel < numRendered; channel++)
     {
+        float* output = buffer.getWritePointer(channel);
+
         // Procesa todas las muestras del canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        for (int i = 0; i < numSamples; i++)
         {
-            // ES: Genera una onda de diente de sierra como base.
-            // EN: Generates a sawtooth wave as the base waveform.
-            float osc = (2.0f * std::fmod(frequency * time[i] + 0.5f, 1.0f) - 1.0f);
-
-            float newWave = 0.0f; // Almacena la forma de onda modificada.
-            float outSample = 0.0f; // Almacena la muestra de salida.
-
-            // ES: Ajusta la forma de la onda seg�n el valor de shapeValue.
-            // EN: Adjusts the waveform shape based on the shapeValue parameter.
-            if (osc >= 0)
-            {
-                newWave = std::pow(osc, 1.0f / shapeValue);
-            }
-            else
-            {
-                newWave = -std::pow(std::abs(osc), 1.0f / shapeValue);
-            }
-
-            // ES: La muestra de salida es simplemente la forma de onda modificada.
-            // EN: The output sample is simply the modified waveform.
-            outSample = newWave;
+            // ES: Lee la diente de sierra transformada según shapeValue desde la tabla, en lugar de calcular std::pow.
+            // EN: Reads the sawtooth bent by shapeValue from the table, instead of computing std::pow.
+            const float newWave = shapeTable.getValue(phase[channel]);
 
             // ES: Escribe la muestra procesada en el buffer.
             // EN: Writes the processed sample to the buffer.
-            buffer.setSample(channel, i, outSample);
+            output[i] = newWave;
 
-            // ES: Incrementa el tiempo del canal actual.
-            // EN: Increments the time for the current channel.
-            time[channel] += deltaTime[channel];
-
-            // ES: Reinicia el tiempo si excede 1 (un ciclo completo).
-            // EN: Resets the time if it exceeds 1 (a full cycle).
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
+            // ES: Avanza la fase del canal actual y la reinicia al completar un ciclo.
+            // EN: Advances the phase of the current channel and wraps it at the end of a cycle.
+            phase[channel] += phaseIncrement;
+            if (phase[channel] >= 1.0f)
+                phase[channel] -= 1.0f;
         }
     }
+
+    // ES: Un canal que no se generó sigue la fase del primero y los canales restantes son copias.
+    // EN: A channel that was not rendered follows the phase of the first one and the remaining channels are copies.
+    if (!spread)
+        phase[1] = phase[0];
+
+    for (int channel = numRendered; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
 }
 
 // ES: Constructor: Inicializa el objeto MorphWave.
 // EN: Constructor: Initializes the MorphWave object.
 MorphWave::MorphWave()
 {
+    shapeTable.setShape(shapeValue);
 }
 
 // ES: Destructor: Libera recursos si fuera necesario.
@@ -23,6 +23,10 @@ public:
     // EN: Sets the frequency of the waveform.
     void setFrequency(double inFrequency);
 
+    // Establece el desfase de un canal (0 o 1) en ciclos; los canales con el mismo desfase se generan una vez y se copian.
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles; channels with the same offset are rendered once and copied.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // Inicializa los par�metros del MorphWave con la frecuencia de muestreo.
     // EN: Initializes the MorphWave parameters with the sample rate.
     void prepare(double theSampleRate);
@@ -52,11 +56,19 @@ private:
     // EN: The sample rate of the system, default is 44100 Hz.
     float sampleRate{ 44100 };
 
-    // Array para almacenar el tiempo de cada canal (en dos canales por defecto).
-    // EN: Array to store time for each channel (default two channels).
-    float time[2]{};
+    // Incremento de fase por muestra, en ciclos.
+    // EN: Phase increment per sample, in cycles.
+    float phaseIncrement{ 0.0f };
+
+    // Fase de cada canal en ciclos (0 a 1), incluido su desfase.
+    // EN: Phase of each channel in cycles (0 to 1), including its offset.
+    float phase[2]{};
+
+    // Desfase de cada canal en ciclos.
+    // EN: Phase offset of each channel in cycles.
+    float phaseOffset[2]{};
 
-    // Array que contiene los incrementos de tiempo por muestra para cada canal.
-    // EN: Array containing time deltas for each sample in each channel.
-    float deltaTime[2]{};
+    // Curva de la forma calculada en una tabla cuando cambia shapeValue.
+    // EN: Shape curve baked into a table when shapeValue changes.
+    MorphShapeTable shapeTable;
 };
\ No newline at end of file
@@ -51,31 +51,40 @@ void RingModulation::prepare(double theSampleRate)
 // ES: Procesa el b�fer de audio y aplica el efecto de modulaci�n en anillo.
 void RingModulation::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // Loop through each audio channel.
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    if (numChannels == 0)
+        return;
+
+    // EN: Every channel gets the same signal, so it is computed once into the first channel.
+    // ES: Todos los canales reciben la misma señal, así se calcula una vez en el primer canal.
+    float* output = buffer.getWritePointer(0);
+    const float gain = amp1 * amp2;
+
+    for (int i = 0; i < numSamples; i++) // Loop through each audio sample.
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++) // Loop through each audio sample.
-        {
-            // EN: Calculate the output of the sine wave using the current phase values.
-            // ES: Calculamos la salida de la onda senoidal usando los valores actuales de la fase.
-            float outSample = (amp1 * sinf(phase1[channel])) * (amp2 * sinf(phase2[channel]));
-
-            // EN: Store the calculated sample in the buffer.
-            // ES: Guardamos la muestra calculada en el b�fer.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Update the phase of the first oscillator and keep it within the range [0, 2PI].
-            // ES: Actualizamos la fase del primer oscilador y la mantenemos dentro del rango [0, 2PI].
-            phase1[channel] += phaseIncrement1;
-            if (phase1[channel] >= twoPi)
-                phase1[channel] -= twoPi;
-
-            // EN: Update the phase of the second oscillator and keep it within the range [0, 2PI].
-            // ES: Actualizamos la fase del segundo oscilador y la mantenemos dentro del rango [0, 2PI].
-            phase2[channel] += phaseIncrement2;
-            if (phase2[channel] >= twoPi)
-                phase2[channel] -= twoPi;
-        }
+        // EN: Calculate the output of the sine wave using the current phase values.
+        // ES: Calculamos la salida de la onda senoidal usando los valores actuales de la fase.
+        output[i] = gain * sinf(phase1) * sinf(phase2);
+
+        // EN: Update the phase of the first oscillator and keep it within the range [0, 2PI].
+        // ES: Actualizamos la fase del primer oscilador y la mantenemos dentro del rango [0, 2PI].
+        phase1 += phaseIncrement1;
+        if (phase1 >= twoPi)
+            phase1 -= twoPi;
+
+        // EN: Update the phase of the second oscillator and keep it within the range [0, 2PI].
+        // ES: Actualizamos la fase del segundo oscilador y la mantenemos dentro del rango [0, 2PI].
+        phase2 += phaseIncrement2;
+        if (phase2 >= twoPi)
+            phase2 -= twoPi;
     }
+
+    // EN: Copy the first channel to the others.
+    // ES: Copia el primer canal a los demás.
+    for (int channel = 1; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
 }
 
 // EN: Constructor for the RingModulation class.
@@ -79,11 +79,11 @@ private:
     // ES: Incremento de fase para el segundo oscilador.
     float phaseIncrement2{};
 
-    // EN: Phase values for the first oscillator (per channel).
-    // ES: Valores de fase para el primer oscilador (por canal).
-    float phase1[2]{};
+    // EN: Phase of the first oscillator, shared by the channels.
+    // ES: Fase del primer oscilador, compartida por los canales.
+    float phase1{};
 
-    // EN: Phase values for the second oscillator (per channel).
-    // ES: Valores de fase para el segundo oscilador (por canal).
-    float phase2[2]{};
+    // EN: Phase of the second oscillator, shared by the channels.
+    // ES: Fase del segundo oscilador, compartida por los canales.
+    float phase2{};
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    DelayLineBlock.cpp
+    Created: 19 Oct 2026 3:02:29am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "DelayLineBlock.h"
+
+// EN: delay >= numSamples keeps the reads in the past, delay + numSamples <= size keeps them away from the writes.
+// ES: delay >= numSamples mantiene las lecturas en el pasado, delay + numSamples <= size las aleja de las escrituras.
+bool DelayLineBlock::canProcessBlock(int delaySamples, int numSamples, int bufferSize)
+{
+    return delaySamples >= numSamples && delaySamples + numSamples <= bufferSize;
+}
+
+// EN: Positions are never more than one buffer away, so a single correction is enough.
+// ES: Las posiciones nunca están a más de un buffer de distancia, así que basta una sola corrección.
+int DelayLineBlock::wrap(int position, int bufferSize)
+{
+    if (position < 0)
+        return position + bufferSize;
+
+    if (position >= bufferSize)
+        return position - bufferSize;
+
+    return position;
+}
+
+// EN: First segment up to the end of the buffer, second segment from the start.
+// ES: Primer segmento hasta el final del buffer, segundo segmento desde el inicio.
+void DelayLineBlock::write(float* circularBuffer, int bufferSize, int writePosition, const float* source, int numSamples)
+{
+    const int firstPart = juce::jmin(numSamples, bufferSize - writePosition);
+
+    juce::FloatVectorOperations::copy(circularBuffer + writePosition, source, firstPart);
+
+    if (firstPart < numSamples)
+        juce::FloatVectorOperations::copy(circularBuffer, source + firstPart, numSamples - firstPart);
+}
+
+// EN: Same split as write, on the read side.
+// ES: La misma división que write, en el lado de lectura.
+void DelayLineBlock::addWithMultiply(float* destination, const float* circularBuffer, int bufferSize, int readPosition, float gain, int numSamples)
+{
+    const int firstPart = juce::jmin(numSamples, bufferSize - readPosition);
+
+    juce::FloatVectorOperations::addWithMultiply(destination, circularBuffer + readPosition, gain, firstPart);
+
+    if (firstPart < numSamples)
+        juce::FloatVectorOperations::addWithMultiply(destination + firstPart, circularBuffer, gain, numSamples - firstPart);
+}
@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    DelayLineBlock.h
+    Created: 19 Oct 2026 3:02:29am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+
+// EN: Block helpers for the circular buffers of the echo classes. When the delay is at least one block long,
+//     the samples read during the block were all written before it, so the block can be read and written as
+//     contiguous spans (at most two segments each, split where the circular buffer wraps) with
+//     FloatVectorOperations instead of one sample at a time with a wrap check per sample.
+// ES: Funciones por bloque para los buffers circulares de las clases de eco. Cuando el retardo dura al menos un
+//     bloque, las muestras leídas durante el bloque se escribieron todas antes, así que el bloque puede leerse y
+//     escribirse como tramos contiguos (como mucho dos segmentos cada uno, divididos donde el buffer circular da
+//     la vuelta) con FloatVectorOperations en vez de muestra a muestra con una comprobación de vuelta por muestra.
+struct DelayLineBlock
+{
+    // EN: True when a block of numSamples can use the span path: every read lands on samples written before the
+    //     block, and the read span never reaches the write span.
+    // ES: Verdadero cuando un bloque de numSamples puede usar el camino por tramos: cada lectura cae sobre muestras
+    //     escritas antes del bloque, y el tramo de lectura nunca alcanza al de escritura.
+    static bool canProcessBlock(int delaySamples, int numSamples, int bufferSize);
+
+    // EN: Wraps any position (also negative ones) into [0, bufferSize).
+    // ES: Envuelve cualquier posición (también negativas) en [0, bufferSize).
+    static int wrap(int position, int bufferSize);
+
+    // EN: Copies numSamples from source into the circular buffer starting at writePosition.
+    // ES: Copia numSamples desde source al buffer circular empezando en writePosition.
+    static void write(float* circularBuffer, int bufferSize, int writePosition, const float* source, int numSamples);
+
+    // EN: destination[i] += gain * circularBuffer[readPosition + i] for numSamples samples.
+    // ES: destination[i] += gain * circularBuffer[readPosition + i] para numSamples muestras.
+    static void addWithMultiply(float* destination, const float* circularBuffer, int bufferSize, int readPosition, float gain, int numSamples);
+};
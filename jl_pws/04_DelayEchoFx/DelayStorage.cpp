@@ -0,0 +1,329 @@
+/*
+  ==============================================================================
+
+    DelayStorage.cpp
+    Created: 19 Oct 2026 3:09:28am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "DelayStorage.h"
+
+// EN: Constructor of DelayStorage class.
+// ES: Constructor de la clase DelayStorage.
+DelayStorage::DelayStorage()
+{
+}
+
+// EN: Destructor of DelayStorage class.
+// ES: Destructor de la clase DelayStorage.
+DelayStorage::~DelayStorage()
+{
+}
+
+// EN: Releases the vectors of the other formats and allocates the current one.
+// ES: Libera los vectores de los otros formatos y reserva el actual.
+void DelayStorage::allocate(int inNumChannels, int inBufferSize)
+{
+    numChannels = juce::jmax(0, inNumChannels);
+    bufferSize = juce::jmax(0, inBufferSize);
+
+    const size_t totalSize = static_cast<size_t>(numChannels) * static_cast<size_t>(bufferSize);
+
+    floatData.clear();
+    intData.clear();
+    halfData.clear();
+
+    floatData.shrink_to_fit();
+    intData.shrink_to_fit();
+    halfData.shrink_to_fit();
+
+    if (format == Format::Float32)
+        floatData.assign(totalSize, 0.0f);
+    else if (format == Format::Int16)
+        intData.assign(totalSize, 0);
+    else
+        halfData.assign(totalSize, 0);
+
+    int16Scale.resize(static_cast<size_t>(numChannels), 1.0f);
+}
+
+// EN: Sets the format and reallocates the same lines.
+// ES: Establece el formato y vuelve a reservar las mismas líneas.
+void DelayStorage::setFormat(Format inFormat)
+{
+    if (inFormat == format)
+        return;
+
+    format = inFormat;
+    allocate(numChannels, bufferSize);
+}
+
+// EN: Returns the sample format.
+// ES: Devuelve el formato de muestra.
+DelayStorage::Format DelayStorage::getFormat() const
+{
+    return format;
+}
+
+// EN: Sets the Int16 scale of a line.
+// ES: Establece la escala Int16 de una línea.
+void DelayStorage::setInt16Scale(int channel, float inMaxAmplitude)
+{
+    if (channel < 0 || channel >= numChannels)
+        return;
+
+    int16Scale[static_cast<size_t>(channel)] = juce::jmax(1.0e-6f, inMaxAmplitude);
+}
+
+// EN: Zero is all bits clear in every format.
+// ES: El cero son todos los bits a cero en todos los formatos.
+void DelayStorage::clear()
+{
+    std::fill(floatData.begin(), floatData.end(), 0.0f);
+    std::fill(intData.begin(), intData.end(), static_cast<int16_t>(0));
+    std::fill(halfData.begin(), halfData.end(), static_cast<uint16_t>(0));
+}
+
+// EN: Swaps every member; vectors only exchange their pointers.
+// ES: Intercambia cada miembro; los vectores solo intercambian sus punteros.
+void DelayStorage::swap(DelayStorage& other) noexcept
+{
+    std::swap(format, other.format);
+    std::swap(numChannels, other.numChannels);
+    std::swap(bufferSize, other.bufferSize);
+    floatData.swap(other.floatData);
+    intData.swap(other.intData);
+    halfData.swap(other.halfData);
+    int16Scale.swap(other.int16Scale);
+}
+
+// EN: Returns the number of bytes used by the samples.
+// ES: Devuelve el número de bytes usados por las muestras.
+size_t DelayStorage::getMemoryBytes() const
+{
+    return floatData.size() * sizeof(float) + intData.size() * sizeof(int16_t) + halfData.size() * sizeof(uint16_t);
+}
+
+// EN: First segment up to the end of the line, second segment from the start.
+// ES: Primer segmento hasta el final de la línea, segundo segmento desde el inicio.
+void DelayStorage::write(int channel, int position, const float* source, int numSamples)
+{
+    const int firstPart = juce::jmin(numSamples, bufferSize - position);
+
+    encodeSegment(channel, position, source, firstPart);
+
+    if (firstPart < numSamples)
+        encodeSegment(channel, 0, source + firstPart, numSamples - firstPart);
+}
+
+// EN: Same split as write, on the read side.
+// ES: La misma división que write, en el lado de lectura.
+void DelayStorage::addWithMultiply(float* destination, int channel, int position, float gain, int numSamples) const
+{
+    const int firstPart = juce::jmin(numSamples, bufferSize - position);
+
+    decodeSegment(destination, channel, position, gain, firstPart);
+
+    if (firstPart < numSamples)
+        decodeSegment(destination + firstPart, channel, 0, gain, numSamples - firstPart);
+}
+
+// EN: Reads one sample.
+// ES: Lee una muestra.
+float DelayStorage::getSample(int channel, int position) const
+{
+    float value = 0.0f;
+    decodeSegment(&value, channel, position, 1.0f, 1);
+    return value;
+}
+
+// EN: Writes one sample.
+// ES: Escribe una muestra.
+void DelayStorage::setSample(int channel, int position, float value)
+{
+    encodeSegment(channel, position, &value, 1);
+}
+
+// EN: Int16 clips to [-scale, scale] and rounds half away from zero.
+// ES: Int16 recorta a [-scale, scale] y redondea la mitad alejándose de cero.
+void DelayStorage::encodeSegment(int channel, int offset, const float* source, int numSamples)
+{
+    const size_t start = static_cast<size_t>(channel) * static_cast<size_t>(bufferSize) + static_cast<size_t>(offset);
+
+    switch (format)
+    {
+        case Format::Float32:
+            juce::FloatVectorOperations::copy(floatData.data() + start, source, numSamples);
+            break;
+
+        case Format::Int16:
+        {
+            int16_t* destination = intData.data() + start;
+            const float scale = int16Scale[static_cast<size_t>(channel)];
+            const float toInt = 32767.0f / scale;
+
+            for (int i = 0; i < numSamples; i++)
+            {
+                const float x = juce::jlimit(-scale, scale, source[i]) * toInt;
+                destination[i] = static_cast<int16_t>(x + (x >= 0.0f ? 0.5f : -0.5f));
+            }
+            break;
+        }
+
+        case Format::Half:
+        {
+            uint16_t* destination = halfData.data() + start;
+
+            for (int i = 0; i < numSamples; i++)
+                destination[i] = floatToHalf(source[i]);
+            break;
+        }
+
+        case Format::BFloat16:
+        {
+            uint16_t* destination = halfData.data() + start;
+
+            for (int i = 0; i < numSamples; i++)
+                destination[i] = floatToBFloat16(source[i]);
+            break;
+        }
+    }
+}
+
+// EN: The Int16 scale is folded into the gain, so a read is one multiply-add per sample.
+// ES: La escala Int16 se incluye en la ganancia, así una lectura es una multiplicación-suma por muestra.
+void DelayStorage::decodeSegment(float* destination, int channel, int offset, float gain, int numSamples) const
+{
+    const size_t start = static_cast<size_t>(channel) * static_cast<size_t>(bufferSize) + static_cast<size_t>(offset);
+
+    switch (format)
+    {
+        case Format::Float32:
+            juce::FloatVectorOperations::addWithMultiply(destination, floatData.data() + start, gain, numSamples);
+            break;
+
+        case Format::Int16:
+        {
+            const int16_t* source = intData.data() + start;
+            const float toFloat = gain * int16Scale[static_cast<size_t>(channel)] / 32767.0f;
+
+            for (int i = 0; i < numSamples; i++)
+                destination[i] += toFloat * static_cast<float>(source[i]);
+            break;
+        }
+
+        case Format::Half:
+        {
+            const uint16_t* source = halfData.data() + start;
+
+            for (int i = 0; i < numSamples; i++)
+                destination[i] += gain * halfToFloat(source[i]);
+            break;
+        }
+
+        case Format::BFloat16:
+        {
+            const uint16_t* source = halfData.data() + start;
+
+            for (int i = 0; i < numSamples; i++)
+                destination[i] += gain * bFloat16ToFloat(source[i]);
+            break;
+        }
+    }
+}
+
+// EN: Normal values round the mantissa to 10 bits (adding 0xfff plus the lowest kept bit rounds to even),
+//     small values are turned into subnormals by adding 0.5f, whose exponent lines the mantissa up with the
+//     fp16 subnormal step, and values beyond the fp16 range are clipped to 65504.
+// ES: Los valores normales redondean la mantisa a 10 bits (sumar 0xfff más el bit más bajo que se conserva
+//     redondea al par), los valores pequeños se convierten en subnormales sumando 0.5f, cuyo exponente alinea la
+//     mantisa con el paso subnormal de fp16, y los valores fuera del rango de fp16 se recortan a 65504.
+uint16_t DelayStorage::floatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint16_t result;
+
+    if (bits >= 0x477ff000u) // EN: 65520 and above, infinity and NaN. ES: 65520 o más, infinito y NaN.
+    {
+        result = 0x7bff;
+    }
+    else if (bits < (113u << 23)) // EN: Below the smallest normal fp16. ES: Por debajo del menor fp16 normal.
+    {
+        float magnitude;
+        std::memcpy(&magnitude, &bits, sizeof(bits));
+        magnitude += 0.5f;
+
+        uint32_t shifted;
+        std::memcpy(&shifted, &magnitude, sizeof(shifted));
+        result = static_cast<uint16_t>(shifted - 0x3f000000u);
+    }
+    else
+    {
+        const uint32_t mantissaOdd = (bits >> 13) & 1u;
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + mantissaOdd;
+        result = static_cast<uint16_t>(bits >> 13);
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+// EN: Moves the exponent and mantissa into float position and rebiases the exponent. Subnormals are
+//     normalized by the float unit: rebias one step further and subtract the smallest normal fp16.
+// ES: Mueve el exponente y la mantisa a la posición de float y reajusta el sesgo del exponente. Los subnormales
+//     los normaliza la unidad de float: se reajusta un paso más y se resta el menor fp16 normal.
+float DelayStorage::halfToFloat(uint16_t value)
+{
+    uint32_t bits = static_cast<uint32_t>(value & 0x7fffu) << 13;
+    const uint32_t exponent = bits & (0x7c00u << 13);
+
+    bits += static_cast<uint32_t>(127 - 15) << 23;
+
+    float result;
+
+    if (exponent == (0x7c00u << 13))
+    {
+        bits += static_cast<uint32_t>(128 - 16) << 23;
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+    else if (exponent == 0)
+    {
+        bits += 1u << 23;
+        std::memcpy(&result, &bits, sizeof(result));
+        result -= 6.103515625e-05f;
+    }
+    else
+    {
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+
+    return (value & 0x8000u) != 0 ? -result : result;
+}
+
+// EN: Keeps the top 16 bits, rounding the dropped half to nearest even.
+// ES: Conserva los 16 bits superiores, redondeando la mitad descartada al par más cercano.
+uint16_t DelayStorage::floatToBFloat16(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+// EN: The stored bits are the top half of the float.
+// ES: Los bits guardados son la mitad superior del float.
+float DelayStorage::bFloat16ToFloat(uint16_t value)
+{
+    const uint32_t bits = static_cast<uint32_t>(value) << 16;
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
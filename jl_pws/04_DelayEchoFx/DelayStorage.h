@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    DelayStorage.h
+    Created: 19 Oct 2026 3:09:28am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// EN: DelayStorage is a multichannel circular buffer whose sample format can be chosen, so long delays and
+//     freeze buffers can trade precision for memory. Samples are converted on write and on read, one
+//     contiguous span at a time (at most two segments per block, split where the buffer wraps, like
+//     DelayLineBlock), in plain loops the compiler can vectorize.
+//     Formats and their noise floor:
+//     - Float32:  4 bytes per sample, exact.
+//     - Int16:    2 bytes, fixed point over [-scale, scale] (scale set per line, 1 by default). The error is at
+//                 most scale / 65534, about -96 dB below the scale; louder samples are clipped to the scale.
+//     - Half:     2 bytes, IEEE fp16. Relative error at most 2^-11 (about -66 dB below the signal), values down
+//                 to about 6e-8 (-144 dBFS) are kept as subnormals, the largest value is 65504.
+//     - BFloat16: 2 bytes, the top half of a float. Relative error at most 2^-8 (about -48 dB below the signal)
+//                 with the full float range.
+// ES: DelayStorage es un buffer circular multicanal cuyo formato de muestra se puede elegir, así los retardos
+//     largos y los buffers de congelado pueden cambiar precisión por memoria. Las muestras se convierten al
+//     escribir y al leer, un tramo contiguo cada vez (como mucho dos segmentos por bloque, divididos donde el
+//     buffer da la vuelta, como DelayLineBlock), en bucles simples que el compilador puede vectorizar.
+//     Formatos y su piso de ruido:
+//     - Float32:  4 bytes por muestra, exacto.
+//     - Int16:    2 bytes, punto fijo sobre [-scale, scale] (scale por línea, 1 por defecto). El error es como
+//                 mucho scale / 65534, unos -96 dB por debajo de la escala; las muestras más fuertes se recortan.
+//     - Half:     2 bytes, fp16 IEEE. Error relativo como mucho 2^-11 (unos -66 dB por debajo de la señal), los
+//                 valores hasta unos 6e-8 (-144 dBFS) se guardan como subnormales, el valor más grande es 65504.
+//     - BFloat16: 2 bytes, la mitad superior de un float. Error relativo como mucho 2^-8 (unos -48 dB por debajo
+//                 de la señal) con todo el rango de float.
+class DelayStorage
+{
+public:
+    enum class Format
+    {
+        Float32,
+        Int16,
+        Half,
+        BFloat16
+    };
+
+    // EN: Constructor.
+    // ES: Constructor.
+    DelayStorage();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~DelayStorage();
+
+    // EN: Allocates numChannels lines of bufferSize samples in the current format, cleared.
+    // ES: Reserva numChannels líneas de bufferSize muestras en el formato actual, limpias.
+    void allocate(int inNumChannels, int inBufferSize);
+
+    // EN: Changes the sample format. Reallocates and clears the lines, so call it outside the audio thread.
+    // ES: Cambia el formato de muestra. Vuelve a reservar y limpia las líneas, así que debe llamarse fuera del hilo de audio.
+    void setFormat(Format inFormat);
+
+    // EN: Returns the sample format.
+    // ES: Devuelve el formato de muestra.
+    Format getFormat() const;
+
+    // EN: Sets the largest amplitude a line stores in Int16 format. Ignored by the other formats.
+    // ES: Establece la amplitud más grande que guarda una línea en formato Int16. Los otros formatos lo ignoran.
+    void setInt16Scale(int channel, float inMaxAmplitude);
+
+    // EN: Clears every line.
+    // ES: Limpia todas las líneas.
+    void clear();
+
+    // EN: Exchanges the lines and settings with other without allocating or freeing, so a storage built on another
+    //     thread can be swapped in on the audio thread.
+    // ES: Intercambia las líneas y los ajustes con other sin reservar ni liberar memoria, así un almacenamiento
+    //     construido en otro hilo se puede intercambiar en el hilo de audio.
+    void swap(DelayStorage& other) noexcept;
+
+    // EN: Returns the number of bytes used by the samples.
+    // ES: Devuelve el número de bytes usados por las muestras.
+    size_t getMemoryBytes() const;
+
+    // EN: Copies numSamples from source into a line starting at position, converting to the storage format.
+    // ES: Copia numSamples desde source a una línea empezando en position, convirtiendo al formato de almacenamiento.
+    void write(int channel, int position, const float* source, int numSamples);
+
+    // EN: destination[i] += gain * line[position + i] for numSamples samples, converting from the storage format.
+    // ES: destination[i] += gain * line[position + i] para numSamples muestras, convirtiendo desde el formato de almacenamiento.
+    void addWithMultiply(float* destination, int channel, int position, float gain, int numSamples) const;
+
+    // EN: Reads one sample.
+    // ES: Lee una muestra.
+    float getSample(int channel, int position) const;
+
+    // EN: Writes one sample.
+    // ES: Escribe una muestra.
+    void setSample(int channel, int position, float value);
+
+    // EN: IEEE fp16 and bfloat16 conversions with round to nearest even.
+    // ES: Conversiones de fp16 IEEE y bfloat16 con redondeo al par más cercano.
+    static uint16_t floatToHalf(float value);
+    static float halfToFloat(uint16_t value);
+    static uint16_t floatToBFloat16(float value);
+    static float bFloat16ToFloat(uint16_t value);
+
+private:
+    // EN: Converts one contiguous segment (no wrap) into and out of the storage.
+    // ES: Convierte un segmento contiguo (sin vuelta) hacia y desde el almacenamiento.
+    void encodeSegment(int channel, int offset, const float* source, int numSamples);
+    void decodeSegment(float* destination, int channel, int offset, float gain, int numSamples) const;
+
+    Format format{ Format::Float32 };
+    int numChannels{ 0 };
+    int bufferSize{ 0 };
+
+    // EN: Only the vector of the current format is allocated. Lines are stored one after the other.
+    // ES: Solo se reserva el vector del formato actual. Las líneas se guardan una tras otra.
+    std::vector<float> floatData;
+    std::vector<int16_t> intData;
+    std::vector<uint16_t> halfData;
+
+    // EN: Int16 scale of each line.
+    // ES: Escala Int16 de cada línea.
+    std::vector<float> int16Scale;
+};
@@ -18,8 +18,8 @@ void EchoFBF2::prepare(double theSampleRate, int totalNumChannels)
 
     // EN: Resize the circular buffers to accommodate the specified size and channels.
     // ES: Redimensiona los buffers circulares para ajustarse al tama�o y canales especificados.
-    circularBufferInput.resize(circularBufferSize, std::vector<float>(totalNumChannels, 0.0f));
-    circularBufferOutput.resize(circularBufferSize, std::vector<float>(totalNumChannels, 0.0f));
+    circularBufferInput.resize(totalNumChannels, std::vector<float>(circularBufferSize, 0.0f));
+    circularBufferOutput.resize(totalNumChannels, std::vector<float>(circularBufferSize, 0.0f));
 
     // EN: Initialize the write pointers for each channel.
     // ES: Inicializa los punteros de escritura para cada canal.
@@ -81,8 +81,21 @@ void EchoFBF2::setFeedback(float inFeedback)
 // ES: Procesa el buffer de audio aplicando el efecto de delay con componentes feedback y forward.
 void EchoFBF2::process(juce::AudioBuffer<float>& buffer)
 {
+    const int numSamples = buffer.getNumSamples();
+
     for (int channel = 0; channel < buffer.getNumChannels(); channel++)
     {
+        // EN: Fast path: both delays cover the block, so x[n - dM] and y[n - dW] are read from earlier blocks
+        //     and the whole block is done with vector multiply-adds over contiguous spans.
+        // ES: Camino rápido: ambos retardos cubren el bloque, así que x[n - dM] e y[n - dW] se leen de bloques
+        //     anteriores y todo el bloque se hace con multiplicaciones-sumas vectoriales sobre tramos contiguos.
+        if (DelayLineBlock::canProcessBlock(delayM, numSamples, circularBufferSize)
+            && DelayLineBlock::canProcessBlock(delayW, numSamples, circularBufferSize))
+        {
+            processBlock(buffer.getWritePointer(channel), channel, numSamples);
+            continue;
+        }
+
         for (int i = 0; i < buffer.getNumSamples(); i++)
         {
             if (delayM >= 1 && delayW >= 1) // EN: Only process if delays are valid. ES: Procesa solo si los retardos son v�lidos.
@@ -95,7 +108,7 @@ void EchoFBF2::process(juce::AudioBuffer<float>& buffer)
                 if (readerPointerInput < 0)
                     readerPointerInput += circularBufferSize;
 
-                float delayedSampleInput = circularBufferInput[readerPointerInput][channel];
+                float delayedSampleInput = circularBufferInput[channel][readerPointerInput];
 
                 // EN: Calculate the read pointer for the output delay (y[n - dW]).
                 // ES: Calcula el puntero de lectura para el retardo de salida (y[n - dW]).
@@ -103,7 +116,7 @@ void EchoFBF2::process(juce::AudioBuffer<float>& buffer)
                 if (readerPointerOutput < 0)
                     readerPointerOutput += circularBufferSize;
 
-                float delayedSampleOutput = circularBufferOutput[readerPointerOutput][channel];
+                float delayedSampleOutput = circularBufferOutput[channel][readerPointerOutput];
 
                 // EN: Apply the delay formula: y[n] = b0 * x[n] + bM * x[n - dM] - aW * y[n - dW].
                 // ES: Aplica la f�rmula del delay: y[n] = b0 * x[n] + bM * x[n - dM] - aW * y[n - dW].
@@ -111,11 +124,11 @@ void EchoFBF2::process(juce::AudioBuffer<float>& buffer)
 
                 // EN: Store the input sample with feedback in the circular input buffer.
                 // ES: Almacena la muestra de entrada con feedback en el buffer circular de entrada.
-                circularBufferInput[writterPointerInput[channel]][channel] = sampleInput + delayedSampleInput * feedback;
+                circularBufferInput[channel][writterPointerInput[channel]] = sampleInput + delayedSampleInput * feedback;
 
                 // EN: Store the processed output sample in the circular output buffer.
                 // ES: Almacena la muestra de salida procesada en el buffer circular de salida.
-                circularBufferOutput[writterPointerOutput[channel]][channel] = output;
+                circularBufferOutput[channel][writterPointerOutput[channel]] = output;
 
                 // EN: Advance the write pointers for input and output buffers.
                 // ES: Avanza los punteros de escritura para los buffers de entrada y salida.
@@ -135,6 +148,45 @@ void EchoFBF2::process(juce::AudioBuffer<float>& buffer)
     }
 }
 
+// EN: Block version of the formula for one channel. The buffer holds x[n] on entry and y[n] on exit:
+//     1. x[n] is stored in the input circular buffer.
+//     2. y[n] = b0 * x[n] + bM * x[n - dM] - aW * y[n - dW] is built in place.
+//     3. feedback * x[n - dM] is added to the stored x[n], segment by segment of the write span.
+//     4. y[n] is stored in the output circular buffer.
+// ES: Versión por bloque de la fórmula para un canal. El buffer contiene x[n] al entrar e y[n] al salir:
+//     1. x[n] se guarda en el buffer circular de entrada.
+//     2. y[n] = b0 * x[n] + bM * x[n - dM] - aW * y[n - dW] se construye en el mismo lugar.
+//     3. feedback * x[n - dM] se suma a la x[n] guardada, segmento a segmento del tramo de escritura.
+//     4. y[n] se guarda en el buffer circular de salida.
+void EchoFBF2::processBlock(float* channelData, int channel, int numSamples)
+{
+    float* inputBuffer = circularBufferInput[channel].data();
+    float* outputBuffer = circularBufferOutput[channel].data();
+
+    const int writePosition = writterPointerInput[channel];
+    const int readerPointerInput = DelayLineBlock::wrap(writePosition - delayM, circularBufferSize);
+    const int readerPointerOutput = DelayLineBlock::wrap(writterPointerOutput[channel] - delayW, circularBufferSize);
+
+    DelayLineBlock::write(inputBuffer, circularBufferSize, writePosition, channelData, numSamples);
+
+    juce::FloatVectorOperations::multiply(channelData, b0, numSamples);
+    DelayLineBlock::addWithMultiply(channelData, inputBuffer, circularBufferSize, readerPointerInput, bM, numSamples);
+    DelayLineBlock::addWithMultiply(channelData, outputBuffer, circularBufferSize, readerPointerOutput, -aW, numSamples);
+
+    const int firstPart = juce::jmin(numSamples, circularBufferSize - writePosition);
+    DelayLineBlock::addWithMultiply(inputBuffer + writePosition, inputBuffer, circularBufferSize, readerPointerInput, feedback, firstPart);
+
+    if (firstPart < numSamples)
+        DelayLineBlock::addWithMultiply(inputBuffer, inputBuffer, circularBufferSize,
+                                        DelayLineBlock::wrap(readerPointerInput + firstPart, circularBufferSize),
+                                        feedback, numSamples - firstPart);
+
+    DelayLineBlock::write(outputBuffer, circularBufferSize, writterPointerOutput[channel], channelData, numSamples);
+
+    writterPointerInput[channel] = DelayLineBlock::wrap(writterPointerInput[channel] + numSamples, circularBufferSize);
+    writterPointerOutput[channel] = DelayLineBlock::wrap(writterPointerOutput[channel] + numSamples, circularBufferSize);
+}
+
 // EN: Constructor (empty, default initialization done in the class definition).
 // ES: Constructor (vac�o, la inicializaci�n predeterminada se realiza en la definici�n de la clase).
 EchoFBF2::EchoFBF2()
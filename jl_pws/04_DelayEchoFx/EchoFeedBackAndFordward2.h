@@ -54,6 +54,10 @@ public:
     ~EchoFBF2();
 
 private:
+    // EN: Processes one channel as contiguous spans when both delays are at least one block long.
+    // ES: Procesa un canal como tramos contiguos cuando ambos retardos duran al menos un bloque.
+    void processBlock(float* channelData, int channel, int numSamples);
+
     // *** DELAY VARIABLES ***
 
     // EN: Delay in samples for the input (dM) and output (dW).
@@ -70,6 +74,8 @@ private:
     int numChannels = 2;
 
     // *** CIRCULAR BUFFERS ***
+    // EN: Stored as [channel][sample] so each channel is contiguous.
+    // ES: Guardados como [canal][muestra] para que cada canal sea contiguo.
 
     // EN: Circular buffer for delayed input samples (x[n - dM]).
     // ES: Buffer circular para muestras de entrada retrasadas (x[n - dM]).
@@ -54,10 +54,10 @@ void EchoStereo::prepare(double theSampleRate, int inTotalChannels)
 {
     sampleRate = theSampleRate; // EN: Set the sample rate
     // ES: Configurar la tasa de muestreo
-    circularBufferInput1.resize(circularBufferSize, std::vector<float>(inTotalChannels, 0.0f)); // EN: Initialize circular buffer for input 1
-    // ES: Inicializar buffer circular para la entrada 1
-    circularBufferInput2.resize(circularBufferSize, std::vector<float>(inTotalChannels, 0.0f)); // EN: Initialize circular buffer for input 2
-    // ES: Inicializar buffer circular para la entrada 2
+    circularBufferInput1.resize(inTotalChannels, std::vector<float>(circularBufferSize, 0.0f)); // EN: Initialize circular buffer for input 1, one row per channel
+    // ES: Inicializar buffer circular para la entrada 1, una fila por canal
+    circularBufferInput2.resize(inTotalChannels, std::vector<float>(circularBufferSize, 0.0f)); // EN: Initialize circular buffer for input 2, one row per channel
+    // ES: Inicializar buffer circular para la entrada 2, una fila por canal
 
 // EN: Initialize write pointers
 // ES: Inicializar punteros de escritura
@@ -65,77 +65,69 @@ void EchoStereo::prepare(double theSampleRate, int inTotalChannels)
     writterPointerInput2.resize(inTotalChannels, 0);
 }
 
-// EN: Process the audio buffer
-// ES: Procesar el buffer de audio
+// EN: Process the audio buffer. The left channel uses delay 1 and gain 1, the right channel delay 2 and gain 2;
+//     the choice is made once per channel instead of once per sample.
+// ES: Procesar el buffer de audio. El canal izquierdo usa el delay 1 y la ganancia 1, el derecho el delay 2 y la
+//     ganancia 2; la elección se hace una vez por canal en vez de una vez por muestra.
 void EchoStereo::process(juce::AudioBuffer<float>& buffer)
 {
-    auto outputCircularBuffer = 0.0f; // EN: Placeholder for output buffer
-    // ES: Variable temporal para el buffer de salida
+    if (delay1Samples < 1 && delay2Samples < 1)
+        return;
 
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    const int numSamples = buffer.getNumSamples();
+
+    for (int channel = 0; channel < juce::jmin(buffer.getNumChannels(), 2); channel++)
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        // EN: Select the circular buffer, delay, gain and write pointer of this channel
+        // ES: Seleccionar el buffer circular, el retardo, la ganancia y el puntero de escritura de este canal
+        float* circularBuffer = channel == 0 ? circularBufferInput1[channel].data() : circularBufferInput2[channel].data();
+        int& writterPointer = channel == 0 ? writterPointerInput1[channel] : writterPointerInput2[channel];
+        const int delaySamples = channel == 0 ? delay1Samples : delay2Samples;
+        const float gain = channel == 0 ? gain1 : gain2;
+
+        float* channelData = buffer.getWritePointer(channel);
+
+        // EN: Fast path: the echo is at least one block long, so the input block is stored and the delayed block
+        //     is added to the output as contiguous spans (at most two segments each)
+        // ES: Camino rápido: el eco dura al menos un bloque, así que el bloque de entrada se guarda y el bloque
+        //     retardado se suma a la salida como tramos contiguos (como mucho dos segmentos cada uno)
+        if (DelayLineBlock::canProcessBlock(delaySamples, numSamples, circularBufferSize))
+        {
+            const int readerPointer = DelayLineBlock::wrap(writterPointer - delaySamples, circularBufferSize);
+
+            DelayLineBlock::write(circularBuffer, circularBufferSize, writterPointer, channelData, numSamples);
+            DelayLineBlock::addWithMultiply(channelData, circularBuffer, circularBufferSize, readerPointer, gain, numSamples);
+
+            writterPointer = DelayLineBlock::wrap(writterPointer + numSamples, circularBufferSize);
+            continue;
+        }
+
+        // EN: Echoes shorter than the block fall back to one sample at a time
+        // ES: Los ecos más cortos que el bloque vuelven a procesarse muestra a muestra
+        for (int i = 0; i < numSamples; i++)
         {
-            if (delay1Samples >= 1 || delay2Samples >= 1)
-            {
-                auto sampleInput = buffer.getReadPointer(channel)[i]; // EN: Read input sample
-                // ES: Leer muestra de entrada
-
-// EN: Process left channel (channel 0, using output1)
-// ES: Procesar canal izquierdo (canal 0, usando output1)
-                if (channel == 0)
-                {
-                    int readerPointerInput1 = writterPointerInput1[channel] - delay1Samples; // EN: Calculate read pointer for delay
-                    // ES: Calcular puntero de lectura para el delay
-                    if (readerPointerInput1 < 0)
-                        readerPointerInput1 += circularBufferSize;
-
-                    float delayedSampleInput1 = circularBufferInput1[readerPointerInput1][channel]; // EN: Get delayed sample
-                    // ES: Obtener muestra retardada
-                    float output1 = sampleInput + gain1 * delayedSampleInput1; // EN: Apply gain to delayed sample
-                    // ES: Aplicar ganancia a la muestra retardada
-
-// EN: Store in the circular buffer for the left channel
-// ES: Guardar en el buffer circular del canal izquierdo
-                    circularBufferInput1[writterPointerInput1[channel]][channel] = sampleInput;
-
-                    // EN: Advance the write pointer for the left channel
-                    // ES: Avanzar el puntero de escritura del canal izquierdo
-                    writterPointerInput1[channel]++;
-                    if (writterPointerInput1[channel] >= circularBufferSize)
-                        writterPointerInput1[channel] = 0;
-
-                    // EN: Write processed output to the left channel
-                    // ES: Escribir la salida procesada en el canal izquierdo
-                    buffer.getWritePointer(channel)[i] = output1;
-                }
-
-                // EN: Process right channel (channel 1, using output2)
-                // ES: Procesar canal derecho (canal 1, usando output2)
-                else if (channel == 1)
-                {
-                    int readerPointerInput2 = writterPointerInput2[channel] - delay2Samples;
-                    if (readerPointerInput2 < 0)
-                        readerPointerInput2 += circularBufferSize;
-
-                    float delayedSampleInput2 = circularBufferInput2[readerPointerInput2][channel];
-                    float output2 = sampleInput + gain2 * delayedSampleInput2;
-
-                    // EN: Store in the circular buffer for the right channel
-                    // ES: Guardar en el buffer circular del canal derecho
-                    circularBufferInput2[writterPointerInput2[channel]][channel] = sampleInput;
-
-                    // EN: Advance the write pointer for the right channel
-                    // ES: Avanzar el puntero de escritura del canal derecho
-                    writterPointerInput2[channel]++;
-                    if (writterPointerInput2[channel] >= circularBufferSize)
-                        writterPointerInput2[channel] = 0;
-
-                    // EN: Write processed output to the right channel
-                    // ES: Escribir la salida procesada en el canal derecho
-                    buffer.getWritePointer(channel)[i] = output2;
-                }
-            }
+            auto sampleInput = channelData[i]; // EN: Read input sample
+            // ES: Leer muestra de entrada
+
+            int readerPointer = writterPointer - delaySamples; // EN: Calculate read pointer for delay
+            // ES: Calcular puntero de lectura para el delay
+            if (readerPointer < 0)
+                readerPointer += circularBufferSize;
+
+            float delayedSample = circularBuffer[readerPointer]; // EN: Get delayed sample
+            // ES: Obtener muestra retardada
+
+            // EN: Store the input in the circular buffer and advance the write pointer
+            // ES: Guardar la entrada en el buffer circular y avanzar el puntero de escritura
+            circularBuffer[writterPointer] = sampleInput;
+
+            writterPointer++;
+            if (writterPointer >= circularBufferSize)
+                writterPointer = 0;
+
+            // EN: Apply gain to the delayed sample and write the output
+            // ES: Aplicar ganancia a la muestra retardada y escribir la salida
+            channelData[i] = sampleInput + gain * delayedSample;
         }
     }
 }
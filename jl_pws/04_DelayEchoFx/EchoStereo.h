@@ -55,8 +55,8 @@ private:
     int numChannels = 2; // EN: Number of channels (can be dynamic)
                          // ES: Número de canales (puede ser dinámico)
 
-// EN: Circular buffers for input and output
-// ES: Buffers circulares para entrada y salida
+// EN: Circular buffers for input and output, stored as [channel][sample] so each channel is contiguous
+// ES: Buffers circulares para entrada y salida, guardados como [canal][muestra] para que cada canal sea contiguo
     std::vector<std::vector<float>> circularBufferInput1; // EN: Buffer for x[n - d1]
                                                           // ES: Buffer para x[n - d1]
 
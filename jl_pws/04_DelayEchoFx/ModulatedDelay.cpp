@@ -22,18 +22,50 @@ ModulatedDelay::~ModulatedDelay()
 {
 }
 
-// ES: Configura la frecuencia de muestreo para el efecto.
-// EN: Sets the sample rate for the effect.
+// ES: Configura la frecuencia de muestreo para el efecto, con 2 canales y bloques de 512 muestras.
+// EN: Sets the sample rate for the effect, with 2 channels and 512-sample blocks.
 void ModulatedDelay::prepare(double theSampleRate)
 {
-    sampleRate = theSampleRate; // ES: Guarda la frecuencia de muestreo proporcionada.
+    prepare(theSampleRate, 512, 2);
 }
 
-// ES: Configura el valor del delay en muestras, separ�ndolo en parte entera y fraccional.
-// EN: Sets the delay value in samples, separating it into integer and fractional parts.
-void ModulatedDelay::setDelay(float newDelayInSamples)
+// ES: El buffer circular guarda el delay máximo más un bloque (todo el bloque se escribe antes de leer) y se
+//     redondea a una potencia de dos.
+// EN: The circular buffer holds the maximum delay plus one block (the whole block is written before reading)
+//     and is rounded up to a power of two.
+void ModulatedDelay::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
 {
-    delay = std::floor(newDelayInSamples * sampleRate); // Convierte el tiempo de delay en muestras.
+    sampleRate = inSampleRate;
+    maxBlockSize = juce::jmax(1, inSamplesPerBlock);
+
+    bufferSize = 1;
+    while (bufferSize < maxDelaySamples + maxBlockSize + 1)
+        bufferSize *= 2;
+    bufferMask = bufferSize - 1;
+
+    buffer.assign(static_cast<size_t>(juce::jmax(1, inChannels)), std::vector<float>(static_cast<size_t>(bufferSize), 0.0f));
+    writeIndex.assign(buffer.size(), 0);
+
+    readOffset.assign(static_cast<size_t>(maxBlockSize), 0);
+    readFraction.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    fixedDelay.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+}
+
+// ES: Limpia los buffers circulares y reinicia los índices de escritura.
+// EN: Clears the circular buffers and restarts the write indices.
+void ModulatedDelay::reset()
+{
+    for (auto& channelBuffer : buffer)
+        std::fill(channelBuffer.begin(), channelBuffer.end(), 0.0f);
+
+    std::fill(writeIndex.begin(), writeIndex.end(), 0);
+}
+
+// ES: Configura el valor del delay en segundos, separándolo en parte entera y fraccional.
+// EN: Sets the delay value in seconds, separating it into integer and fractional parts.
+void ModulatedDelay::setDelay(float newDelayInSeconds)
+{
+    delay = juce::jlimit(0.0f, static_cast<float>(maxDelaySamples), static_cast<float>(newDelayInSeconds * sampleRate)); // Convierte el tiempo de delay en muestras.
     delayInt = static_cast<int>(delay);                // Parte entera del delay.
     delayFrac = delay - delayInt;                      // Parte fraccional del delay.
 }
@@ -42,10 +74,10 @@ void ModulatedDelay::setDelay(float newDelayInSamples)
 // EN: Inserts a sample into the circular buffer for the specified channel.
 void ModulatedDelay::pushSample(int channel, float sample)
 {
-    if (channel >= 0 && channel < buffer.size()) // Comprueba que el canal es v�lido.
+    if (channel >= 0 && channel < static_cast<int>(buffer.size())) // Comprueba que el canal es v�lido.
     {
         buffer[channel][writeIndex[channel]] = sample; // Escribe la muestra en el �ndice actual del buffer.
-        writeIndex[channel] = (writeIndex[channel] + 1) % maxDelaySamples; // Actualiza el �ndice circularmente.
+        writeIndex[channel] = (writeIndex[channel] + 1) & bufferMask; // Actualiza el índice circularmente.
     }
 }
 
@@ -53,11 +85,11 @@ void ModulatedDelay::pushSample(int channel, float sample)
 // EN: Retrieves a sample from the buffer for the specified channel, applying interpolation if needed.
 float ModulatedDelay::popSample(int channel)
 {
-    if (channel >= 0 && channel < buffer.size()) // Comprueba que el canal es v�lido.
+    if (channel >= 0 && channel < static_cast<int>(buffer.size())) // Comprueba que el canal es v�lido.
     {
-        // Calcula los �ndices de lectura para la interpolaci�n.
-        int readIndex1 = (writeIndex[channel] - delayInt + maxDelaySamples) % maxDelaySamples;
-        int readIndex2 = (readIndex1 + 1) % maxDelaySamples;
+        // Calcula los índices de lectura: la última muestra agregada está en writeIndex - 1.
+        const int readIndex1 = (writeIndex[channel] - 1 - delayInt) & bufferMask;
+        const int readIndex2 = (readIndex1 - 1) & bufferMask;
 
         // Aplica interpolaci�n lineal entre las dos muestras adyacentes.
         return (1.0f - delayFrac) * buffer[channel][readIndex1] + delayFrac * buffer[channel][readIndex2];
@@ -65,40 +97,95 @@ float ModulatedDelay::popSample(int channel)
     return 0.0f; // Si el canal no es v�lido, retorna 0 como valor por defecto.
 }
 
-// ES: Procesa un buffer de audio completo, aplicando el efecto de delay a cada canal.
-// EN: Processes an entire audio buffer, applying the delay effect to each channel.
+// ES: Procesa un buffer de audio completo con el delay fijo, usando una curva constante.
+// EN: Processes an entire audio buffer with the fixed delay, using a constant curve.
 void ModulatedDelay::process(juce::AudioBuffer<float>& inputBuffer)
 {
-    const int numChannels = inputBuffer.getNumChannels(); // N�mero de canales del buffer.
+    if (maxBlockSize == 0)
+        prepare(sampleRate);
+
+    juce::FloatVectorOperations::fill(fixedDelay.data(), delay, maxBlockSize);
+
     const int numSamples = inputBuffer.getNumSamples();   // N�mero de muestras en el buffer.
 
-    // Comprueba si el n�mero de buffers coincide con el n�mero de canales y redimensiona si es necesario.
-    if (buffer.size() != numChannels)
+    for (int start = 0; start < numSamples; start += maxBlockSize)
+    {
+        const int blockSize = juce::jmin(maxBlockSize, numSamples - start);
+
+        computeReadPositions(fixedDelay.data(), DelayUnit::Samples, blockSize);
+
+        for (int channel = 0; channel < juce::jmin(inputBuffer.getNumChannels(), static_cast<int>(buffer.size())); ++channel)
+            processChannel(channel, inputBuffer.getWritePointer(channel, start), blockSize);
+    }
+}
+
+// ES: Procesa el buffer en bloques de como máximo maxBlockSize muestras. Las posiciones de lectura se calculan
+//     una vez por bloque y se aplican a todos los canales.
+// EN: Processes the buffer in blocks of at most maxBlockSize samples. Read positions are computed once per
+//     block and applied to every channel.
+void ModulatedDelay::process(juce::AudioBuffer<float>& inputBuffer, const float* delayTimes, DelayUnit unit)
+{
+    if (maxBlockSize == 0)
+        prepare(sampleRate);
+
+    const int numChannels = juce::jmin(inputBuffer.getNumChannels(), static_cast<int>(buffer.size()));
+    const int numSamples = inputBuffer.getNumSamples();
+
+    for (int start = 0; start < numSamples; start += maxBlockSize)
     {
-        // Crea un buffer de delay para cada canal y lo inicializa con ceros.
-        buffer.resize(numChannels, std::vector<float>(maxDelaySamples, 0.0f));
+        const int blockSize = juce::jmin(maxBlockSize, numSamples - start);
+
+        computeReadPositions(delayTimes + start, unit, blockSize);
 
-        // Ajusta el tama�o del vector de �ndices de escritura para cada canal.
-        writeIndex.resize(numChannels, 0);
+        for (int channel = 0; channel < numChannels; ++channel)
+            processChannel(channel, inputBuffer.getWritePointer(channel, start), blockSize);
     }
+}
+
+// ES: La muestra i del bloque se escribe en writeIndex + i, así que su lectura está en i - delay respecto al
+//     índice de escritura del inicio del bloque. Se guarda la parte entera y la fraccional.
+// EN: Sample i of the block is written at writeIndex + i, so its read is at i - delay relative to the write
+//     index at the start of the block. The integer and fractional parts are stored.
+void ModulatedDelay::computeReadPositions(const float* delayTimes, DelayUnit unit, int numSamples)
+{
+    const float toSamples = unit == DelayUnit::Milliseconds ? static_cast<float>(sampleRate * 0.001) : 1.0f;
+    const float maxDelay = static_cast<float>(maxDelaySamples);
+
+    int* offsets = readOffset.data();
+    float* fractions = readFraction.data();
 
-    // Procesa cada canal de audio de manera independiente.
-    for (int channel = 0; channel < numChannels; ++channel)
+    for (int i = 0; i < numSamples; ++i)
     {
-        auto* channelData = inputBuffer.getWritePointer(channel); // Obtiene el puntero de escritura para el canal.
+        const float position = static_cast<float>(i) - juce::jlimit(0.0f, maxDelay, delayTimes[i] * toSamples);
+        const float floorPosition = std::floor(position);
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            float inputSample = channelData[i]; // Obtiene la muestra original.
+        offsets[i] = static_cast<int>(floorPosition);
+        fractions[i] = position - floorPosition;
+    }
+}
+
+// ES: Escribe todo el bloque en el buffer circular y después lee cada muestra interpolando entre las posiciones
+//     calculadas, envolviendo los índices con la máscara.
+// EN: Writes the whole block into the circular buffer, then reads every sample interpolating between the
+//     computed positions, wrapping the indices with the mask.
+void ModulatedDelay::processChannel(int channel, float* channelData, int numSamples)
+{
+    float* ring = buffer[channel].data();
+    const int start = writeIndex[channel];
 
-            // Inserta la muestra en el buffer circular.
-            pushSample(channel, inputSample);
+    DelayLineBlock::write(ring, bufferSize, start, channelData, numSamples);
 
-            // Extrae la muestra con delay aplicada.
-            float delayedSample = popSample(channel);
+    const int* offsets = readOffset.data();
+    const float* fractions = readFraction.data();
 
-            // Sustituye la muestra original con la muestra procesada (con delay).
-            channelData[i] = delayedSample;
-        }
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const int index = start + offsets[i];
+        const float a = ring[index & bufferMask];
+        const float b = ring[(index + 1) & bufferMask];
+
+        channelData[i] = a + fractions[i] * (b - a);
     }
-}
\ No newline at end of file
+
+    writeIndex[channel] = (start + numSamples) & bufferMask;
+}
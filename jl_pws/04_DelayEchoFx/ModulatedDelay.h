@@ -12,11 +12,28 @@
 //#include <JuceHeader.h>
 #include <vector>
 
-// ES: Clase ModulatedDelay: Implementa un efecto de delay modulado con soporte para m�ltiples canales.
+// ES: Clase ModulatedDelay: Implementa un efecto de delay modulado con soporte para múltiples canales.
+//     El tiempo de delay puede llegar por muestra (desde un LFO, una envolvente o un control externo), en muestras
+//     o en milisegundos. Las posiciones de lectura y los pesos de interpolación se calculan una vez por bloque para
+//     todos los canales, en bucles simples que el compilador puede vectorizar, y el buffer circular tiene un
+//     tamaño potencia de dos para envolver los índices con una máscara en vez de %. Sirve de base para chorus,
+//     flanger, vibrato y Doppler.
 // EN: ModulatedDelay class: Implements a modulated delay effect with support for multiple channels.
+//     The delay time can arrive per sample (from an LFO, an envelope or an external control), in samples or in
+//     milliseconds. Read positions and interpolation weights are computed once per block for all channels, in
+//     plain loops the compiler can vectorize, and the circular buffer has a power-of-two size so indices wrap with
+//     a mask instead of %. It is the building block for chorus, flanger, vibrato and Doppler effects.
 class ModulatedDelay
 {
 public:
+    // ES: Unidad de los tiempos de delay por muestra.
+    // EN: Unit of the per-sample delay times.
+    enum class DelayUnit
+    {
+        Samples,
+        Milliseconds
+    };
+
     // ES: Constructor: Inicializa los valores por defecto de la clase.
     // EN: Constructor: Initializes the default values of the class.
     ModulatedDelay();
@@ -25,33 +42,61 @@ public:
     // EN: Destructor: Frees resources used by the class.
     ~ModulatedDelay();
 
-    // ES: Configura el valor de sample rate para los c�lculos.
-    // EN: Configures the sample rate value for calculations.
+    // ES: Configura el valor de sample rate para los cálculos y reserva 2 canales con bloques de 512 muestras.
+    // EN: Configures the sample rate value for calculations and allocates 2 channels with 512-sample blocks.
     void prepare(double theSampleRate);
 
-    // ES: Configura el delay en muestras, soportando valores fraccionales.
-    // EN: Sets the delay in samples, supporting fractional values.
-    void setDelay(float newDelayInSamples);
+    // ES: Configura el sample rate y reserva los buffers circulares y las posiciones de lectura del bloque.
+    // EN: Configures the sample rate and allocates the circular buffers and the block read positions.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // ES: Limpia los buffers circulares.
+    // EN: Clears the circular buffers.
+    void reset();
+
+    // ES: Configura el delay fijo en segundos, soportando valores fraccionales.
+    // EN: Sets the fixed delay in seconds, supporting fractional values.
+    void setDelay(float newDelayInSeconds);
 
     // ES: Agrega una muestra al buffer para el canal especificado.
     // EN: Adds a sample to the buffer for the specified channel.
     void pushSample(int channel, float sample);
 
-    // ES: Extrae una muestra del buffer aplicando el delay configurado.
-    // EN: Retrieves a sample from the buffer applying the configured delay.
+    // ES: Extrae una muestra del buffer aplicando el delay configurado (0 devuelve la última muestra agregada).
+    // EN: Retrieves a sample from the buffer applying the configured delay (0 returns the last pushed sample).
     float popSample(int channel);
 
-    // ES: Procesa un buffer de audio aplicando el efecto de delay.
-    // EN: Processes an audio buffer, applying the delay effect.
+    // ES: Procesa un buffer de audio aplicando el delay fijo. Los canales por encima de los preparados no se modifican.
+    // EN: Processes an audio buffer, applying the fixed delay. Channels beyond the prepared ones are left untouched.
     void process(juce::AudioBuffer<float>& buffer);
 
-private:
-    double sampleRate{};                  // ES: Tasa de muestreo (samples por segundo).
-                                          // EN: Sample rate (samples per second).
+    // ES: Procesa un buffer de audio con un tiempo de delay por muestra (delayTimes tiene getNumSamples() valores,
+    //     compartidos por todos los canales). Los tiempos se limitan a [0, maxDelaySamples].
+    // EN: Processes an audio buffer with one delay time per sample (delayTimes holds getNumSamples() values,
+    //     shared by all channels). Times are limited to [0, maxDelaySamples].
+    void process(juce::AudioBuffer<float>& buffer, const float* delayTimes, DelayUnit unit = DelayUnit::Samples);
 
     static constexpr int maxDelaySamples = 48000; // ES: M�ximo delay permitido en muestras.
                                                   // EN: Maximum allowed delay in samples.
 
+private:
+    // ES: Calcula el índice relativo y el peso de interpolación de cada muestra del bloque.
+    // EN: Computes the relative index and the interpolation weight of every sample of the block.
+    void computeReadPositions(const float* delayTimes, DelayUnit unit, int numSamples);
+
+    // ES: Escribe el bloque de un canal y lee sus muestras con delay usando las posiciones calculadas.
+    // EN: Writes the block of a channel and reads its delayed samples using the computed positions.
+    void processChannel(int channel, float* channelData, int numSamples);
+
+    double sampleRate{ 48000.0 };         // ES: Tasa de muestreo (samples por segundo).
+                                          // EN: Sample rate (samples per second).
+
+    int bufferSize{ 0 };                  // ES: Tamaño del buffer circular (potencia de dos) y su máscara.
+    int bufferMask{ 0 };                  // EN: Size of the circular buffer (power of two) and its mask.
+
+    int maxBlockSize{ 0 };                // ES: Tamaño máximo de bloque de las posiciones de lectura.
+                                          // EN: Largest block size of the read positions.
+
     std::vector<int> writeIndex;         // ES: �ndices de escritura para cada canal en el buffer circular.
                                          // EN: Write indices for each channel in the circular buffer.
 
@@ -66,4 +111,12 @@ private:
 
     std::vector<std::vector<float>> buffer; // ES: Buffer de delay circular, con un buffer para cada canal.
                                             // EN: Circular delay buffer, with one buffer for each channel.
+
+    std::vector<int> readOffset;         // ES: Posición de lectura de cada muestra del bloque, relativa al índice de escritura
+    std::vector<float> readFraction;     //     al inicio del bloque, y su peso de interpolación.
+                                         // EN: Read position of every sample of the block, relative to the write index at
+                                         //     the start of the block, and its interpolation weight.
+
+    std::vector<float> fixedDelay;       // ES: Curva constante usada por process sin tiempos por muestra.
+                                         // EN: Constant curve used by process without per-sample times.
 };
@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    MultiTapDelay.cpp
+    Created: 19 Oct 2026 3:03:40am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "MultiTapDelay.h"
+
+// EN: Constructor of MultiTapDelay class.
+// ES: Constructor de la clase MultiTapDelay.
+MultiTapDelay::MultiTapDelay()
+{
+}
+
+// EN: Destructor of MultiTapDelay class.
+// ES: Destructor de la clase MultiTapDelay.
+MultiTapDelay::~MultiTapDelay()
+{
+}
+
+// EN: Sets the longest tap time in seconds.
+// ES: Establece el tiempo de toma más largo en segundos.
+void MultiTapDelay::setMaximumDelay(float inSeconds)
+{
+    maximumDelaySeconds = juce::jmax(0.001f, inSeconds);
+}
+
+// EN: The circular buffer holds the maximum delay plus one block, so a tap at the maximum delay never reads
+//     samples that the current block has already overwritten.
+// ES: El buffer circular guarda el retardo máximo más un bloque, así una toma con el retardo máximo nunca lee
+//     muestras que el bloque actual ya ha sobrescrito.
+void MultiTapDelay::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    juce::ignoreUnused(inChannels);
+
+    sampleRate = inSampleRate;
+    maxBlockSize = juce::jmax(1, inSamplesPerBlock);
+    maximumDelaySamples = static_cast<int>(std::ceil(maximumDelaySeconds * sampleRate));
+
+    circularBufferSize = maximumDelaySamples + maxBlockSize;
+    circularBuffer.assign(static_cast<size_t>(circularBufferSize), 0.0f);
+
+    monoInput.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    tapBlock.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    wetLeft.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    wetRight.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+
+    for (auto& tap : taps)
+        updateTap(tap);
+
+    reset();
+}
+
+// EN: Clears the history and the tap filters.
+// ES: Limpia el historial y los filtros de las tomas.
+void MultiTapDelay::reset()
+{
+    std::fill(circularBuffer.begin(), circularBuffer.end(), 0.0f);
+    writePosition = 0;
+
+    for (auto& tap : taps)
+        tap.filterState = 0.0f;
+}
+
+// EN: Sets how many taps are active.
+// ES: Establece cuántas tomas están activas.
+void MultiTapDelay::setNumTaps(int inNumTaps)
+{
+    numTaps = juce::jlimit(0, maxTaps, inNumTaps);
+}
+
+// EN: Sets the delay time of a tap.
+// ES: Establece el tiempo de retardo de una toma.
+void MultiTapDelay::setTapTime(int tapIndex, float inSeconds)
+{
+    if (tapIndex < 0 || tapIndex >= maxTaps)
+        return;
+
+    taps[tapIndex].timeSeconds = juce::jmax(0.0f, inSeconds);
+    updateTap(taps[tapIndex]);
+}
+
+// EN: Sets the gain of a tap.
+// ES: Establece la ganancia de una toma.
+void MultiTapDelay::setTapGain(int tapIndex, float inGain)
+{
+    if (tapIndex < 0 || tapIndex >= maxTaps)
+        return;
+
+    taps[tapIndex].gain = inGain;
+    updateTap(taps[tapIndex]);
+}
+
+// EN: Sets the pan of a tap.
+// ES: Establece el paneo de una toma.
+void MultiTapDelay::setTapPan(int tapIndex, float inPan)
+{
+    if (tapIndex < 0 || tapIndex >= maxTaps)
+        return;
+
+    taps[tapIndex].pan = juce::jlimit(-1.0f, 1.0f, inPan);
+    updateTap(taps[tapIndex]);
+}
+
+// EN: Sets the cutoff of the tap filter.
+// ES: Establece el corte del filtro de la toma.
+void MultiTapDelay::setTapFilter(int tapIndex, float inCutoffHz)
+{
+    if (tapIndex < 0 || tapIndex >= maxTaps)
+        return;
+
+    taps[tapIndex].cutoffHz = juce::jmax(0.0f, inCutoffHz);
+    updateTap(taps[tapIndex]);
+}
+
+// EN: Sets the dry/wet mix.
+// ES: Establece la mezcla seco/húmedo.
+void MultiTapDelay::setMix(float inMix)
+{
+    mix = juce::jlimit(0.0f, 1.0f, inMix);
+}
+
+// EN: Sine pan law (Pan_sineLaw) and the one-pole coefficient a = 1 - e^(-2 pi fc / fs).
+// ES: Ley de paneo del seno (Pan_sineLaw) y el coeficiente de un polo a = 1 - e^(-2 pi fc / fs).
+void MultiTapDelay::updateTap(Tap& tap)
+{
+    const float pi = juce::MathConstants<float>::pi;
+    const float panValue = (tap.pan + 1.0f) * 0.5f;
+
+    tap.delaySamples = juce::jlimit(0, maximumDelaySamples, static_cast<int>(std::round(tap.timeSeconds * sampleRate)));
+    tap.leftGain = tap.gain * std::sin((1.0f - panValue) * (pi / 2.0f));
+    tap.rightGain = tap.gain * std::sin(panValue * (pi / 2.0f));
+
+    tap.filterCoefficient = tap.cutoffHz > 0.0f && tap.cutoffHz < 0.5f * sampleRate
+        ? static_cast<float>(1.0 - std::exp(-juce::MathConstants<double>::twoPi * tap.cutoffHz / sampleRate))
+        : 0.0f;
+}
+
+// EN: Splits the buffer into blocks of at most maxBlockSize samples.
+// ES: Divide el buffer en bloques de como máximo maxBlockSize muestras.
+void MultiTapDelay::process(juce::AudioBuffer<float>& buffer)
+{
+    if (maxBlockSize == 0 || buffer.getNumChannels() == 0)
+        return;
+
+    for (int start = 0; start < buffer.getNumSamples(); start += maxBlockSize)
+        processBlock(buffer, start, juce::jmin(maxBlockSize, buffer.getNumSamples() - start));
+}
+
+// EN: 1. Sums the input to mono and writes it once to the shared history.
+//     2. Each tap adds its delayed span (filtered if needed) to the wet sums with its pan gains.
+//     3. Mixes the wet sums with the dry input.
+// ES: 1. Suma la entrada a mono y la escribe una vez en el historial compartido.
+//     2. Cada toma suma su tramo retardado (filtrado si hace falta) a las sumas húmedas con sus ganancias de paneo.
+//     3. Mezcla las sumas húmedas con la entrada seca.
+void MultiTapDelay::processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    const int numChannels = buffer.getNumChannels();
+    const bool isStereo = numChannels > 1;
+
+    float* mono = monoInput.data();
+    juce::FloatVectorOperations::copy(mono, buffer.getReadPointer(0, startSample), numSamples);
+
+    if (isStereo)
+    {
+        juce::FloatVectorOperations::add(mono, buffer.getReadPointer(1, startSample), numSamples);
+        juce::FloatVectorOperations::multiply(mono, 0.5f, numSamples);
+    }
+
+    DelayLineBlock::write(circularBuffer.data(), circularBufferSize, writePosition, mono, numSamples);
+
+    juce::FloatVectorOperations::clear(wetLeft.data(), numSamples);
+    juce::FloatVectorOperations::clear(wetRight.data(), numSamples);
+
+    for (int t = 0; t < numTaps; t++)
+    {
+        auto& tap = taps[t];
+        const int readPosition = DelayLineBlock::wrap(writePosition - tap.delaySamples, circularBufferSize);
+
+        // EN: A mono output ignores the pan and uses the plain tap gain.
+        // ES: Una salida mono ignora el paneo y usa la ganancia simple de la toma.
+        const float leftGain = isStereo ? tap.leftGain : tap.gain;
+
+        if (tap.filterCoefficient == 0.0f)
+        {
+            DelayLineBlock::addWithMultiply(wetLeft.data(), circularBuffer.data(), circularBufferSize, readPosition, leftGain, numSamples);
+
+            if (isStereo)
+                DelayLineBlock::addWithMultiply(wetRight.data(), circularBuffer.data(), circularBufferSize, readPosition, tap.rightGain, numSamples);
+
+            continue;
+        }
+
+        // EN: Filtered tap: copy the span, run the one-pole in place, then add it like an unfiltered tap.
+        // ES: Toma filtrada: copia el tramo, aplica el filtro de un polo en el mismo lugar y la suma como una toma sin filtro.
+        float* block = tapBlock.data();
+        juce::FloatVectorOperations::clear(block, numSamples);
+        DelayLineBlock::addWithMultiply(block, circularBuffer.data(), circularBufferSize, readPosition, 1.0f, numSamples);
+
+        float state = tap.filterState;
+        for (int i = 0; i < numSamples; i++)
+        {
+            state += tap.filterCoefficient * (block[i] - state);
+            block[i] = state;
+        }
+        tap.filterState = state;
+
+        juce::FloatVectorOperations::addWithMultiply(wetLeft.data(), block, leftGain, numSamples);
+
+        if (isStereo)
+            juce::FloatVectorOperations::addWithMultiply(wetRight.data(), block, tap.rightGain, numSamples);
+    }
+
+    writePosition = DelayLineBlock::wrap(writePosition + numSamples, circularBufferSize);
+
+    // EN: Only the first two channels receive the taps; any extra channel is left untouched.
+    // ES: Solo los dos primeros canales reciben las tomas; cualquier canal extra no se modifica.
+    for (int channel = 0; channel < juce::jmin(numChannels, 2); channel++)
+    {
+        float* channelData = buffer.getWritePointer(channel, startSample);
+        const float* wet = channel == 0 ? wetLeft.data() : wetRight.data();
+
+        juce::FloatVectorOperations::multiply(channelData, 1.0f - mix, numSamples);
+        juce::FloatVectorOperations::addWithMultiply(channelData, wet, mix, numSamples);
+    }
+}
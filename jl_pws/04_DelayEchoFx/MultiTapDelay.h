@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    MultiTapDelay.h
+    Created: 19 Oct 2026 3:03:40am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: MultiTapDelay reads up to 32 taps from a single circular buffer. The input (summed to mono) is written once
+//     per block, and every tap reads its delayed block from the same history with its own time, gain, pan (sine
+//     law, like Pan_sineLaw) and an optional one-pole low-pass filter. Memory grows with the maximum delay
+//     instead of taps x maximum delay.
+//     Because the whole input block is written before any tap reads, every tap (also those shorter than the block)
+//     is read as a contiguous span of at most two segments and added to the output with one vector multiply-add
+//     per channel (DelayLineBlock).
+// ES: MultiTapDelay lee hasta 32 tomas desde un único buffer circular. La entrada (sumada a mono) se escribe una vez
+//     por bloque, y cada toma lee su bloque retardado del mismo historial con su propio tiempo, ganancia, paneo
+//     (ley del seno, como Pan_sineLaw) y un filtro pasa bajos de un polo opcional. La memoria crece con el retardo
+//     máximo en vez de tomas x retardo máximo.
+//     Como todo el bloque de entrada se escribe antes de que lea cualquier toma, cada toma (también las más cortas
+//     que el bloque) se lee como un tramo contiguo de como mucho dos segmentos y se suma a la salida con una
+//     multiplicación-suma vectorial por canal (DelayLineBlock).
+class MultiTapDelay
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    MultiTapDelay();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~MultiTapDelay();
+
+    // EN: Sets the longest tap time in seconds. Takes effect in the next prepare.
+    // ES: Establece el tiempo de toma más largo en segundos. Tiene efecto en el siguiente prepare.
+    void setMaximumDelay(float inSeconds);
+
+    // EN: Allocates the circular buffer (maximum delay + one block) and the block scratch buffers.
+    // ES: Reserva el buffer circular (retardo máximo + un bloque) y los buffers temporales del bloque.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the history and the tap filters.
+    // ES: Limpia el historial y los filtros de las tomas.
+    void reset();
+
+    // EN: Processes the buffer in place: dry input plus the sum of all active taps, balanced by the mix.
+    // ES: Procesa el buffer en el mismo lugar: entrada seca más la suma de todas las tomas activas, equilibradas por la mezcla.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    // EN: Sets how many taps are active (0 to maxTaps).
+    // ES: Establece cuántas tomas están activas (0 a maxTaps).
+    void setNumTaps(int inNumTaps);
+
+    // EN: Sets the delay time of a tap in seconds.
+    // ES: Establece el tiempo de retardo de una toma en segundos.
+    void setTapTime(int tapIndex, float inSeconds);
+
+    // EN: Sets the linear gain of a tap.
+    // ES: Establece la ganancia lineal de una toma.
+    void setTapGain(int tapIndex, float inGain);
+
+    // EN: Sets the pan of a tap, from -1 (left) to 1 (right).
+    // ES: Establece el paneo de una toma, de -1 (izquierda) a 1 (derecha).
+    void setTapPan(int tapIndex, float inPan);
+
+    // EN: Sets the cutoff of the tap's one-pole low-pass in Hz. 0 disables the filter.
+    // ES: Establece el corte del pasa bajos de un polo de la toma en Hz. 0 desactiva el filtro.
+    void setTapFilter(int tapIndex, float inCutoffHz);
+
+    // EN: Sets the dry/wet mix (0 to 1).
+    // ES: Establece la mezcla seco/húmedo (0 a 1).
+    void setMix(float inMix);
+
+    static constexpr int maxTaps = 32;
+
+private:
+    // EN: Settings and derived values of one tap.
+    // ES: Ajustes y valores derivados de una toma.
+    struct Tap
+    {
+        float timeSeconds{ 0.25f };
+        float gain{ 0.5f };
+        float pan{ 0.0f };
+        float cutoffHz{ 0.0f };
+
+        int delaySamples{ 0 };
+        float leftGain{ 0.0f };
+        float rightGain{ 0.0f };
+        float filterCoefficient{ 0.0f };
+        float filterState{ 0.0f };
+    };
+
+    // EN: Recomputes the delay in samples, pan gains and filter coefficient of a tap.
+    // ES: Recalcula el retardo en muestras, las ganancias de paneo y el coeficiente del filtro de una toma.
+    void updateTap(Tap& tap);
+
+    // EN: Processes at most maxBlockSize samples starting at startSample.
+    // ES: Procesa como máximo maxBlockSize muestras empezando en startSample.
+    void processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+    double sampleRate{ 48000.0 };
+    float maximumDelaySeconds{ 4.0f };
+    int maximumDelaySamples{ 0 };
+    int maxBlockSize{ 0 };
+
+    // EN: Shared mono history and its write position.
+    // ES: Historial mono compartido y su posición de escritura.
+    std::vector<float> circularBuffer;
+    int circularBufferSize{ 0 };
+    int writePosition{ 0 };
+
+    // EN: Block scratch buffers: mono input, filtered tap, and the left/right wet sums.
+    // ES: Buffers temporales del bloque: entrada mono, toma filtrada y las sumas húmedas izquierda/derecha.
+    std::vector<float> monoInput;
+    std::vector<float> tapBlock;
+    std::vector<float> wetLeft;
+    std::vector<float> wetRight;
+
+    std::array<Tap, maxTaps> taps;
+    int numTaps{ 4 };
+    float mix{ 0.5f };
+};
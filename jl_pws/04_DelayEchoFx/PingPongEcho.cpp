@@ -60,10 +60,10 @@ void PingPongEcho::prepare(double theSampleRate, int inTotalChannels)
 {
     sampleRate = theSampleRate;
 
-    // ES: Redimensionar los buffers circulares para los canales
-    // EG: Resize circular buffers for the channels
-    circularBufferInput1.resize(circularBufferSize, std::vector<float>(inTotalChannels, 0.0f));
-    circularBufferInput2.resize(circularBufferSize, std::vector<float>(inTotalChannels, 0.0f));
+    // ES: Redimensionar los buffers circulares para los canales, una fila contigua por canal
+    // EG: Resize circular buffers for the channels, one contiguous row per channel
+    circularBufferInput1.resize(inTotalChannels, std::vector<float>(circularBufferSize, 0.0f));
+    circularBufferInput2.resize(inTotalChannels, std::vector<float>(circularBufferSize, 0.0f));
 
     // ES: Inicializar los punteros de escritura para cada canal
     // EG: Initialize write pointers for each channel
@@ -78,7 +78,40 @@ void PingPongEcho::prepare(double theSampleRate, int inTotalChannels)
 // applying the PingPong Echo effect with the corresponding delays and cross-feedbacks.
 void PingPongEcho::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int i = 0; i < buffer.getNumSamples(); i++)
+    const int numSamples = buffer.getNumSamples();
+
+    // ES: Camino rápido: el izquierdo lee al derecho con delay1Samples, así que si delay1Samples cubre el bloque
+    // todo lo que lee se escribió en bloques anteriores. El derecho lee al izquierdo ya escrito en este bloque,
+    // así que le basta con un retardo de al menos una muestra. Ambos se hacen como tramos contiguos.
+    // EG: Fast path: the left channel reads the right one delay1Samples back, so if delay1Samples covers the block
+    // everything it reads was written in earlier blocks. The right channel reads the left one already written in
+    // this block, so a delay of at least one sample is enough. Both are done as contiguous spans.
+    if (DelayLineBlock::canProcessBlock(delay1Samples, numSamples, circularBufferSize)
+        && delay2Samples >= 1 && delay2Samples + numSamples <= circularBufferSize)
+    {
+        float* leftData = buffer.getWritePointer(0);
+        float* rightData = buffer.getWritePointer(1);
+        float* leftCircularBuffer = circularBufferInput1[0].data();
+        float* rightCircularBuffer = circularBufferInput2[1].data();
+
+        // ES: Canal izquierdo: entrada menos el derecho retrasado, guardado en su buffer circular
+        // EG: Left channel: input minus the delayed right channel, stored in its circular buffer
+        const int readerPointerInputLeft = DelayLineBlock::wrap(writterPointerInput2[1] - delay1Samples, circularBufferSize);
+        DelayLineBlock::addWithMultiply(leftData, rightCircularBuffer, circularBufferSize, readerPointerInputLeft, -gain1, numSamples);
+        DelayLineBlock::write(leftCircularBuffer, circularBufferSize, writterPointerInput1[0], leftData, numSamples);
+
+        // ES: El camino muestra a muestra lee después de avanzar el puntero izquierdo, de ahí el + 1
+        // EG: The per-sample path reads after the left pointer has advanced, hence the + 1
+        const int readerPointerInputRight = DelayLineBlock::wrap(writterPointerInput1[0] + 1 - delay2Samples, circularBufferSize);
+        DelayLineBlock::addWithMultiply(rightData, leftCircularBuffer, circularBufferSize, readerPointerInputRight, -gain2, numSamples);
+        DelayLineBlock::write(rightCircularBuffer, circularBufferSize, writterPointerInput2[1], rightData, numSamples);
+
+        writterPointerInput1[0] = DelayLineBlock::wrap(writterPointerInput1[0] + numSamples, circularBufferSize);
+        writterPointerInput2[1] = DelayLineBlock::wrap(writterPointerInput2[1] + numSamples, circularBufferSize);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; i++)
     {
         // ES: Obtener la señal de entrada de cada canal
         // EG: Get input signal from each channel
@@ -94,14 +127,14 @@ void PingPongEcho::process(juce::AudioBuffer<float>& buffer)
 
         // ES: Recuperar la muestra retrasada del canal derecho
         // EG: Retrieve delayed sample from the right channel
-        float delayedSampleFromRight = circularBufferInput2[readerPointerInputLeft][1]; // Señal retrasada del derecho
+        float delayedSampleFromRight = circularBufferInput2[1][readerPointerInputLeft]; // Señal retrasada del derecho
         // ES: Calcular la salida para el canal izquierdo
         // EG: Calculate output for left channel
         float leftOutput = leftInput - gain1 * delayedSampleFromRight; // Canal izquierdo + feedback derecho
 
         // ES: Guardar la salida procesada en el buffer circular del canal izquierdo
         // EG: Save processed output into the left channel circular buffer
-        circularBufferInput1[writterPointerInput1[0]][0] = leftOutput;
+        circularBufferInput1[0][writterPointerInput1[0]] = leftOutput;
 
         // ES: Avanzar el puntero de escritura del canal izquierdo
         // EG: Move left channel write pointer forward
@@ -122,14 +155,14 @@ void PingPongEcho::process(juce::AudioBuffer<float>& buffer)
 
         // ES: Recuperar la muestra retrasada del canal izquierdo
         // EG: Retrieve the delayed sample from the left channel
-        float delayedSampleFromLeft = circularBufferInput1[readerPointerInputRight][0]; // Señal retrasada del izquierdo
+        float delayedSampleFromLeft = circularBufferInput1[0][readerPointerInputRight]; // Señal retrasada del izquierdo
         // ES: Calcular la salida para el canal derecho
         // EG: Calculate the output for the right channel
         float rightOutput = rightInput - gain2 * delayedSampleFromLeft; // Canal derecho + feedback izquierdo
 
         // ES: Guardar la salida procesada en el buffer circular del canal derecho
         // EG: Save the processed output into the right channel circular buffer
-        circularBufferInput2[writterPointerInput2[1]][1] = rightOutput;
+        circularBufferInput2[1][writterPointerInput2[1]] = rightOutput;
 
         // ES: Avanzar el puntero de escritura del canal derecho
         // EG: Move the right channel write pointer forward
@@ -66,7 +66,7 @@ private:
     // EG: Number of channels to process. By default, it's 2 (stereo).
     int numChannels = 2;  // N�mero de canales para el procesamiento (por defecto 2)
 
-    // Buffers circulares para manejar las entradas y salidas
+    // Buffers circulares para manejar las entradas y salidas, guardados como [canal][muestra]
     // ES: Buffer que contiene las muestras de entrada para el primer canal.
     // EG: Buffer holding the input samples for the first channel.
     std::vector<std::vector<float>> circularBufferInput1;  // Buffer para el primer canal (entrada)
@@ -30,14 +30,34 @@ void SimpleDelay::setDelay(float inDelay)
 // ES: Procesa el búfer de entrada y aplica el efecto de delay.
 void SimpleDelay::process(juce::AudioBuffer<float>& buffer)
 {
+    pullPendingStorage();
+
     // EN: Stores the output from the circular buffer for processing.
     // ES: Almacena la salida del búfer circular para el procesamiento.
     auto outputCircularBuffer = 0.0f;
 
+    const int numSamples = buffer.getNumSamples();
+
     // EN: Iterate over each audio channel.
     // ES: Itera sobre cada canal de audio.
     for (int channel = 0; channel < buffer.getNumChannels(); channel++)
     {
+        // EN: Fast path: the delay covers the whole block, so the input is stored and the delayed block is
+        //     added to it as contiguous spans of the circular buffer.
+        // ES: Camino rápido: el delay cubre todo el bloque, así que la entrada se guarda y el bloque con delay
+        //     se le suma como tramos contiguos del búfer circular.
+        if (DelayLineBlock::canProcessBlock(delay, numSamples, circularBufferSize))
+        {
+            float* channelData = buffer.getWritePointer(channel);
+            const int readPosition = DelayLineBlock::wrap(writterPointer[channel] - delay, circularBufferSize);
+
+            circularBuffer.write(channel, writterPointer[channel], channelData, numSamples);
+            circularBuffer.addWithMultiply(channelData, channel, readPosition, 1.0f, numSamples);
+
+            writterPointer[channel] = DelayLineBlock::wrap(writterPointer[channel] + numSamples, circularBufferSize);
+            continue;
+        }
+
         // EN: Iterate over each audio sample in the current channel.
         // ES: Itera sobre cada muestra de audio en el canal actual.
         for (int i = 0; i < buffer.getNumSamples(); i++)
@@ -60,11 +80,11 @@ void SimpleDelay::process(juce::AudioBuffer<float>& buffer)
 
                 // EN: Retrieve the delayed sample from the circular buffer.
                 // ES: Recupera la muestra con delay del búfer circular.
-                outputCircularBuffer = circularBuffer[readerPointer][channel];
+                outputCircularBuffer = circularBuffer.getSample(channel, readerPointer);
 
                 // EN: Write the current input sample to the circular buffer.
                 // ES: Escribe la muestra de entrada actual en el búfer circular.
-                circularBuffer[writterPointer[channel]][channel] = sample;
+                circularBuffer.setSample(channel, writterPointer[channel], sample);
 
                 // EN: Increment the writer pointer and wrap it around if necessary.
                 // ES: Incrementa el puntero de escritura y lo regresa al inicio si es necesario.
@@ -86,10 +106,46 @@ void SimpleDelay::process(juce::AudioBuffer<float>& buffer)
     }
 }
 
-// EN: Constructor for the SimpleDelay class. Initializes default values.
-// ES: Constructor de la clase SimpleDelay. Inicializa valores predeterminados.
+// EN: The new buffer is built without the lock; under it the buffer is only swapped with the pending one, and the
+//     buffer that comes out (an older pending one or the one process left) is freed after the lock is released.
+// ES: El nuevo búfer se construye sin el candado; con él solo se intercambia con el pendiente, y el búfer que sale
+//     (uno pendiente anterior o el que dejó process) se libera tras soltar el candado.
+void SimpleDelay::setStorageFormat(DelayStorage::Format inFormat)
+{
+    if (inFormat == storageFormat)
+        return;
+
+    storageFormat = inFormat;
+
+    DelayStorage newBuffer;
+    newBuffer.setFormat(inFormat);
+    newBuffer.allocate(2, circularBufferSize);
+
+    const juce::SpinLock::ScopedLockType lock(storageLock);
+    pendingBuffer.swap(newBuffer);
+    pendingChanged = true;
+}
+
+// EN: Takes the pending buffer if one is waiting. Never blocks: if the message thread holds the lock, the swap is
+//     retried on the next block.
+// ES: Toma el búfer pendiente si hay uno esperando. Nunca bloquea: si el hilo de mensajes tiene el candado, el
+//     intercambio se reintenta en el siguiente bloque.
+void SimpleDelay::pullPendingStorage()
+{
+    const juce::SpinLock::ScopedTryLockType tryLock(storageLock);
+
+    if (!tryLock.isLocked() || !pendingChanged)
+        return;
+
+    circularBuffer.swap(pendingBuffer);
+    pendingChanged = false;
+}
+
+// EN: Constructor for the SimpleDelay class. Allocates the circular buffer.
+// ES: Constructor de la clase SimpleDelay. Reserva el búfer circular.
 SimpleDelay::SimpleDelay()
 {
+    circularBuffer.allocate(2, circularBufferSize);
 }
 
 // EN: Destructor for the SimpleDelay class. Cleans up resources if necessary.
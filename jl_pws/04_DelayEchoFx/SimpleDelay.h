@@ -28,6 +28,15 @@ public:
     // ES: Procesa el búfer de audio de entrada y aplica el efecto de delay.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Sets the sample format of the circular buffer (Int16, Half and BFloat16 halve its memory). A cleared
+    //     buffer in the new format is allocated here and swapped in by process at the start of the next block, so
+    //     call it from the message thread while audio runs; the old buffer is freed here on a later call.
+    // ES: Establece el formato de muestra del búfer circular (Int16, Half y BFloat16 reducen su memoria a la mitad).
+    //     Aquí se reserva un búfer limpio en el nuevo formato y process lo intercambia al principio del siguiente
+    //     bloque, así que se puede llamar desde el hilo de mensajes mientras suena el audio; el búfer antiguo se
+    //     libera aquí en una llamada posterior.
+    void setStorageFormat(DelayStorage::Format inFormat);
+
     // EN: Constructor for the SimpleDelay class.
     // ES: Constructor de la clase SimpleDelay.
     SimpleDelay();
@@ -37,6 +46,10 @@ public:
     ~SimpleDelay();
 
 private:
+    // EN: Swaps in the buffer set by setStorageFormat, if there is one. Called at the start of each block.
+    // ES: Intercambia el búfer fijado por setStorageFormat, si hay uno. Se llama al principio de cada bloque.
+    void pullPendingStorage();
+
     // EN: The delay time in samples.
     // ES: El tiempo de delay en muestras.
     int delay = 48000;
@@ -49,9 +62,18 @@ private:
     // ES: El tamaño del búfer circular utilizado para almacenar el audio con delay.
     static const int circularBufferSize = 96000;
 
-    // EN: A circular buffer to hold audio samples for two channels (stereo).
-    // ES: Un búfer circular para almacenar muestras de audio para dos canales (estéreo).
-    float circularBuffer[circularBufferSize][2] = { 0.0f };
+    // EN: A circular buffer to hold audio samples for two channels (stereo), one contiguous row per channel.
+    // ES: Un búfer circular para almacenar muestras de audio para dos canales (estéreo), una fila contigua por canal.
+    DelayStorage circularBuffer;
+
+    // EN: Buffer in the requested format waiting to be swapped in (or the old one, after the swap), its format and
+    //     the lock shared with setStorageFormat, which process only tries so it never blocks.
+    // ES: Búfer en el formato pedido esperando a ser intercambiado (o el antiguo, tras el intercambio), su formato y
+    //     el candado compartido con setStorageFormat, que process solo intenta tomar así nunca bloquea.
+    DelayStorage pendingBuffer;
+    DelayStorage::Format storageFormat{ DelayStorage::Format::Float32 };
+    bool pendingChanged{ false };
+    juce::SpinLock storageLock;
 
     // EN: Pointer to read delayed audio from the circular buffer.
     // ES: Puntero para leer el audio con delay desde el búfer circular.
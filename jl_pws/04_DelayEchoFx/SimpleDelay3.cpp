@@ -12,7 +12,8 @@
 
 // EN: Prepares the delay effect by setting up the DSP process specifications and initializing the delay line.
 // ES: Prepara el efecto de delay configurando las especificaciones del proceso DSP e inicializando la línea de delay.
-void SimpleDelay3::prepare(double theSampleRate, int samplesPerBlock, juce::dsp::ProcessSpec& spec, int numChannels)
+template <typename SampleType>
+void SimpleDelay3_T<SampleType>::prepare(double theSampleRate, int samplesPerBlock, juce::dsp::ProcessSpec& spec, int numChannels)
 {
     spec.sampleRate = theSampleRate; // EN: Set the sample rate for the process spec.
                                      // ES: Establece la frecuencia de muestreo para las especificaciones del proceso.
@@ -34,10 +35,11 @@ void SimpleDelay3::prepare(double theSampleRate, int samplesPerBlock, juce::dsp:
 
 // EN: Sets the delay time in seconds and updates the delay line configuration.
 // ES: Configura el tiempo de delay en segundos y actualiza la configuración de la línea de delay.
-void SimpleDelay3::setTimeDelay(float delayTime)
+template <typename SampleType>
+void SimpleDelay3_T<SampleType>::setTimeDelay(float delayTime)
 {
-    delay = static_cast<int>(std::floor(delayTime * sampleRate)); // EN: Convert delay time (in seconds) to samples.
-                                                                  // ES: Convierte el tiempo de delay (en segundos) a muestras.
+    delay = static_cast<SampleType>(std::floor(delayTime * sampleRate)); // EN: Convert delay time (in seconds) to samples.
+                                                                         // ES: Convierte el tiempo de delay (en segundos) a muestras.
     myDelay.setDelay(delay); // EN: Update the delay line with the calculated delay in samples.
                              // ES: Actualiza la línea de delay con el valor de delay calculado en muestras.
     DBG(delay); // EN: Print the delay value to the debug output.
@@ -46,7 +48,8 @@ void SimpleDelay3::setTimeDelay(float delayTime)
 
 // EN: Processes the audio buffer, applying the delay effect to each sample in each channel.
 // ES: Procesa el búfer de audio, aplicando el efecto de delay a cada muestra en cada canal.
-void SimpleDelay3::process(juce::AudioBuffer<float>& buffer)
+template <typename SampleType>
+void SimpleDelay3_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
     for (int channel = 0; channel < buffer.getNumChannels(); channel++) // EN: Loop through each channel in the buffer.
                                                                         // ES: Itera por cada canal en el búfer.
@@ -59,7 +62,7 @@ void SimpleDelay3::process(juce::AudioBuffer<float>& buffer)
         for (int i = 0; i < buffer.getNumSamples(); i++) // EN: Loop through each sample in the buffer.
                                                          // ES: Itera por cada muestra en el búfer.
         {
-            float delayedSample = myDelay.popSample(channel); // EN: Retrieve the delayed sample from the delay line.
+            SampleType delayedSample = myDelay.popSample(channel); // EN: Retrieve the delayed sample from the delay line.
                                                               // ES: Recupera la muestra retrasada desde la línea de delay.
 
             myDelay.pushSample(channel, inSamples[i]); // EN: Push the current input sample into the delay line.
@@ -72,12 +75,19 @@ void SimpleDelay3::process(juce::AudioBuffer<float>& buffer)
 
 // EN: Constructor for the SimpleDelay3 class. Initializes the object.
 // ES: Constructor de la clase SimpleDelay3. Inicializa el objeto.
-SimpleDelay3::SimpleDelay3()
+template <typename SampleType>
+SimpleDelay3_T<SampleType>::SimpleDelay3_T()
 {
 }
 
 // EN: Destructor for the SimpleDelay3 class. Cleans up resources.
 // ES: Destructor de la clase SimpleDelay3. Limpia los recursos.
-SimpleDelay3::~SimpleDelay3()
+template <typename SampleType>
+SimpleDelay3_T<SampleType>::~SimpleDelay3_T()
 {
-}
\ No newline at end of file
+}
+
+// EN: The two sample types the delay is built for.
+// ES: Los dos tipos de muestra para los que se compila el delay.
+template class SimpleDelay3_T<float>;
+template class SimpleDelay3_T<double>;
@@ -12,18 +12,20 @@
 //#include <JuceHeader.h>
 
 // EN: Declaration of the SimpleDelay3 class, which provides a simple delay effect.
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
 // ES: Declaración de la clase SimpleDelay3, que proporciona un efecto de delay simple.
-
-class SimpleDelay3
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class SimpleDelay3_T
 {
 public:
     // EN: Constructor for the SimpleDelay3 class.
     // ES: Constructor de la clase SimpleDelay3.
-    SimpleDelay3();
+    SimpleDelay3_T();
 
     // EN: Destructor for the SimpleDelay3 class.
     // ES: Destructor de la clase SimpleDelay3.
-    ~SimpleDelay3();
+    ~SimpleDelay3_T();
 
     // EN: Sets the delay time in seconds.
     // ES: Configura el tiempo de delay en segundos.
@@ -35,12 +37,12 @@ public:
 
     // EN: Processes the audio buffer, applying the delay effect to the signal.
     // ES: Procesa el búfer de audio, aplicando el efecto de delay a la señal.
-    void process(juce::AudioBuffer<float>& buffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
 
 private:
     // EN: JUCE's DelayLine object to handle the delay processing with linear interpolation.
     // ES: Objeto DelayLine de JUCE para manejar el procesamiento de delay con interpolación lineal.
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> myDelay{ 98000 };
+    juce::dsp::DelayLine<SampleType, juce::dsp::DelayLineInterpolationTypes::Linear> myDelay{ 98000 };
 
     // EN: Stores the sample rate for delay calculations.
     // ES: Almacena la frecuencia de muestreo para los cálculos de delay.
@@ -48,5 +50,9 @@ private:
 
     // EN: Stores the delay time in samples.
     // ES: Almacena el tiempo de delay en muestras.
-    float delay{};
-};
\ No newline at end of file
+    SampleType delay{};
+};
+
+// EN: The float version keeps the original name; SimpleDelay3_T<double> is the double version.
+// ES: La versión float conserva el nombre original; SimpleDelay3_T<double> es la versión double.
+using SimpleDelay3 = SimpleDelay3_T<float>;
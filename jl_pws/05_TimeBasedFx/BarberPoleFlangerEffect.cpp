@@ -58,55 +58,60 @@ float BarberpoleFlangerFX::generateSawtooth(float phase)
 // ES: Procesa el buffer de audio para aplicar el efecto Barberpole Flanger.
 void BarberpoleFlangerFX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // EN: Stores the current phase time for each channel's independent processing.
-    // ES: Almacena el tiempo de fase actual para el procesamiento independiente de cada canal.
     const float minRateHz = 0.1f; // EN: Minimum modulation rate in Hz.
     // ES: Tasa mínima de modulación en Hz.
     const float maxRateHz = 10.0f; // EN: Maximum modulation rate in Hz.
     // ES: Tasa máxima de modulación en Hz.
 
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    ratePercentage = targetRatePercentage; // EN: Updates the rate percentage for modulation.
+    // ES: Actualiza el porcentaje de velocidad para la modulación.
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz); // EN: Maps the percentage to Hz, once per block.
+    // ES: Mapea el porcentaje a Hz, una vez por bloque.
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2); // EN: Stereo circular buffer: extra channels are not processed.
+    // ES: Buffer circular estéreo: los canales extra no se procesan.
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t; // EN: Resets time for the current channel.
-        // ES: Reinicia el tiempo para el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        float phase = rateHz * t; // EN: Computes the phase based on rate and time (shared by the channels).
+        // ES: Calcula la fase basada en la velocidad y el tiempo (compartida por los canales).
+        float lfoValue = depth * generateSawtooth(phase) + predelay; // EN: Modulation value with depth and predelay.
+        // ES: Valor de modulación con profundidad y pre-delay.
+        float fracDelay = static_cast<float>(writterPointer) - lfoValue; // EN: Fractional delay computation.
+        // ES: Cálculo del retraso fraccionado.
+        if (fracDelay < 0) fracDelay += circularBufferSize;
+
+        int intDelay = static_cast<int>(fracDelay); // EN: Integer part of the delay.
+        // ES: Parte entera del retraso.
+        float frac = fracDelay - intDelay; // EN: Fractional part of the delay.
+        // ES: Parte fraccionaria del retraso.
+        int nextSampleIndex = intDelay + 1; // EN: Index of the next sample in the buffer.
+        // ES: Índice de la siguiente muestra en el buffer.
+        if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0;
+
+        for (int channel = 0; channel < numChannels; channel++)
         {
-            auto sample = buffer.getReadPointer(channel)[i]; // EN: Reads the current audio sample.
+            auto sample = channelData[channel][i]; // EN: Reads the current audio sample.
             // ES: Lee la muestra de audio actual.
-            ratePercentage = targetRatePercentage; // EN: Updates the rate percentage for modulation.
-            // ES: Actualiza el porcentaje de velocidad para la modulación.
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz); // EN: Maps the percentage to Hz.
-            // ES: Mapea el porcentaje a Hz.
-            float phase = rateHz * t; // EN: Computes the phase based on rate and time.
-            // ES: Calcula la fase basada en la velocidad y el tiempo.
-            float lfoValue = depth * generateSawtooth(phase) + predelay; // EN: Modulation value with depth and predelay.
-            // ES: Valor de modulación con profundidad y pre-delay.
-            float fracDelay = static_cast<float>(writterPointer[channel]) - lfoValue; // EN: Fractional delay computation.
-            // ES: Cálculo del retraso fraccionado.
-            if (fracDelay < 0) fracDelay += circularBufferSize;
-
-            int intDelay = static_cast<int>(fracDelay); // EN: Integer part of the delay.
-            // ES: Parte entera del retraso.
-            float frac = fracDelay - intDelay; // EN: Fractional part of the delay.
-            // ES: Parte fraccionaria del retraso.
-            int nextSampleIndex = intDelay + 1; // EN: Index of the next sample in the buffer.
-            // ES: Índice de la siguiente muestra en el buffer.
-            if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0;
-
             float delayedSample = (1.0f - frac) * circularBuffer[intDelay][channel]
                 + frac * circularBuffer[nextSampleIndex][channel]; // EN: Linear interpolation of delay samples.
             // ES: Interpolación lineal de las muestras retrasadas.
-            circularBuffer[writterPointer[channel]][channel] = sample; // EN: Writes the current sample to the circular buffer.
+            circularBuffer[writterPointer][channel] = sample; // EN: Writes the current sample to the circular buffer.
             // ES: Escribe la muestra actual en el buffer circular.
-            writterPointer[channel]++; // EN: Updates the writer pointer for the next sample.
-            // ES: Actualiza el puntero de escritura para la siguiente muestra.
-            if (writterPointer[channel] >= circularBufferSize) writterPointer[channel] = 0;
 
-            buffer.getWritePointer(channel)[i] = delayedSample; // EN: Writes the processed sample back to the buffer.
+            channelData[channel][i] = delayedSample; // EN: Writes the processed sample back to the buffer.
             // ES: Escribe la muestra procesada de vuelta al buffer.
-            t += 1.0f / sampleRate; // EN: Advances the time variable for the next sample.
-            // ES: Avanza la variable de tiempo para la siguiente muestra.
         }
+
+        writterPointer++; // EN: Updates the writer pointer for the next sample.
+        // ES: Actualiza el puntero de escritura para la siguiente muestra.
+        if (writterPointer >= circularBufferSize) writterPointer = 0;
+
+        t += 1.0f / sampleRate; // EN: Advances the time variable for the next sample.
+        // ES: Avanza la variable de tiempo para la siguiente muestra.
     }
 }
 
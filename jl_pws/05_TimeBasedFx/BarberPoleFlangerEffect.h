@@ -51,8 +51,8 @@ private:
                                                  // ES: Tamaño del buffer circular (muestras).
     float circularBuffer[circularBufferSize][2]; // EN: Stereo circular buffer for delay storage.
                                                  // ES: Buffer circular estéreo para almacenamiento del delay.
-    int writterPointer[2] = { 0, 0 }; // EN: Write pointers for each stereo channel.
-                                      // ES: Punteros de escritura para cada canal estéreo.
+    int writterPointer = 0; // EN: Write pointer shared by both stereo channels.
+                            // ES: Puntero de escritura compartido por ambos canales estéreo.
 
 // Private methods
     float generateSawtooth(float phase); // EN: Generates a sawtooth wave based on the input phase.
@@ -53,46 +53,52 @@ float BarberpoleFlanger2FX::generateSawtooth(float phase)
 // ES: Procesa el buffer de audio para aplicar el efecto Barberpole Flanger.
 void BarberpoleFlanger2FX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // EN: Save the current LFO time. | ES: Guarda el tiempo actual del LFO.
     const float minRateHz = 0.1f; // EN: Minimum LFO frequency in Hz. | ES: Frecuencia m�nima del LFO en Hz.
     const float maxRateHz = 10.0f; // EN: Maximum LFO frequency in Hz. | ES: Frecuencia m�xima del LFO en Hz.
 
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    // EN: Calculate the LFO rate based on the current rate percentage, once per block.
+    // ES: Calcula la velocidad del LFO basada en el porcentaje actual, una vez por bloque.
+    ratePercentage = targetRatePercentage;
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
+
+    // EN: The circular buffers and crossfades are stereo; extra channels are left untouched.
+    // ES: Los buffers circulares y los crossfades son estéreo; los canales extra no se modifican.
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t;
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            auto sample = buffer.getReadPointer(channel)[i];
+        float phase = rateHz * t;
 
-            // EN: Calculate the LFO rate based on the current rate percentage.
-            // ES: Calcula la velocidad del LFO basada en el porcentaje actual.
-            ratePercentage = targetRatePercentage;
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
-            float phase = rateHz * t;
+        // EN: Generate two LFO values for the two circular buffers, shared by both channels.
+        // ES: Genera dos valores de LFO para los dos buffers circulares, compartidos por ambos canales.
+        float lfoValue1 = depth * generateSawtooth(phase) + predelay;
+        float lfoValue2 = depth * generateSawtooth(phase + juce::MathConstants<float>::pi) + predelay;
 
-            // EN: Generate two LFO values for the two circular buffers.
-            // ES: Genera dos valores de LFO para los dos buffers circulares.
-            float lfoValue1 = depth * generateSawtooth(phase) + predelay;
-            float lfoValue2 = depth * generateSawtooth(phase + juce::MathConstants<float>::pi) + predelay;
+        // EN: Calculate fractional delays for both LFO values.
+        // ES: Calcula los retrasos fraccionales para ambos valores de LFO.
+        float fracDelay1 = static_cast<float>(writterPointer1) - lfoValue1;
+        float fracDelay2 = static_cast<float>(writterPointer2) - lfoValue2;
 
-            // EN: Calculate fractional delays for both LFO values.
-            // ES: Calcula los retrasos fraccionales para ambos valores de LFO.
-            float fracDelay1 = static_cast<float>(writterPointer1[channel]) - lfoValue1;
-            float fracDelay2 = static_cast<float>(writterPointer2[channel]) - lfoValue2;
+        if (fracDelay1 < 0) fracDelay1 += circularBufferSize;
+        if (fracDelay2 < 0) fracDelay2 += circularBufferSize;
 
-            if (fracDelay1 < 0) fracDelay1 += circularBufferSize;
-            if (fracDelay2 < 0) fracDelay2 += circularBufferSize;
+        int intDelay1 = static_cast<int>(fracDelay1);
+        int intDelay2 = static_cast<int>(fracDelay2);
+        float frac1 = fracDelay1 - intDelay1;
+        float frac2 = fracDelay2 - intDelay2;
 
-            int intDelay1 = static_cast<int>(fracDelay1);
-            int intDelay2 = static_cast<int>(fracDelay2);
-            float frac1 = fracDelay1 - intDelay1;
-            float frac2 = fracDelay2 - intDelay2;
+        int nextSampleIndex1 = intDelay1 + 1;
+        int nextSampleIndex2 = intDelay2 + 1;
 
-            int nextSampleIndex1 = intDelay1 + 1;
-            int nextSampleIndex2 = intDelay2 + 1;
+        if (nextSampleIndex1 >= circularBufferSize) nextSampleIndex1 = 0;
+        if (nextSampleIndex2 >= circularBufferSize) nextSampleIndex2 = 0;
 
-            if (nextSampleIndex1 >= circularBufferSize) nextSampleIndex1 = 0;
-            if (nextSampleIndex2 >= circularBufferSize) nextSampleIndex2 = 0;
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            auto sample = channelData[channel][i];
 
             // EN: Retrieve interpolated samples from the circular buffers.
             // ES: Recupera muestras interpoladas de los buffers circulares.
@@ -101,14 +107,8 @@ void BarberpoleFlanger2FX::process(juce::AudioBuffer<float>& buffer)
 
             // EN: Store the current sample in the circular buffers.
             // ES: Almacena la muestra actual en los buffers circulares.
-            circularBuffer1[writterPointer1[channel]][channel] = sample;
-            circularBuffer2[writterPointer2[channel]][channel] = sample;
-
-            writterPointer1[channel]++;
-            if (writterPointer1[channel] >= circularBufferSize) writterPointer1[channel] = 0;
-
-            writterPointer2[channel]++;
-            if (writterPointer2[channel] >= circularBufferSize) writterPointer2[channel] = 0;
+            circularBuffer1[writterPointer1][channel] = sample;
+            circularBuffer2[writterPointer2][channel] = sample;
 
             // EN: Compute the combined output sample using crossfade.
             // ES: Calcula la muestra de salida combinada utilizando crossfade.
@@ -116,12 +116,18 @@ void BarberpoleFlanger2FX::process(juce::AudioBuffer<float>& buffer)
 
             // EN: Write the output sample to the buffer.
             // ES: Escribe la muestra de salida en el buffer.
-            buffer.getWritePointer(channel)[i] = outputSample;
-
-            // EN: Increment the LFO time.
-            // ES: Incrementa el tiempo del LFO.
-            t += 1.0f / sampleRate;
+            channelData[channel][i] = outputSample;
         }
+
+        writterPointer1++;
+        if (writterPointer1 >= circularBufferSize) writterPointer1 = 0;
+
+        writterPointer2++;
+        if (writterPointer2 >= circularBufferSize) writterPointer2 = 0;
+
+        // EN: Increment the LFO time.
+        // ES: Incrementa el tiempo del LFO.
+        t += 1.0f / sampleRate;
     }
 }
 
@@ -83,13 +83,13 @@ private:
     // ES: Buffer circular est�reo para la segunda l�nea de delay.
     float circularBuffer2[circularBufferSize][2];
 
-    // EN: Writer pointers for each channel in the first circular buffer.
-    // ES: Punteros de escritura para cada canal en el primer buffer circular.
-    int writterPointer1[2] = { 0, 0 };
+    // EN: Writer pointer of the first circular buffer, shared by both channels.
+    // ES: Puntero de escritura del primer buffer circular, compartido por ambos canales.
+    int writterPointer1 = 0;
 
-    // EN: Writer pointers for each channel in the second circular buffer.
-    // ES: Punteros de escritura para cada canal en el segundo buffer circular.
-    int writterPointer2[2] = { 0, 0 };
+    // EN: Writer pointer of the second circular buffer, shared by both channels.
+    // ES: Puntero de escritura del segundo buffer circular, compartido por ambos canales.
+    int writterPointer2 = 0;
 
     // EN: Crossfade coefficients for the first delay line.
     // ES: Coeficientes de crossfade para la primera l�nea de delay.
@@ -19,6 +19,10 @@ void ChorusFX::prepare(double theSampleRate)
     ratePercentage = 0.0f;                          // EN: Initialize modulation rate percentage. / ES: Inicializa el porcentaje de modulaci�n.
     targetRatePercentage = 0.0f;                    // EN: Initialize the target modulation rate. / ES: Inicializa la velocidad de modulaci�n objetivo.
     predelay = 0.0f;                                // EN: Initialize pre-delay. / ES: Inicializa el pre-delay.
+
+    ensembleBuffer.assign(ensembleBufferSize, 0.0f); // EN: Allocate the shared ensemble buffer. / ES: Reserva el buffer compartido del ensemble.
+    ensembleWriteIndex = 0;
+    ensemblePhase = 0.0;
 }
 
 // EN: Sets the depth of the modulation effect.
@@ -42,44 +46,121 @@ void ChorusFX::setPredelay(float inPredelayMs)
     predelay = inPredelayMs * sampleRate / 1000.0f; // EN: Convert milliseconds to samples. / ES: Convierte milisegundos a muestras.
 }
 
+// EN: Sets the number of voices and spreads their phases and pans evenly.
+// ES: Ajusta el número de voces y reparte sus fases y paneos de forma uniforme.
+void ChorusFX::setNumVoices(int inNumVoices)
+{
+    numVoices = juce::jlimit(1, maxVoices, inNumVoices);
+
+    for (int v = 0; v < maxVoices; v++)
+    {
+        voicePhase[v] = static_cast<float>(v) / numVoices;
+        voicePan[v] = numVoices > 1 ? -1.0f + 2.0f * static_cast<float>(v) / (numVoices - 1) : 0.0f;
+    }
+
+    updateVoiceGains();
+}
+
+// EN: Stores the phase offset as a fraction of an LFO cycle.
+// ES: Guarda el desfase como una fracción de un ciclo del LFO.
+void ChorusFX::setVoicePhase(int voice, float inDegrees)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    voicePhase[voice] = juce::jlimit(0.0f, 360.0f, inDegrees) / 360.0f;
+}
+
+// EN: Sets the depth scale of a voice.
+// ES: Ajusta la escala de profundidad de una voz.
+void ChorusFX::setVoiceDepth(int voice, float inDepthScale)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    voiceDepth[voice] = juce::jmax(0.0f, inDepthScale);
+}
+
+// EN: Sets the pan of a voice.
+// ES: Ajusta el paneo de una voz.
+void ChorusFX::setVoicePan(int voice, float inPan)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    voicePan[voice] = juce::jlimit(-1.0f, 1.0f, inPan);
+    updateVoiceGains();
+}
+
+// EN: Sine pan law (like Pan_sineLaw) divided by sqrt(number of voices): the voices drift apart in time, so
+//     they add mostly in power rather than in amplitude.
+// ES: Ley de paneo del seno (como Pan_sineLaw) dividida por sqrt(número de voces): las voces se separan en el
+//     tiempo, así que se suman sobre todo en potencia y no en amplitud.
+void ChorusFX::updateVoiceGains()
+{
+    const float halfPi = juce::MathConstants<float>::halfPi;
+
+    for (int v = 0; v < maxVoices; v++)
+    {
+        const float panValue = (voicePan[v] + 1.0f) * 0.5f;
+        const float gain = v < numVoices ? 1.0f / std::sqrt(static_cast<float>(numVoices)) : 0.0f;
+
+        voiceLeftGain[v] = gain * std::sin((1.0f - panValue) * halfPi);
+        voiceRightGain[v] = gain * std::sin(panValue * halfPi);
+    }
+}
+
 // EN: Processes the audio buffer, applying the chorus effect.
 // ES: Procesa el buffer de audio aplicando el efecto de chorus.
 void ChorusFX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // EN: Store the previous LFO time to synchronize between channels. / ES: Almacena el tiempo anterior del LFO para sincronizar entre canales.
+    if (numVoices > 1 && !ensembleBuffer.empty())
+    {
+        processEnsemble(buffer);
+        return;
+    }
+
     const float minRateHz = 0.1f; // EN: Minimum modulation rate in Hz. / ES: Velocidad m�nima de modulaci�n en Hz.
     const float maxRateHz = 10.0f; // EN: Maximum modulation rate in Hz. / ES: Velocidad m�xima de modulaci�n en Hz.
 
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
-    {
-        t = old_t; // EN: Reset the LFO time for the current channel. / ES: Reinicia el tiempo del LFO para el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            auto sample = buffer.getReadPointer(channel)[i]; // EN: Read the current sample. / ES: Lee la muestra actual.
-            ratePercentage = targetRatePercentage; // EN: Update the modulation rate. / ES: Actualiza la velocidad de modulaci�n.
+    // EN: Compute the modulation rate in Hz once per block.
+    // ES: Calcula la velocidad de modulación en Hz una vez por bloque.
+    ratePercentage = targetRatePercentage;
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
 
-            // EN: Compute the modulation rate in Hz.
-            // ES: Calcula la velocidad de modulaci�n en Hz.
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
+    // EN: The buffer holds two channels; any extra channel is left untouched.
+    // ES: El buffer guarda dos canales; cualquier canal extra no se modifica.
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    // EN: Frame by frame: the LFO and the read position are computed once and used by every channel.
+    // ES: Trama a trama: el LFO y la posición de lectura se calculan una vez y los usan todos los canales.
+    for (int i = 0; i < buffer.getNumSamples(); i++)
+    {
+        // EN: Calculate the LFO value based on depth and rate.
+        // ES: Calcula el valor del LFO basado en la profundidad y la velocidad.
+        float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
 
-            // EN: Calculate the LFO value based on depth and rate.
-            // ES: Calcula el valor del LFO basado en la profundidad y la velocidad.
-            float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
+        // EN: Compute fractional delay including pre-delay.
+        // ES: Calcula el retardo fraccional incluyendo el pre-delay.
+        float fracDelay = static_cast<float>(writterPointer) - lfoValue - predelay;
 
-            // EN: Compute fractional delay including pre-delay.
-            // ES: Calcula el retardo fraccional incluyendo el pre-delay.
-            float fracDelay = static_cast<float>(writterPointer[channel]) - lfoValue - predelay;
+        // EN: Wrap the delay index if it goes negative.
+        // ES: Ajusta el �ndice de retardo si es negativo.
+        if (fracDelay < 0)
+            fracDelay += circularBufferSize;
 
-            // EN: Wrap the delay index if it goes negative.
-            // ES: Ajusta el �ndice de retardo si es negativo.
-            if (fracDelay < 0)
-                fracDelay += circularBufferSize;
+        int intDelay = static_cast<int>(fracDelay); // EN: Extract integer part of the delay. / ES: Extrae la parte entera del retardo.
+        float frac = fracDelay - intDelay; // EN: Extract fractional part. / ES: Extrae la parte fraccional.
+        int nextSampleIndex = intDelay + 1; // EN: Compute the index for the next sample. / ES: Calcula el �ndice de la siguiente muestra.
+        if (nextSampleIndex >= circularBufferSize)
+            nextSampleIndex = 0;
 
-            int intDelay = static_cast<int>(fracDelay); // EN: Extract integer part of the delay. / ES: Extrae la parte entera del retardo.
-            float frac = fracDelay - intDelay; // EN: Extract fractional part. / ES: Extrae la parte fraccional.
-            int nextSampleIndex = intDelay + 1; // EN: Compute the index for the next sample. / ES: Calcula el �ndice de la siguiente muestra.
-            if (nextSampleIndex >= circularBufferSize)
-                nextSampleIndex = 0;
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            auto sample = channelData[channel][i]; // EN: Read the current sample. / ES: Lee la muestra actual.
 
             // EN: Interpolate between two delayed samples.
             // ES: Interpola entre dos muestras retardadas.
@@ -87,28 +168,139 @@ void ChorusFX::process(juce::AudioBuffer<float>& buffer)
 
             // EN: Store the current sample in the circular buffer.
             // ES: Almacena la muestra actual en el buffer circular.
-            circularBuffer[writterPointer[channel]][channel] = sample;
-
-            // EN: Increment and wrap the write pointer.
-            // ES: Incrementa y ajusta el puntero de escritura.
-            writterPointer[channel]++;
-            if (writterPointer[channel] >= circularBufferSize)
-                writterPointer[channel] = 0;
+            circularBuffer[writterPointer][channel] = sample;
 
             // EN: Write the processed sample to the output buffer.
             // ES: Escribe la muestra procesada en el buffer de salida.
-            buffer.getWritePointer(channel)[i] = delayedSample;
+            channelData[channel][i] = delayedSample;
+        }
+
+        // EN: Increment and wrap the write pointer.
+        // ES: Incrementa y ajusta el puntero de escritura.
+        writterPointer++;
+        if (writterPointer >= circularBufferSize)
+            writterPointer = 0;
+
+        // EN: Increment the LFO time.
+        // ES: Incrementa el tiempo del LFO.
+        t += 1.0f / sampleRate;
+    }
+}
+
+// EN: Blocks of ensembleBlockSize samples:
+//     1. Writes the mono input into the shared buffer.
+//     2. Starts each voice's LFO phasor (cos, sin) from the phase accumulator plus its offset.
+//     3. Per sample, all lanes compute their delay (like the classic path: depth / 2 * sin + depth, plus the
+//        pre-delay), read the shared buffer with linear interpolation and add to the left/right sums; then the
+//        phasors rotate by one sample.
+// ES: Bloques de ensembleBlockSize muestras:
+//     1. Escribe la entrada mono en el buffer compartido.
+//     2. Inicia el fasor del LFO (cos, sin) de cada voz desde el acumulador de fase más su desfase.
+//     3. Por muestra, todos los carriles calculan su retardo (como el camino clásico: depth / 2 * sin + depth, más
+//        el pre-delay), leen el buffer compartido con interpolación lineal y suman a las salidas izquierda/derecha;
+//        después los fasores rotan una muestra.
+void ChorusFX::processEnsemble(juce::AudioBuffer<float>& buffer)
+{
+    const float minRateHz = 0.1f; // EN: Minimum modulation rate in Hz. / ES: Velocidad mínima de modulación en Hz.
+    const float maxRateHz = 10.0f; // EN: Maximum modulation rate in Hz. / ES: Velocidad máxima de modulación en Hz.
+
+    ratePercentage = targetRatePercentage;
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
+
+    const double phaseIncrement = rateHz / sampleRate;
+    const float omega = juce::MathConstants<float>::twoPi * rateHz / sampleRate;
+    const float cosOmega = std::cos(omega);
+    const float sinOmega = std::sin(omega);
+
+    const float maxDelay = static_cast<float>(circularBufferSize - 1);
+    const int mask = ensembleBufferSize - 1;
+    float* ring = ensembleBuffer.data();
+
+    const int numSamples = buffer.getNumSamples();
+    const bool isStereo = buffer.getNumChannels() > 1;
+    float* left = buffer.getWritePointer(0);
+    float* right = isStereo ? buffer.getWritePointer(1) : nullptr;
+
+    std::array<float, ensembleBlockSize> mono;
+    std::array<float, maxVoices> lfoCos, lfoSin, centre, swing, delayed;
+
+    for (int v = 0; v < maxVoices; v++)
+    {
+        swing[v] = 0.5f * depth * voiceDepth[v];
+        centre[v] = predelay + depth * voiceDepth[v];
+    }
 
-            // EN: Increment the LFO time.
-            // ES: Incrementa el tiempo del LFO.
-            t += 1.0f / sampleRate;
+    for (int start = 0; start < numSamples; start += ensembleBlockSize)
+    {
+        const int blockSize = juce::jmin(ensembleBlockSize, numSamples - start);
+
+        for (int i = 0; i < blockSize; i++)
+            mono[i] = isStereo ? 0.5f * (left[start + i] + right[start + i]) : left[start + i];
+
+        DelayLineBlock::write(ring, ensembleBufferSize, ensembleWriteIndex, mono.data(), blockSize);
+
+        for (int v = 0; v < maxVoices; v++)
+        {
+            const double angle = juce::MathConstants<double>::twoPi * (ensemblePhase + voicePhase[v]);
+            lfoCos[v] = static_cast<float>(std::cos(angle));
+            lfoSin[v] = static_cast<float>(std::sin(angle));
         }
+
+        for (int i = 0; i < blockSize; i++)
+        {
+            for (int v = 0; v < maxVoices; v++)
+            {
+                const float position = static_cast<float>(ensembleWriteIndex + i) - juce::jlimit(0.0f, maxDelay, centre[v] + swing[v] * lfoSin[v]);
+                const float floorPosition = std::floor(position);
+                const int index = static_cast<int>(floorPosition);
+                const float frac = position - floorPosition;
+                const float a = ring[index & mask];
+                const float b = ring[(index + 1) & mask];
+
+                delayed[v] = a + frac * (b - a);
+            }
+
+            float outLeft = 0.0f;
+            float outRight = 0.0f;
+
+            for (int v = 0; v < maxVoices; v++)
+            {
+                outLeft += voiceLeftGain[v] * delayed[v];
+                outRight += voiceRightGain[v] * delayed[v];
+            }
+
+            if (isStereo)
+            {
+                left[start + i] = outLeft;
+                right[start + i] = outRight;
+            }
+            else
+            {
+                left[start + i] = 0.5f * (outLeft + outRight);
+            }
+
+            for (int v = 0; v < maxVoices; v++)
+            {
+                const float c = lfoCos[v] * cosOmega - lfoSin[v] * sinOmega;
+                lfoSin[v] = lfoSin[v] * cosOmega + lfoCos[v] * sinOmega;
+                lfoCos[v] = c;
+            }
+        }
+
+        ensembleWriteIndex = (ensembleWriteIndex + blockSize) & mask;
+
+        ensemblePhase += phaseIncrement * blockSize;
+        ensemblePhase -= std::floor(ensemblePhase);
     }
 }
 
 // EN: Constructor for the ChorusFX class.
 // ES: Constructor de la clase ChorusFX.
-ChorusFX::ChorusFX() {}
+ChorusFX::ChorusFX()
+{
+    voiceDepth.fill(1.0f);
+    setNumVoices(1);
+}
 
 // EN: Destructor for the ChorusFX class.
 // ES: Destructor de la clase ChorusFX.
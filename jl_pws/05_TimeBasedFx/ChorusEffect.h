@@ -10,7 +10,20 @@
 
 #pragma once
 //#include <JuceHeader.h>
+#include <array>
+#include <vector>
 
+// EN: ChorusFX reads one modulated tap per channel. With setNumVoices(2..8) it switches to an ensemble: every voice
+//     reads the mono input from one shared circular buffer with its own LFO phase, depth and pan. The voices are
+//     processed as 8 fixed lanes (unused voices have zero gain) so the delay, read position and pan math of all
+//     voices runs in one loop the compiler can vectorize, and the LFOs are rotating phasors started once per
+//     block from a phase accumulator instead of one sin() per sample and voice.
+// ES: ChorusFX lee una toma modulada por canal. Con setNumVoices(2..8) pasa a ser un ensemble: cada voz lee la
+//     entrada mono desde un único buffer circular compartido con su propia fase de LFO, profundidad y paneo. Las
+//     voces se procesan como 8 carriles fijos (las voces sin usar tienen ganancia cero) para que las cuentas de
+//     retardo, posición de lectura y paneo de todas las voces se hagan en un bucle que el compilador puede
+//     vectorizar, y los LFO son fasores que rotan, iniciados una vez por bloque desde un acumulador de fase en
+//     vez de un sin() por muestra y voz.
 class ChorusFX
 {
 public:
@@ -33,11 +46,39 @@ public:
     // ES: Ajusta el retardo inicial (pre-delay).
     void setPredelay(float inPredelay);
 
+    // EN: Sets the number of voices (1 is the classic chorus, 2 to 8 the ensemble). Spreads the voice phases over
+    //     one cycle and the pans from left to right, so call it before the per-voice setters.
+    // ES: Ajusta el número de voces (1 es el chorus clásico, 2 a 8 el ensemble). Reparte las fases de las voces en
+    //     un ciclo y los paneos de izquierda a derecha, así que debe llamarse antes de los ajustes por voz.
+    void setNumVoices(int inNumVoices);
+
+    // EN: Sets the LFO phase offset of a voice in degrees.
+    // ES: Ajusta el desfase del LFO de una voz en grados.
+    void setVoicePhase(int voice, float inDegrees);
+
+    // EN: Sets the depth of a voice relative to setDepth (1 keeps the global depth).
+    // ES: Ajusta la profundidad de una voz relativa a setDepth (1 mantiene la profundidad global).
+    void setVoiceDepth(int voice, float inDepthScale);
+
+    // EN: Sets the pan of a voice, from -1 (left) to 1 (right).
+    // ES: Ajusta el paneo de una voz, de -1 (izquierda) a 1 (derecha).
+    void setVoicePan(int voice, float inPan);
+
     // EN: Processes the audio buffer applying the chorus effect.
     // ES: Procesa el buffer de audio aplicando el efecto de chorus.
     void process(juce::AudioBuffer<float>& buffer);
 
+    static constexpr int maxVoices = 8;
+
 private:
+    // EN: Ensemble path: writes the mono input once and sums every voice into the first two channels.
+    // ES: Camino ensemble: escribe la entrada mono una vez y suma cada voz en los dos primeros canales.
+    void processEnsemble(juce::AudioBuffer<float>& buffer);
+
+    // EN: Recomputes the pan gains of the voices (zero for the unused lanes).
+    // ES: Recalcula las ganancias de paneo de las voces (cero para los carriles sin usar).
+    void updateVoiceGains();
+
     float sampleRate;                  // EN: Sample rate / ES: Frecuencia de muestreo
     float depth;                       // EN: Modulation depth / ES: Profundidad de modulaci�n
     float ratePercentage;              // EN: Modulation rate percentage / ES: Porcentaje de la velocidad de modulaci�n
@@ -47,5 +88,18 @@ private:
 
     static const int circularBufferSize = 48000; // EN: Circular buffer size / ES: Tama�o del buffer circular
     float circularBuffer[circularBufferSize][2]; // EN: Stereo circular buffer / ES: Buffer circular est�reo
-    int writterPointer[2] = { 0, 0 };            // EN: Write pointers for each channel / ES: Punteros de escritura para cada canal
+    int writterPointer = 0;                      // EN: Write pointer shared by both channels / ES: Puntero de escritura compartido por ambos canales
+
+    static constexpr int ensembleBlockSize = 64;      // EN: Samples per ensemble block / ES: Muestras por bloque del ensemble
+    static constexpr int ensembleBufferSize = 65536;  // EN: Shared mono buffer size (power of two) / ES: Tamaño del buffer mono compartido (potencia de dos)
+    std::vector<float> ensembleBuffer;                // EN: Shared mono circular buffer / ES: Buffer circular mono compartido
+    int ensembleWriteIndex{ 0 };                      // EN: Write index of the shared buffer / ES: Índice de escritura del buffer compartido
+    double ensemblePhase{ 0.0 };                      // EN: LFO phase accumulator in cycles / ES: Acumulador de fase del LFO en ciclos
+
+    int numVoices{ 1 };                               // EN: Number of voices / ES: Número de voces
+    std::array<float, maxVoices> voicePhase{};        // EN: LFO phase offset of each voice in cycles / ES: Desfase del LFO de cada voz en ciclos
+    std::array<float, maxVoices> voiceDepth{};        // EN: Depth scale of each voice / ES: Escala de profundidad de cada voz
+    std::array<float, maxVoices> voicePan{};          // EN: Pan of each voice / ES: Paneo de cada voz
+    std::array<float, maxVoices> voiceLeftGain{};     // EN: Left gain of each lane / ES: Ganancia izquierda de cada carril
+    std::array<float, maxVoices> voiceRightGain{};    // EN: Right gain of each lane / ES: Ganancia derecha de cada carril
 };
\ No newline at end of file
@@ -54,49 +54,54 @@ void FeedbackFlangerFX::setFeedback(float inFeedback)
 // ES: El m�todo process aplica el efecto de flanger con retroalimentaci�n al buffer de audio, modificando cada muestra seg�n la modulaci�n y retroalimentaci�n.
 void FeedbackFlangerFX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t;  // Guardar el valor de t para no sobrescribirlo antes de usarlo
     const float minRateHz = 0.1f;  // Tasa m�nima en Hz
     const float maxRateHz = 10.0f;  // Tasa m�xima en Hz
 
-    // Iterar a trav�s de todos los canales
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    ratePercentage = targetRatePercentage;  // Usar la tasa objetivo
+
+    // Calcular la frecuencia de modulación en Hz, una vez por bloque
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
+
+    // Solo hay dos canales en el buffer circular; los canales extra no se modifican
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    // Iterar a través de todas las muestras; la LFO y el delay de cada trama sirven para todos los canales
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t;  // Restaurar el valor de t para cada canal
-        // Iterar a trav�s de todas las muestras del buffer
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            auto sample = buffer.getReadPointer(channel)[i];  // Obtener la muestra de entrada
-            ratePercentage = targetRatePercentage;  // Usar la tasa objetivo
+        // Calcular el valor de la LFO (Low Frequency Oscillator) usando la sinusoide
+        float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
 
-            // Calcular la frecuencia de modulaci�n en Hz
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
-            // Calcular el valor de la LFO (Low Frequency Oscillator) usando la sinusoide
-            float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
+        // Calcular el valor del delay con el efecto LFO y el predelay
+        float fracDelay = static_cast<float>(writterPointer) - lfoValue - predelay;
+        if (fracDelay < 0) fracDelay += circularBufferSize;  // Asegurarse de que fracDelay no sea negativo
 
-            // Calcular el valor del delay con el efecto LFO y el predelay
-            float fracDelay = static_cast<float>(writterPointer[channel]) - lfoValue - predelay;
-            if (fracDelay < 0) fracDelay += circularBufferSize;  // Asegurarse de que fracDelay no sea negativo
+        int intDelay = static_cast<int>(fracDelay);  // Parte entera del delay
+        float frac = fracDelay - intDelay;  // Parte fraccionaria del delay
+        int nextSampleIndex = intDelay + 1;  // �ndice de la muestra siguiente
+        if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0;  // Manejar el caso de ciclo
 
-            int intDelay = static_cast<int>(fracDelay);  // Parte entera del delay
-            float frac = fracDelay - intDelay;  // Parte fraccionaria del delay
-            int nextSampleIndex = intDelay + 1;  // �ndice de la muestra siguiente
-            if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0;  // Manejar el caso de ciclo
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            auto sample = channelData[channel][i];  // Obtener la muestra de entrada
 
             // Interpolar entre las dos muestras de la se�al retrasada (por el delay fraccionado)
             float delayedSample = (1.0f - frac) * circularBuffer[intDelay][channel] + frac * circularBuffer[nextSampleIndex][channel];
 
             // Almacenar la muestra procesada con la retroalimentaci�n en el buffer circular
-            circularBuffer[writterPointer[channel]][channel] = sample + delayedSample * feedback;
-
-            // Avanzar el puntero de escritura
-            writterPointer[channel]++;
-            if (writterPointer[channel] >= circularBufferSize) writterPointer[channel] = 0;
+            circularBuffer[writterPointer][channel] = sample + delayedSample * feedback;
 
             // Escribir la muestra procesada en el buffer de salida
-            buffer.getWritePointer(channel)[i] = delayedSample;
-
-            t += 1.0f / sampleRate;  // Incrementar el tiempo
+            channelData[channel][i] = delayedSample;
         }
+
+        // Avanzar el puntero de escritura
+        writterPointer++;
+        if (writterPointer >= circularBufferSize) writterPointer = 0;
+
+        t += 1.0f / sampleRate;  // Incrementar el tiempo
     }
 }
 
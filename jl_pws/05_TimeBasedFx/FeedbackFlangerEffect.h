@@ -82,7 +82,7 @@ private:
     static const int circularBufferSize = 48000; // Tama�o del buffer circular
     float circularBuffer[circularBufferSize][2]; // Buffer circular est�reo
 
-    // EN: Write pointers for each channel (left and right channels)
-    // ES: Punteros de escritura para cada canal (canal izquierdo y derecho)
-    int writterPointer[2] = { 0, 0 };            // Punteros de escritura para cada canal
+    // EN: Write pointer shared by both channels (left and right channels)
+    // ES: Puntero de escritura compartido por ambos canales (canal izquierdo y derecho)
+    int writterPointer = 0;                      // Puntero de escritura compartido
 };
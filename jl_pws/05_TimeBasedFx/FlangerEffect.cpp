@@ -60,38 +60,44 @@ void FlangerFX::setPredelay(float inPredelayMs)
 //     El resultado se escribe de vuelta en el b�fer, reemplazando la se�al original.
 void FlangerFX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // EN: Save the current time to avoid changes during processing. // ES: Guarda el tiempo actual para evitar cambios durante el procesamiento.
     const float minRateHz = 0.1f; // EN: Minimum modulation rate in Hz. // ES: Tasa m�nima de modulaci�n en Hz.
     const float maxRateHz = 5.0f; // EN: Maximum modulation rate in Hz. // ES: Tasa m�xima de modulaci�n en Hz.
 
-    // EN: Loop through all channels in the audio buffer. // ES: Recorre todos los canales en el b�fer de audio.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    ratePercentage = targetRatePercentage; // EN: Set the current rate percentage to the target rate percentage. // ES: Establece el porcentaje de la tasa actual al porcentaje de la tasa objetivo.
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz); // EN: Calculate the modulation rate in Hz once per block. // ES: Calcula la tasa de modulación en Hz una vez por bloque.
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2); // EN: The circular buffer is stereo; extra channels are left untouched. // ES: El búfer circular es estéreo; los canales extra no se modifican.
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    // EN: Loop through all samples; the LFO and the read position of each frame are shared by the channels. // ES: Recorre todas las muestras; el LFO y la posición de lectura de cada trama se comparten entre los canales.
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t; // EN: Restore the saved time for each channel. // ES: Restaura el tiempo guardado para cada canal.
-        // EN: Loop through all samples in the current channel. // ES: Recorre todas las muestras en el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth; // EN: Generate the LFO value based on the rate and depth. // ES: Genera el valor LFO basado en la tasa y profundidad.
+        float fracDelay = static_cast<float>(writterPointer) - lfoValue - predelay; // EN: Calculate the fractional delay using the LFO value and predelay. // ES: Calcula el retardo fraccionario usando el valor LFO y el predelay.
+        if (fracDelay < 0) fracDelay += circularBufferSize; // EN: Wrap around if the delay goes below 0. // ES: Vuelve al principio si el retardo es menor que 0.
+
+        int intDelay = static_cast<int>(fracDelay); // EN: Get the integer part of the delay. // ES: Obtiene la parte entera del retardo.
+        float frac = fracDelay - intDelay; // EN: Get the fractional part of the delay. // ES: Obtiene la parte fraccionaria del retardo.
+        int nextSampleIndex = intDelay + 1; // EN: Get the next sample index in the buffer. // ES: Obtiene el �ndice de la siguiente muestra en el b�fer.
+        if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0; // EN: Wrap around to the beginning of the buffer if necessary. // ES: Vuelve al principio del b�fer si es necesario.
+
+        for (int channel = 0; channel < numChannels; channel++)
         {
-            auto sample = buffer.getReadPointer(channel)[i]; // EN: Read the current sample from the buffer. // ES: Lee la muestra actual del b�fer.
-            ratePercentage = targetRatePercentage; // EN: Set the current rate percentage to the target rate percentage. // ES: Establece el porcentaje de la tasa actual al porcentaje de la tasa objetivo.
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz); // EN: Calculate the modulation rate in Hz. // ES: Calcula la tasa de modulaci�n en Hz.
-            float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth; // EN: Generate the LFO value based on the rate and depth. // ES: Genera el valor LFO basado en la tasa y profundidad.
-            float fracDelay = static_cast<float>(writterPointer[channel]) - lfoValue - predelay; // EN: Calculate the fractional delay using the LFO value and predelay. // ES: Calcula el retardo fraccionario usando el valor LFO y el predelay.
-            if (fracDelay < 0) fracDelay += circularBufferSize; // EN: Wrap around if the delay goes below 0. // ES: Vuelve al principio si el retardo es menor que 0.
-
-            int intDelay = static_cast<int>(fracDelay); // EN: Get the integer part of the delay. // ES: Obtiene la parte entera del retardo.
-            float frac = fracDelay - intDelay; // EN: Get the fractional part of the delay. // ES: Obtiene la parte fraccionaria del retardo.
-            int nextSampleIndex = intDelay + 1; // EN: Get the next sample index in the buffer. // ES: Obtiene el �ndice de la siguiente muestra en el b�fer.
-            if (nextSampleIndex >= circularBufferSize) nextSampleIndex = 0; // EN: Wrap around to the beginning of the buffer if necessary. // ES: Vuelve al principio del b�fer si es necesario.
+            auto sample = channelData[channel][i]; // EN: Read the current sample from the buffer. // ES: Lee la muestra actual del b�fer.
 
             // EN: Get the delayed sample by interpolating between the two surrounding samples. // ES: Obtiene la muestra retardada interpolando entre las dos muestras adyacentes.
             float delayedSample = (1.0f - frac) * circularBuffer[intDelay][channel] + frac * circularBuffer[nextSampleIndex][channel];
-            circularBuffer[writterPointer[channel]][channel] = sample; // EN: Store the current sample in the circular buffer. // ES: Almacena la muestra actual en el b�fer circular.
-            writterPointer[channel]++; // EN: Move the write pointer forward. // ES: Avanza el puntero de escritura.
-            if (writterPointer[channel] >= circularBufferSize) writterPointer[channel] = 0; // EN: Wrap the write pointer around to the beginning if necessary. // ES: Vuelve al principio del b�fer si es necesario.
+            circularBuffer[writterPointer][channel] = sample; // EN: Store the current sample in the circular buffer. // ES: Almacena la muestra actual en el b�fer circular.
 
-            buffer.getWritePointer(channel)[i] = delayedSample; // EN: Write the delayed sample back into the buffer. // ES: Escribe la muestra retardada de vuelta en el b�fer.
-            t += 1.0f / sampleRate; // EN: Increment time based on sample rate. // ES: Incrementa el tiempo seg�n la frecuencia de muestreo.
+            channelData[channel][i] = delayedSample; // EN: Write the delayed sample back into the buffer. // ES: Escribe la muestra retardada de vuelta en el b�fer.
         }
+
+        writterPointer++; // EN: Move the write pointer forward. // ES: Avanza el puntero de escritura.
+        if (writterPointer >= circularBufferSize) writterPointer = 0; // EN: Wrap the write pointer around to the beginning if necessary. // ES: Vuelve al principio del b�fer si es necesario.
+
+        t += 1.0f / sampleRate; // EN: Increment time based on sample rate. // ES: Incrementa el tiempo seg�n la frecuencia de muestreo.
     }
 }
 
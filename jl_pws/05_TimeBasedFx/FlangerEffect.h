@@ -91,7 +91,7 @@ private:
     //     El b�fer almacena datos de audio para los canales izquierdo y derecho.
     float circularBuffer[circularBufferSize][2];
 
-    // EN: Write pointers for both left and right channels, to keep track of the current position in the buffer.
-    // ES: Punteros de escritura para los canales izquierdo y derecho, para hacer un seguimiento de la posici�n actual en el b�fer.
-    int writterPointer[2] = { 0, 0 };
+    // EN: Write pointer shared by the left and right channels, to keep track of the current position in the buffer.
+    // ES: Puntero de escritura compartido por los canales izquierdo y derecho, para hacer un seguimiento de la posición actual en el búfer.
+    int writterPointer = 0;
 };
@@ -0,0 +1,265 @@
+/*
+  ==============================================================================
+
+    PhaserEffect.cpp
+    Created: 19 Oct 2026 3:00:10am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "PhaserEffect.h"
+
+// EN: Constructor of PhaserEffect class.
+// ES: Constructor de la clase PhaserEffect.
+PhaserEffect::PhaserEffect()
+{
+}
+
+// EN: Destructor of PhaserEffect class.
+// ES: Destructor de la clase PhaserEffect.
+PhaserEffect::~PhaserEffect()
+{
+}
+
+// EN: Stores the sample rate and allocates one coefficient per sample and channel for the largest block.
+// ES: Guarda la frecuencia de muestreo y reserva un coeficiente por muestra y canal para el bloque más grande.
+void PhaserEffect::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    sampleRate = inSampleRate;
+    maxBlockSize = juce::jmax(1, inSamplesPerBlock);
+    numChannels = juce::jlimit(1, maxChannels, inChannels);
+
+    coefficients.assign(static_cast<size_t>(maxBlockSize * maxChannels), 0.0f);
+
+    for (auto& ramp : coefficientRamp)
+        ramp.setInterval(controlInterval);
+
+    updateRotation();
+    reset();
+}
+
+// EN: Clears the filter memory and restarts the LFO; the first sample is a control tick.
+// ES: Limpia la memoria del filtro y reinicia el LFO; la primera muestra es un tick de control.
+void PhaserEffect::reset()
+{
+    for (auto& stage : state)
+        for (auto& s : stage)
+            s = 0.0f;
+
+    for (auto& y : lastOutput)
+        y = 0.0f;
+
+    coefficientRamp[0].reset(getCoefficient(0.0));
+    coefficientRamp[1].reset(getCoefficient(offsetSine));
+
+    // EN: The phasor starts at the last sample of the first control interval.
+    // ES: El fasor empieza en la última muestra del primer intervalo de control.
+    const double angle = juce::MathConstants<double>::twoPi * rateHz * (controlInterval - 1) / sampleRate;
+    lfoSine = std::sin(angle);
+    lfoCosine = std::cos(angle);
+}
+
+// EN: Sets the number of allpass stages.
+// ES: Establece el número de etapas pasa todo.
+void PhaserEffect::setNumStages(int inNumStages)
+{
+    const int newNumStages = juce::jlimit(2, maxStages, inNumStages);
+
+    // EN: Stages that are switched back on start from silence instead of an old state.
+    // ES: Las etapas que se vuelven a activar empiezan desde silencio en vez de un estado antiguo.
+    for (int k = numStages; k < newNumStages; k++)
+        for (auto& s : state[k])
+            s = 0.0f;
+
+    numStages = newNumStages;
+}
+
+// EN: Sets the LFO rate in Hz.
+// ES: Establece la velocidad del LFO en Hz.
+void PhaserEffect::setRate(float inRateHz)
+{
+    rateHz = juce::jmax(0.0f, inRateHz);
+    updateRotation();
+}
+
+// EN: Sets the sweep depth.
+// ES: Establece la profundidad del barrido.
+void PhaserEffect::setDepth(float inDepth)
+{
+    depth = juce::jlimit(0.0f, 1.0f, inDepth);
+}
+
+// EN: Sets the frequency range of the sweep.
+// ES: Establece el rango de frecuencias del barrido.
+void PhaserEffect::setFrequencyRange(float inMinHz, float inMaxHz)
+{
+    minFrequency = juce::jmax(1.0f, juce::jmin(inMinHz, inMaxHz));
+    maxFrequency = juce::jmax(minFrequency, juce::jmax(inMinHz, inMaxHz));
+}
+
+// EN: Sets the feedback. The allpass chain has unity gain, so any value below 1 keeps the loop stable.
+// ES: Establece la realimentación. La cadena pasa todo tiene ganancia unitaria, así que cualquier valor menor que 1 mantiene el lazo estable.
+void PhaserEffect::setFeedback(float inFeedback)
+{
+    feedback = juce::jlimit(-0.95f, 0.95f, inFeedback);
+}
+
+// EN: Stores the offset as a fraction of an LFO cycle.
+// ES: Guarda el desfase como una fracción de un ciclo del LFO.
+void PhaserEffect::setStereoOffset(float inDegrees)
+{
+    stereoOffset = juce::jlimit(0.0f, 360.0f, inDegrees) / 360.0f;
+
+    const double angle = juce::MathConstants<double>::twoPi * stereoOffset;
+    offsetSine = std::sin(angle);
+    offsetCosine = std::cos(angle);
+}
+
+// EN: Sets the dry/wet mix.
+// ES: Establece la mezcla seco/húmedo.
+void PhaserEffect::setMix(float inMix)
+{
+    mix = juce::jlimit(0.0f, 1.0f, inMix);
+}
+
+// EN: Sets the control interval of both coefficients; it applies from the next control tick, so the phasor moves to
+//     the last sample of the new interval.
+// ES: Establece el intervalo de control de ambos coeficientes; se aplica desde el siguiente tick de control, así el
+//     fasor se mueve a la última muestra del nuevo intervalo.
+void PhaserEffect::setControlInterval(int inControlInterval)
+{
+    const int newControlInterval = juce::jmax(1, inControlInterval);
+    const double angle = juce::MathConstants<double>::twoPi * rateHz * (newControlInterval - controlInterval) / sampleRate;
+    const double sine = lfoSine * std::cos(angle) + lfoCosine * std::sin(angle);
+
+    lfoCosine = lfoCosine * std::cos(angle) - lfoSine * std::sin(angle);
+    lfoSine = sine;
+    controlInterval = newControlInterval;
+
+    for (auto& ramp : coefficientRamp)
+        ramp.setInterval(controlInterval);
+
+    updateRotation();
+}
+
+// EN: The phasor turns by 2 pi rate / fs per sample, so one control interval is interval times that angle.
+// ES: El fasor gira 2 pi rate / fs por muestra, así un intervalo de control es interval veces ese ángulo.
+void PhaserEffect::updateRotation()
+{
+    const double angle = juce::MathConstants<double>::twoPi * rateHz * controlInterval / sampleRate;
+    rotationSine = std::sin(angle);
+    rotationCosine = std::cos(angle);
+}
+
+// EN: The sweep is exponential, so the LFO moves the notches evenly in pitch. The coefficient of a
+//     first-order allpass with break frequency fc is g = (tan(pi fc / fs) - 1) / (tan(pi fc / fs) + 1).
+// ES: El barrido es exponencial, así el LFO mueve las muescas de forma uniforme en altura. El coeficiente de un
+//     pasa todo de primer orden con frecuencia de quiebre fc es g = (tan(pi fc / fs) - 1) / (tan(pi fc / fs) + 1).
+float PhaserEffect::getCoefficient(double sine) const
+{
+    const double lfo = 0.5 + 0.5 * depth * sine;
+    const double hz = juce::jmin(minFrequency * std::pow(static_cast<double>(maxFrequency) / minFrequency, lfo), 0.45 * sampleRate);
+    const double t = std::tan(juce::MathConstants<double>::pi * hz / sampleRate);
+
+    return static_cast<float>((t - 1.0) / (t + 1.0));
+}
+
+// EN: The phasor sits at the last sample of the next control interval, where the ramps reach their targets, so with
+//     an interval of 1 every sample gets its own coefficients. The right channel is the left phasor rotated by the
+//     stereo offset; it only costs an evaluation when it is processed, otherwise its ramp just stays in step.
+//     The phasor is renormalised at each tick so rounding never changes its amplitude.
+// ES: El fasor está en la última muestra del siguiente intervalo de control, donde las rampas alcanzan sus objetivos,
+//     así con un intervalo de 1 cada muestra recibe sus propios coeficientes. El canal derecho es el fasor izquierdo
+//     rotado por el desfase estéreo; solo cuesta una evaluación cuando se procesa, si no su rampa solo sigue el paso.
+//     El fasor se renormaliza en cada tick para que el redondeo nunca cambie su amplitud.
+void PhaserEffect::updateCoefficients(int channels)
+{
+    const float left = getCoefficient(lfoSine);
+    coefficientRamp[0].setTarget(left);
+
+    if (channels > 1)
+        coefficientRamp[1].setTarget(getCoefficient(lfoSine * offsetCosine + lfoCosine * offsetSine));
+    else
+        coefficientRamp[1].setTarget(left);
+
+    const double sine = lfoSine * rotationCosine + lfoCosine * rotationSine;
+    const double cosine = lfoCosine * rotationCosine - lfoSine * rotationSine;
+    const double gain = 1.5 - 0.5 * (sine * sine + cosine * cosine);
+
+    lfoSine = sine * gain;
+    lfoCosine = cosine * gain;
+}
+
+// EN: Renders the ramps in runs that never cross a control tick.
+// ES: Genera las rampas en tramos que nunca cruzan un tick de control.
+void PhaserEffect::renderCoefficients(int numSamples, int channels)
+{
+    for (int start = 0; start < numSamples;)
+    {
+        if (coefficientRamp[0].getSamplesToTick() == 0)
+            updateCoefficients(channels);
+
+        const int n = juce::jmin(numSamples - start, coefficientRamp[0].getSamplesToTick());
+
+        for (int channel = 0; channel < channels; channel++)
+            coefficientRamp[channel].render(coefficients.data() + channel * maxBlockSize + start, n);
+
+        start += n;
+    }
+}
+
+// EN: Processes the buffer in chunks of at most maxBlockSize samples. Each sample goes through all the stages
+//     with both channels side by side: y = g x + s, s = x - g y (DirectFormII_APF with a single state).
+// ES: Procesa el buffer en trozos de como máximo maxBlockSize muestras. Cada muestra pasa por todas las etapas
+//     con ambos canales lado a lado: y = g x + s, s = x - g y (DirectFormII_APF con un único estado).
+void PhaserEffect::process(juce::AudioBuffer<float>& buffer)
+{
+    const int totalSamples = buffer.getNumSamples();
+    const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+
+    if (maxBlockSize == 0)
+        return;
+
+    float* data[maxChannels] = {};
+    for (int channel = 0; channel < channels; channel++)
+        data[channel] = buffer.getWritePointer(channel);
+
+    for (int start = 0; start < totalSamples; start += maxBlockSize)
+    {
+        const int numSamples = juce::jmin(maxBlockSize, totalSamples - start);
+        renderCoefficients(numSamples, channels);
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            float g[maxChannels];
+            for (int channel = 0; channel < maxChannels; channel++)
+                g[channel] = coefficients[static_cast<size_t>(channel * maxBlockSize + i)];
+
+            float dry[maxChannels] = {};
+            float x[maxChannels];
+
+            for (int channel = 0; channel < channels; channel++)
+                dry[channel] = data[channel][start + i];
+
+            for (int channel = 0; channel < maxChannels; channel++)
+                x[channel] = dry[channel] + feedback * lastOutput[channel];
+
+            for (int k = 0; k < numStages; k++)
+            {
+                for (int channel = 0; channel < maxChannels; channel++)
+                {
+                    const float y = g[channel] * x[channel] + state[k][channel];
+                    state[k][channel] = x[channel] - g[channel] * y;
+                    x[channel] = y;
+                }
+            }
+
+            for (int channel = 0; channel < maxChannels; channel++)
+                lastOutput[channel] = x[channel];
+
+            for (int channel = 0; channel < channels; channel++)
+                data[channel][start + i] = (1.0f - mix) * dry[channel] + mix * x[channel];
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    PhaserEffect.h
+    Created: 19 Oct 2026 3:00:10am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: PhaserEffect chains 2 to 24 first-order allpass stages (the same section as DirectFormII_APF,
+//     H(z) = (g + z^-1) / (1 + g z^-1)) whose break frequency is swept by an internal LFO, with optional
+//     feedback from the last stage to the input. It replaces a bank of individual APF objects.
+//     The LFO is a rotating phasor and the allpass coefficient is computed from it once per control interval,
+//     then ramped linearly with ControlRateRamp into a buffer, one value per sample and channel. The stage states
+//     are packed as [stage][channel] so both channels advance through each stage together in one short loop that
+//     the compiler can vectorize.
+// ES: PhaserEffect encadena de 2 a 24 etapas pasa todo de primer orden (la misma sección que DirectFormII_APF,
+//     H(z) = (g + z^-1) / (1 + g z^-1)) cuya frecuencia de quiebre se barre con un LFO interno, con
+//     realimentación opcional de la última etapa a la entrada. Reemplaza un banco de objetos APF individuales.
+//     El LFO es un fasor que rota y el coeficiente pasa todo se calcula a partir de él una vez por intervalo de
+//     control, y luego se lleva en rampa lineal con ControlRateRamp a un buffer, un valor por muestra y canal. Los
+//     estados de las etapas se agrupan como [etapa][canal] para que ambos canales avancen juntos por cada etapa en
+//     un bucle corto que el compilador puede vectorizar.
+class PhaserEffect
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    PhaserEffect();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~PhaserEffect();
+
+    // EN: Prepares the phaser and allocates the per-block coefficient buffer.
+    // ES: Prepara el phaser y reserva el buffer de coeficientes por bloque.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the allpass states, the feedback and the LFO phase.
+    // ES: Limpia los estados pasa todo, la realimentación y la fase del LFO.
+    void reset();
+
+    // EN: Processes the buffer in place. Channels beyond maxChannels are left untouched.
+    // ES: Procesa el buffer en el mismo lugar. Los canales por encima de maxChannels no se modifican.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    // EN: Sets the number of allpass stages (2 to 24). Every two stages add one notch.
+    // ES: Establece el número de etapas pasa todo (2 a 24). Cada dos etapas se añade una muesca.
+    void setNumStages(int inNumStages);
+
+    // EN: Sets the LFO rate in Hz.
+    // ES: Establece la velocidad del LFO en Hz.
+    void setRate(float inRateHz);
+
+    // EN: Sets the sweep depth (0 to 1) inside the frequency range.
+    // ES: Establece la profundidad del barrido (0 a 1) dentro del rango de frecuencias.
+    void setDepth(float inDepth);
+
+    // EN: Sets the lowest and highest break frequency of the sweep in Hz.
+    // ES: Establece la frecuencia de quiebre más baja y más alta del barrido en Hz.
+    void setFrequencyRange(float inMinHz, float inMaxHz);
+
+    // EN: Sets the feedback from the last stage to the input (-0.95 to 0.95).
+    // ES: Establece la realimentación de la última etapa a la entrada (-0.95 a 0.95).
+    void setFeedback(float inFeedback);
+
+    // EN: Sets the LFO phase offset of the right channel in degrees (0 keeps both channels in sync).
+    // ES: Establece el desfase del LFO del canal derecho en grados (0 mantiene ambos canales sincronizados).
+    void setStereoOffset(float inDegrees);
+
+    // EN: Sets the dry/wet mix (0 to 1). 0.5 gives the deepest notches.
+    // ES: Establece la mezcla seco/húmedo (0 a 1). 0.5 da las muescas más profundas.
+    void setMix(float inMix);
+
+    // EN: Sets the number of samples between two evaluations of the LFO and the coefficients (1 is audio rate).
+    // ES: Establece el número de muestras entre dos evaluaciones del LFO y los coeficientes (1 es tasa de audio).
+    void setControlInterval(int inControlInterval);
+
+    static constexpr int maxStages = 24;
+    static constexpr int maxChannels = 2;
+
+private:
+    // EN: Renders the allpass coefficient of every sample of the first channels of the block into coefficients.
+    // ES: Calcula el coeficiente pasa todo de cada muestra de los primeros channels canales del bloque en coefficients.
+    void renderCoefficients(int numSamples, int channels);
+
+    // EN: Sets the coefficient targets of the next control interval and rotates the LFO over it.
+    // ES: Fija los objetivos de los coeficientes del siguiente intervalo de control y rota el LFO a lo largo de él.
+    void updateCoefficients(int channels);
+
+    // EN: Allpass coefficient for an LFO sine value.
+    // ES: Coeficiente pasa todo para un valor de seno del LFO.
+    float getCoefficient(double sine) const;
+
+    // EN: Recomputes the rotation of the LFO phasor over one control interval.
+    // ES: Recalcula la rotación del fasor del LFO a lo largo de un intervalo de control.
+    void updateRotation();
+
+    double sampleRate{ 44100.0 };
+
+    // EN: Coefficients of the block, one run of maxBlockSize samples per channel.
+    // ES: Coeficientes del bloque, un tramo de maxBlockSize muestras por canal.
+    std::vector<float> coefficients;
+    ControlRateRamp coefficientRamp[maxChannels];
+    int controlInterval{ 32 };
+    int maxBlockSize{ 0 };
+    int numChannels{ maxChannels };
+
+    // EN: Allpass states packed as [stage][channel] and the last wet sample of each channel for feedback.
+    // ES: Estados pasa todo agrupados como [etapa][canal] y la última muestra húmeda de cada canal para la realimentación.
+    float state[maxStages][maxChannels] = {};
+    float lastOutput[maxChannels] = {};
+
+    // EN: LFO phasor (sin and cos of the phase of the left channel), its rotation per control interval and the
+    //     rotation from the left to the right channel.
+    // ES: Fasor del LFO (seno y coseno de la fase del canal izquierdo), su rotación por intervalo de control y la
+    //     rotación del canal izquierdo al derecho.
+    double lfoSine{ 0.0 };
+    double lfoCosine{ 1.0 };
+    double rotationSine{ 0.0 };
+    double rotationCosine{ 1.0 };
+    double offsetSine{ 0.0 };
+    double offsetCosine{ 1.0 };
+
+    int numStages{ 4 };
+    float rateHz{ 0.5f };
+    float depth{ 1.0f };
+    float minFrequency{ 200.0f };
+    float maxFrequency{ 2000.0f };
+    float feedback{ 0.0f };
+    float stereoOffset{ 0.0f };
+    float mix{ 0.5f };
+};
@@ -40,43 +40,47 @@ void VibratoFX::setRate(float inRate)
 // ES: Procesa el buffer de audio para aplicar el efecto de vibrato.
 void VibratoFX::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // Almacena el valor anterior de tiempo para los canales.
     const float minRateHz = 0.1f;  // EN: Minimum frequency in Hz. | ES: Frecuencia mínima en Hz.
     const float maxRateHz = 10.0f; // EN: Maximum frequency in Hz. | ES: Frecuencia máxima en Hz.
 
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    // EN: Assigns the target rate and scales it to the frequency range (constant during the block).
+    // ES: Asigna el porcentaje de velocidad objetivo y lo escala al rango de frecuencia (constante durante el bloque).
+    ratePercentage = targetRatePercentage;
+    const float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
+
+    // EN: Only the two channels of the circular buffer are processed.
+    // ES: Solo se procesan los dos canales del buffer circular.
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t; // Reinicia el tiempo para cada canal.
+        // EN: Calculates the LFO to determine the fractional delay, once for all channels.
+        // ES: Calcula el LFO para determinar el retardo fraccional, una vez para todos los canales.
+        float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
+
+        // EN: Calculates the fractional delay index.
+        // ES: Calcula el índice de retardo fraccional.
+        float fracDelay = static_cast<float>(writterPointer) - lfoValue;
+        if (fracDelay < 0) {
+            fracDelay += circularBufferSize; // Ajusta el índice si es negativo.
+        }
 
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        int intDelay = static_cast<int>(fracDelay); // Parte entera del retardo.
+        float frac = fracDelay - intDelay;          // Parte fraccional para interpolación.
+
+        // EN: Calculates the next sample index for interpolation.
+        // ES: Calcula el índice de la siguiente muestra para la interpolación.
+        int nextSampleIndex = intDelay + 1;
+        if (nextSampleIndex >= circularBufferSize) {
+            nextSampleIndex = 0; // Ajusta si se excede el tamaño del buffer circular.
+        }
+
+        for (int channel = 0; channel < numChannels; channel++)
         {
-            auto sample = buffer.getReadPointer(channel)[i]; // Obtiene la muestra actual.
-
-            // EN: Assigns the target rate and scales it to the frequency range.
-            // ES: Asigna el porcentaje de velocidad objetivo y lo escala al rango de frecuencia.
-            ratePercentage = targetRatePercentage;
-            float rateHz = minRateHz + ratePercentage * (maxRateHz - minRateHz);
-
-            // EN: Calculates the LFO to determine the fractional delay.
-            // ES: Calcula el LFO para determinar el retardo fraccional.
-            float lfoValue = (depth / 2.0f) * sin(2.0 * juce::MathConstants<float>::pi * rateHz * t) + depth;
-
-            // EN: Calculates the fractional delay index.
-            // ES: Calcula el índice de retardo fraccional.
-            float fracDelay = static_cast<float>(writterPointer[channel]) - lfoValue;
-            if (fracDelay < 0) {
-                fracDelay += circularBufferSize; // Ajusta el índice si es negativo.
-            }
-
-            int intDelay = static_cast<int>(fracDelay); // Parte entera del retardo.
-            float frac = fracDelay - intDelay;          // Parte fraccional para interpolación.
-
-            // EN: Calculates the next sample index for interpolation.
-            // ES: Calcula el índice de la siguiente muestra para la interpolación.
-            int nextSampleIndex = intDelay + 1;
-            if (nextSampleIndex >= circularBufferSize) {
-                nextSampleIndex = 0; // Ajusta si se excede el tamaño del buffer circular.
-            }
+            auto sample = channelData[channel][i]; // Obtiene la muestra actual.
 
             // EN: Performs linear interpolation between the delayed samples.
             // ES: Realiza una interpolación lineal entre las muestras retrasadas.
@@ -85,23 +89,23 @@ void VibratoFX::process(juce::AudioBuffer<float>& buffer)
 
             // EN: Writes the current sample into the circular buffer.
             // ES: Escribe la muestra actual en el buffer circular.
-            circularBuffer[writterPointer[channel]][channel] = sample;
-
-            // EN: Advances the write pointer in the circular buffer.
-            // ES: Avanza el puntero de escritura en el buffer circular.
-            writterPointer[channel]++;
-            if (writterPointer[channel] >= circularBufferSize) {
-                writterPointer[channel] = 0; // Reinicia si alcanza el límite del buffer.
-            }
+            circularBuffer[writterPointer][channel] = sample;
 
             // EN: Writes the delayed sample to the output buffer.
             // ES: Escribe la muestra retrasada en el buffer de salida.
-            buffer.getWritePointer(channel)[i] = delayedSample;
+            channelData[channel][i] = delayedSample;
+        }
 
-            // EN: Increments the time variable.
-            // ES: Incrementa la variable de tiempo.
-            t += 1.0f / sampleRate;
+        // EN: Advances the write pointer in the circular buffer.
+        // ES: Avanza el puntero de escritura en el buffer circular.
+        writterPointer++;
+        if (writterPointer >= circularBufferSize) {
+            writterPointer = 0; // Reinicia si alcanza el límite del buffer.
         }
+
+        // EN: Increments the time variable.
+        // ES: Incrementa la variable de tiempo.
+        t += 1.0f / sampleRate;
     }
 }
 
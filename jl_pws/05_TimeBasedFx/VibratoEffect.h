@@ -78,8 +78,8 @@ private:
     // ES: El puntero de lectura para leer muestras retrasadas del buffer circular.
     int readerPointer = 0;
 
-    // EN: The write pointers for writing new audio samples into the circular buffer, one for each channel.
-    // ES: Los punteros de escritura para escribir nuevas muestras de audio en el buffer circular, uno por cada canal.
-    int writterPointer[2]{};
+    // EN: The write pointer for writing new audio samples into the circular buffer, shared by both channels.
+    // ES: El puntero de escritura para escribir nuevas muestras de audio en el buffer circular, compartido por ambos canales.
+    int writterPointer = 0;
 };
 
@@ -36,61 +36,62 @@ void VibratoEffect::setRate(float inRate)
 // ES: Procesa el buffer de audio para aplicar el efecto de vibrato utilizando un buffer circular y modulación con LFO.
 void VibratoEffect::process(juce::AudioBuffer<float>& buffer)
 {
-    float old_t = t; // EN: Save the initial time value for consistent LFO phase across channels.
-    // ES: Guarda el valor inicial de `t` para mantener la fase del LFO consistente entre canales.
-
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    // EN: The circular buffer has two channels; any other channel is left as it is.
+    // ES: El buffer circular tiene dos canales; cualquier otro canal se deja como está.
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    float* channelData[2] = {};
+    for (int channel = 0; channel < numChannels; channel++)
+        channelData[channel] = buffer.getWritePointer(channel);
+
+    for (int i = 0; i < buffer.getNumSamples(); i++)
     {
-        t = old_t; // EN: Restore the original time for each channel.
-        // ES: Restaura el tiempo original para cada canal.
+        // EN: Calculate the LFO value for delay modulation (one value per frame for all channels).
+        // ES: Calcula el valor del LFO para la modulación del retardo (un valor por trama para todos los canales).
+        float lfoValue = depth / 2.0f * sin(2.0 * juce::MathConstants<float>::pi * rate * t) + depth;
+
+        // EN: Calculate the delay in samples based on the LFO.
+        // ES: Calcula el número de muestras de retardo basado en el LFO.
+        int delaySamples = static_cast<int>(std::fabs(lfoValue));
+
+        // EN: Calculate the read position in the circular buffer.
+        // ES: Calcula la posición de lectura en el buffer circular.
+        readerPointer = writterPointer - delaySamples;
+        if (readerPointer < 0)
+        {
+            readerPointer += circularBufferSize; // EN: Wrap around if the pointer goes negative.
+            // ES: Ajusta el puntero si se vuelve negativo.
+        }
 
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        for (int channel = 0; channel < numChannels; channel++)
         {
-            auto sample = buffer.getReadPointer(channel)[i]; // EN: Get the current input sample.
+            auto sample = channelData[channel][i]; // EN: Get the current input sample.
             // ES: Obtiene la muestra actual de entrada.
 
-// EN: Calculate the LFO value for delay modulation.
-// ES: Calcula el valor del LFO para la modulación del retardo.
-            float lfoValue = depth / 2.0f * sin(2.0 * juce::MathConstants<float>::pi * rate * t) + depth;
-
-            // EN: Calculate the delay in samples based on the LFO.
-            // ES: Calcula el número de muestras de retardo basado en el LFO.
-            int delaySamples = static_cast<int>(std::fabs(lfoValue));
-
-            // EN: Calculate the read position in the circular buffer.
-            // ES: Calcula la posición de lectura en el buffer circular.
-            readerPointer = writterPointer[channel] - delaySamples;
-            if (readerPointer < 0)
-            {
-                readerPointer += circularBufferSize; // EN: Wrap around if the pointer goes negative.
-                // ES: Ajusta el puntero si se vuelve negativo.
-            }
-
             // EN: Get the delayed sample from the circular buffer.
             // ES: Obtiene la muestra retrasada del buffer circular.
             auto delayedSample = circularBuffer[readerPointer][channel];
 
             // EN: Write the current input sample into the circular buffer.
             // ES: Escribe la muestra actual en el buffer circular.
-            circularBuffer[writterPointer[channel]][channel] = sample;
-
-            // EN: Advance the write pointer in the circular buffer.
-            // ES: Avanza el puntero de escritura en el buffer circular.
-            writterPointer[channel]++;
-            if (writterPointer[channel] >= circularBufferSize)
-            {
-                writterPointer[channel] = 0; // EN: Wrap around if the pointer exceeds the buffer size.
-                // ES: Ajusta el puntero si excede el tamaño del buffer.
-            }
+            circularBuffer[writterPointer][channel] = sample;
 
             // EN: Write the delayed sample to the output buffer.
             // ES: Escribe la muestra retrasada en el buffer de salida.
-            buffer.getWritePointer(channel)[i] = delayedSample;
+            channelData[channel][i] = delayedSample;
+        }
 
-            // EN: Increment the time variable for the LFO.
-            // ES: Incrementa la variable de tiempo para el LFO.
-            t += 1.0f / sampleRate;
+        // EN: Advance the write pointer in the circular buffer.
+        // ES: Avanza el puntero de escritura en el buffer circular.
+        writterPointer++;
+        if (writterPointer >= circularBufferSize)
+        {
+            writterPointer = 0; // EN: Wrap around if the pointer exceeds the buffer size.
+            // ES: Ajusta el puntero si excede el tamaño del buffer.
         }
+
+        // EN: Increment the time variable for the LFO.
+        // ES: Incrementa la variable de tiempo para el LFO.
+        t += 1.0f / sampleRate;
     }
 }
 
@@ -82,7 +82,7 @@ private:
     // ES: Puntero a la posici�n de lectura en el buffer circular.
     int readerPointer = 0;
 
-    // EN: Array of write pointers for each channel in the circular buffer.
-    // ES: Arreglo de punteros de escritura para cada canal en el buffer circular.
-    int writterPointer[2] = { 0, 0 };
+    // EN: Write pointer in the circular buffer, shared by both channels.
+    // ES: Puntero de escritura en el buffer circular, compartido por ambos canales.
+    int writterPointer = 0;
 };
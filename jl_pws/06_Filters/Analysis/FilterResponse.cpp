@@ -0,0 +1,181 @@
+/*
+  ==============================================================================
+
+    FilterResponse.cpp
+    Created: 19 Oct 2026 2:57:44am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FilterResponse.h"
+
+// EN: Constructor.
+// ES: Constructor.
+FilterResponse::FilterResponse()
+{
+}
+
+// EN: Destructor.
+// ES: Destructor.
+FilterResponse::~FilterResponse()
+{
+}
+
+// EN: Stores the grid, precomputes e^-jw per point and sizes the scratch arrays.
+// ES: Guarda la rejilla, precalcula e^-jw por punto y dimensiona los arreglos temporales.
+void FilterResponse::setFrequencies(const std::vector<double>& frequenciesHz, double inSampleRate)
+{
+    sampleRate = inSampleRate;
+    frequencies = frequenciesHz;
+
+    const size_t numPoints = frequencies.size();
+    cosW.resize(numPoints);
+    sinW.resize(numPoints);
+
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        const double w = juce::MathConstants<double>::twoPi * frequencies[i] / sampleRate;
+        cosW[i] = std::cos(w);
+        sinW[i] = std::sin(w);
+    }
+
+    for (auto* scratch : { &pRe, &pIm, &dRe, &dIm, &totalDb, &totalPhase, &totalDelay })
+        scratch->resize(numPoints);
+}
+
+// EN: Logarithmic grid, the usual x axis of an EQ display.
+// ES: Rejilla logarítmica, el eje x habitual de una pantalla de EQ.
+void FilterResponse::setLogFrequencies(int numPoints, double minHz, double maxHz, double inSampleRate)
+{
+    std::vector<double> grid(juce::jmax(1, numPoints));
+    const double ratio = maxHz / minHz;
+
+    for (int i = 0; i < static_cast<int>(grid.size()); i++)
+    {
+        const double position = numPoints > 1 ? static_cast<double>(i) / (numPoints - 1) : 0.0;
+        grid[i] = minHz * std::pow(ratio, position);
+    }
+
+    setFrequencies(grid, inSampleRate);
+}
+
+// EN: Number of points in the grid.
+// ES: Número de puntos de la rejilla.
+int FilterResponse::getNumPoints() const
+{
+    return static_cast<int>(frequencies.size());
+}
+
+// EN: Frequencies of the grid in Hz.
+// ES: Frecuencias de la rejilla en Hz.
+const std::vector<double>& FilterResponse::getFrequencies() const
+{
+    return frequencies;
+}
+
+// EN: Single filter.
+// ES: Un solo filtro.
+void FilterResponse::evaluate(const TransferFunction& stage, float* magnitudeDb, float* phase, float* groupDelay)
+{
+    evaluate(&stage, 1, magnitudeDb, phase, groupDelay);
+}
+
+// EN: For a cascade, dB, phase and group delay simply add up, and each stage adds its numerator and
+//     subtracts its denominator.
+// ES: En una cascada, los dB, la fase y el retardo de grupo simplemente se suman, y cada etapa suma su
+//     numerador y resta su denominador.
+void FilterResponse::evaluate(const TransferFunction* stages, int numStages, float* magnitudeDb, float* phase, float* groupDelay)
+{
+    const size_t numPoints = frequencies.size();
+
+    std::fill(totalDb.begin(), totalDb.end(), 0.0);
+    std::fill(totalPhase.begin(), totalPhase.end(), 0.0);
+    std::fill(totalDelay.begin(), totalDelay.end(), 0.0);
+
+    for (int s = 0; s < numStages; s++)
+    {
+        evaluatePolynomial(stages[s].b);
+        accumulate(1.0);
+
+        evaluatePolynomial(stages[s].a);
+        accumulate(-1.0);
+    }
+
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        if (magnitudeDb != nullptr)
+            magnitudeDb[i] = static_cast<float>(totalDb[i]);
+
+        if (phase != nullptr)
+            phase[i] = static_cast<float>(std::remainder(totalPhase[i], juce::MathConstants<double>::twoPi));
+
+        if (groupDelay != nullptr)
+            groupDelay[i] = static_cast<float>(totalDelay[i]);
+    }
+}
+
+// EN: Horner's rule in z^-1 = e^-jw = (cos w, -sin w). D(w) uses the coefficients k * p[k], whose ratio
+//     to P(w) gives the group delay: tau = Re{ D(w) / P(w) }.
+// ES: Regla de Horner en z^-1 = e^-jw = (cos w, -sin w). D(w) usa los coeficientes k * p[k], cuya razón
+//     con P(w) da el retardo de grupo: tau = Re{ D(w) / P(w) }.
+void FilterResponse::evaluatePolynomial(const std::vector<double>& p)
+{
+    const size_t numPoints = frequencies.size();
+    const int last = static_cast<int>(p.size()) - 1;
+
+    const double* c = cosW.data();
+    const double* s = sinW.data();
+    double* re = pRe.data();
+    double* im = pIm.data();
+    double* dr = dRe.data();
+    double* di = dIm.data();
+
+    const double pLast = last >= 0 ? p[last] : 0.0;
+    const double dLast = last >= 0 ? last * p[last] : 0.0;
+
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        re[i] = pLast;
+        im[i] = 0.0;
+        dr[i] = dLast;
+        di[i] = 0.0;
+    }
+
+    for (int k = last - 1; k >= 0; k--)
+    {
+        const double pk = p[k];
+        const double dk = k * p[k];
+
+        // EN: (re + j im) * (c - j s) + coefficient, for every point at once.
+        // ES: (re + j im) * (c - j s) + coeficiente, para todos los puntos a la vez.
+        for (size_t i = 0; i < numPoints; i++)
+        {
+            const double r = re[i] * c[i] + im[i] * s[i] + pk;
+            const double q = im[i] * c[i] - re[i] * s[i];
+            re[i] = r;
+            im[i] = q;
+
+            const double dr2 = dr[i] * c[i] + di[i] * s[i] + dk;
+            const double di2 = di[i] * c[i] - dr[i] * s[i];
+            dr[i] = dr2;
+            di[i] = di2;
+        }
+    }
+}
+
+// EN: Adds the magnitude, phase and group delay of the polynomial in the scratch arrays.
+// ES: Suma la magnitud, la fase y el retardo de grupo del polinomio en los arreglos temporales.
+void FilterResponse::accumulate(double sign)
+{
+    const size_t numPoints = frequencies.size();
+
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        const double power = juce::jmax(pRe[i] * pRe[i] + pIm[i] * pIm[i], 1.0e-30);
+
+        totalDb[i] += sign * 10.0 * std::log10(power);
+        totalPhase[i] += sign * std::atan2(pIm[i], pRe[i]);
+        totalDelay[i] += sign * (dRe[i] * pRe[i] + dIm[i] * pIm[i]) / power;
+    }
+}
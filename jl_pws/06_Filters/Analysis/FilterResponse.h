@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    FilterResponse.h
+    Created: 19 Oct 2026 2:57:44am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: FilterResponse evaluates the magnitude, phase and group delay of one filter or a cascade of filters
+//     over an arbitrary frequency grid, directly from their TransferFunction snapshots.
+//     The grid and scratch memory are allocated in setFrequencies, so evaluate never allocates and never
+//     touches a live filter: it is meant to be called from the message thread to draw EQ curves.
+//     The inner loops run over the frequency points with separate real/imaginary arrays so they vectorize.
+// ES: FilterResponse evalúa la magnitud, la fase y el retardo de grupo de un filtro o de una cascada de filtros
+//     sobre una rejilla de frecuencias arbitraria, directamente desde sus copias TransferFunction.
+//     La rejilla y la memoria temporal se reservan en setFrequencies, así evaluate nunca reserva memoria ni
+//     toca un filtro en vivo: está pensado para llamarse desde el hilo de mensajes para dibujar curvas de EQ.
+//     Los bucles internos recorren los puntos de frecuencia con arreglos reales/imaginarios separados para vectorizar.
+class FilterResponse
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    FilterResponse();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~FilterResponse();
+
+    // EN: Sets the frequency grid in Hz and the sample rate the filters run at.
+    // ES: Establece la rejilla de frecuencias en Hz y la frecuencia de muestreo de los filtros.
+    void setFrequencies(const std::vector<double>& frequenciesHz, double inSampleRate);
+
+    // EN: Fills the grid with logarithmically spaced points between minHz and maxHz.
+    // ES: Llena la rejilla con puntos espaciados logarítmicamente entre minHz y maxHz.
+    void setLogFrequencies(int numPoints, double minHz, double maxHz, double inSampleRate);
+
+    // EN: Returns the number of points in the grid.
+    // ES: Devuelve el número de puntos de la rejilla.
+    int getNumPoints() const;
+
+    // EN: Returns the frequency of each point in Hz.
+    // ES: Devuelve la frecuencia de cada punto en Hz.
+    const std::vector<double>& getFrequencies() const;
+
+    // EN: Evaluates a cascade of numStages transfer functions. Any output pointer may be nullptr.
+    //     magnitudeDb: total gain in dB. phase: total phase in radians, wrapped to [-pi, pi].
+    //     groupDelay: total group delay in samples.
+    // ES: Evalúa una cascada de numStages funciones de transferencia. Cualquier puntero de salida puede ser nullptr.
+    //     magnitudeDb: ganancia total en dB. phase: fase total en radianes, envuelta a [-pi, pi].
+    //     groupDelay: retardo de grupo total en muestras.
+    void evaluate(const TransferFunction* stages, int numStages, float* magnitudeDb, float* phase, float* groupDelay);
+
+    // EN: Convenience overload for a single filter.
+    // ES: Sobrecarga de conveniencia para un solo filtro.
+    void evaluate(const TransferFunction& stage, float* magnitudeDb, float* phase, float* groupDelay);
+
+private:
+    // EN: Evaluates P(w) = sum p[k] e^-jwk and D(w) = sum k p[k] e^-jwk for every point (Horner's rule).
+    // ES: Evalúa P(w) = sum p[k] e^-jwk y D(w) = sum k p[k] e^-jwk para cada punto (regla de Horner).
+    void evaluatePolynomial(const std::vector<double>& p);
+
+    // EN: Adds (sign = +1) or removes (sign = -1) the polynomial in the scratch arrays from the totals.
+    // ES: Suma (sign = +1) o resta (sign = -1) el polinomio de los arreglos temporales a los totales.
+    void accumulate(double sign);
+
+    // EN: Frequency grid and the unit-circle point e^-jw for each frequency.
+    // ES: Rejilla de frecuencias y el punto e^-jw del círculo unitario para cada frecuencia.
+    std::vector<double> frequencies;
+    std::vector<double> cosW;
+    std::vector<double> sinW;
+
+    // EN: Scratch arrays for P(w) and D(w).
+    // ES: Arreglos temporales para P(w) y D(w).
+    std::vector<double> pRe, pIm, dRe, dIm;
+
+    // EN: Running totals: log power (dB), phase and group delay.
+    // ES: Totales acumulados: potencia logarítmica (dB), fase y retardo de grupo.
+    std::vector<double> totalDb, totalPhase, totalDelay;
+
+    double sampleRate{ 48000.0 };
+};
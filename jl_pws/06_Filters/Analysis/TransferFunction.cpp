@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    TransferFunction.cpp
+    Created: 19 Oct 2026 2:57:44am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "TransferFunction.h"
+
+// EN: Second order section: B(z) = b0 + b1 z^-1 + b2 z^-2, A(z) = a0 + a1 z^-1 + a2 z^-2.
+// ES: Sección de segundo orden: B(z) = b0 + b1 z^-1 + b2 z^-2, A(z) = a0 + a1 z^-1 + a2 z^-2.
+TransferFunction TransferFunction::fromBiquad(double b0, double b1, double b2, double a0, double a1, double a2)
+{
+    TransferFunction h;
+    h.b = { b0, b1, b2 };
+    h.a = { a0, a1, a2 };
+    return h;
+}
+
+// EN: JUCE keeps the order N filter as [b0 .. bN, a1 .. aN], already divided by a0.
+// ES: JUCE guarda el filtro de orden N como [b0 .. bN, a1 .. aN], ya dividido por a0.
+TransferFunction TransferFunction::fromIIR(const juce::dsp::IIR::Coefficients<float>& coefficients)
+{
+    TransferFunction h;
+    const int order = static_cast<int>(coefficients.getFilterOrder());
+    const float* raw = coefficients.getRawCoefficients();
+
+    h.b.resize(order + 1);
+    h.a.resize(order + 1);
+    h.a[0] = 1.0;
+
+    for (int k = 0; k <= order; k++)
+        h.b[k] = raw[k];
+
+    for (int k = 1; k <= order; k++)
+        h.a[k] = raw[order + k];
+
+    return h;
+}
+
+// EN: Same layout for filters running in double precision.
+// ES: La misma disposición para filtros que trabajan en doble precisión.
+TransferFunction TransferFunction::fromIIR(const juce::dsp::IIR::Coefficients<double>& coefficients)
+{
+    TransferFunction h;
+    const int order = static_cast<int>(coefficients.getFilterOrder());
+    const double* raw = coefficients.getRawCoefficients();
+
+    h.b.resize(order + 1);
+    h.a.resize(order + 1);
+    h.a[0] = 1.0;
+
+    for (int k = 0; k <= order; k++)
+        h.b[k] = raw[k];
+
+    for (int k = 1; k <= order; k++)
+        h.a[k] = raw[order + k];
+
+    return h;
+}
+
+// EN: FIR filters only have a numerator.
+// ES: Los filtros FIR solo tienen numerador.
+TransferFunction TransferFunction::fromFIR(const juce::dsp::FIR::Coefficients<float>& coefficients)
+{
+    TransferFunction h;
+    const int numTaps = static_cast<int>(coefficients.getFilterOrder()) + 1;
+    const float* raw = coefficients.getRawCoefficients();
+
+    h.b.assign(raw, raw + numTaps);
+    h.a = { 1.0 };
+    return h;
+}
@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    TransferFunction.h
+    Created: 19 Oct 2026 2:57:44am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: TransferFunction holds a snapshot of a filter's coefficients as H(z) = B(z) / A(z), with
+//     B(z) = b[0] + b[1] z^-1 + ... and A(z) = a[0] + a[1] z^-1 + ... exactly as the filter applies them.
+//     Every filter class returns one from getTransferFunction(), and FilterResponse evaluates them.
+//     It is a plain value, so it can be copied to the message thread and analysed there.
+// ES: TransferFunction guarda una copia de los coeficientes de un filtro como H(z) = B(z) / A(z), con
+//     B(z) = b[0] + b[1] z^-1 + ... y A(z) = a[0] + a[1] z^-1 + ... tal como el filtro los aplica.
+//     Cada clase de filtro devuelve uno desde getTransferFunction(), y FilterResponse los evalúa.
+//     Es un valor simple, así que puede copiarse al hilo de mensajes y analizarse allí.
+struct TransferFunction
+{
+    // EN: Numerator (feedforward) coefficients.
+    // ES: Coeficientes del numerador (directos).
+    std::vector<double> b{ 1.0 };
+
+    // EN: Denominator (feedback) coefficients. a[0] is kept even when it is 1.
+    // ES: Coeficientes del denominador (realimentación). a[0] se mantiene aunque sea 1.
+    std::vector<double> a{ 1.0 };
+
+    // EN: Builds a second order section from the six biquad coefficients.
+    // ES: Construye una sección de segundo orden a partir de los seis coeficientes biquad.
+    static TransferFunction fromBiquad(double b0, double b1, double b2, double a0, double a1, double a2);
+
+    // EN: Builds a transfer function from JUCE IIR coefficients (stored as b0..bN, a1..aN with a0 = 1).
+    // ES: Construye una función de transferencia a partir de coeficientes IIR de JUCE (b0..bN, a1..aN con a0 = 1).
+    static TransferFunction fromIIR(const juce::dsp::IIR::Coefficients<float>& coefficients);
+    static TransferFunction fromIIR(const juce::dsp::IIR::Coefficients<double>& coefficients);
+
+    // EN: Builds a transfer function from JUCE FIR coefficients (A(z) = 1).
+    // ES: Construye una función de transferencia a partir de coeficientes FIR de JUCE (A(z) = 1).
+    static TransferFunction fromFIR(const juce::dsp::FIR::Coefficients<float>& coefficients);
+};
@@ -12,15 +12,18 @@
 
 // EN: Constructor. Initializes the Low Shelf Filter object.
 // ES: Constructor. Inicializa el objeto del filtro de estanter�a baja.
-Biquad_TDFII_LSF::Biquad_TDFII_LSF() {}
+template <typename SampleType>
+Biquad_TDFII_LSF_T<SampleType>::Biquad_TDFII_LSF_T() {}
 
 // EN: Destructor. Cleans up the Low Shelf Filter object.
 // ES: Destructor. Libera los recursos del objeto del filtro de estanter�a baja.
-Biquad_TDFII_LSF::~Biquad_TDFII_LSF() {}
+template <typename SampleType>
+Biquad_TDFII_LSF_T<SampleType>::~Biquad_TDFII_LSF_T() {}
 
 // EN: Prepares the filter for processing by setting the sample rate and updating the filter coefficients.
 // ES: Prepara el filtro para procesar, configurando la frecuencia de muestreo y actualizando los coeficientes del filtro.
-void Biquad_TDFII_LSF::prepare(double inSampleRate)
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::prepare(double inSampleRate)
 {
     sampleRate = inSampleRate;
     updateFilter();
@@ -28,10 +31,11 @@ void Biquad_TDFII_LSF::prepare(double inSampleRate)
 
 // EN: Processes an entire audio buffer through the Low Shelf Filter.
 // ES: Procesa un buffer completo de audio a trav�s del filtro de estanter�a baja.
-void Biquad_TDFII_LSF::process(juce::AudioBuffer<float> inBuffer)
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
-    int numChannels = inBuffer.getNumChannels(); // EN: Get the number of channels. / ES: Obtiene el n�mero de canales.
-    int numSamples = inBuffer.getNumSamples();   // EN: Get the number of samples. / ES: Obtiene el n�mero de muestras.
+    int numChannels = buffer.getNumChannels(); // EN: Get the number of channels. / ES: Obtiene el n�mero de canales.
+    int numSamples = buffer.getNumSamples();   // EN: Get the number of samples. / ES: Obtiene el n�mero de muestras.
 
     // EN: Loop through each channel and each sample to apply the filter.
     // ES: Itera por cada canal y muestra para aplicar el filtro.
@@ -39,18 +43,19 @@ void Biquad_TDFII_LSF::process(juce::AudioBuffer<float> inBuffer)
     {
         for (int i = 0; i < numSamples; i++)
         {
-            float inSample = inBuffer.getSample(channel, i); // EN: Get the current input sample. / ES: Obtiene la muestra de entrada actual.
+            SampleType inSample = buffer.getSample(channel, i); // EN: Get the current input sample. / ES: Obtiene la muestra de entrada actual.
 
-            float outSample = processSample(inSample, channel); // EN: Process the sample through the filter. / ES: Procesa la muestra con el filtro.
+            SampleType outSample = processSample(inSample, channel); // EN: Process the sample through the filter. / ES: Procesa la muestra con el filtro.
 
-            inBuffer.setSample(channel, i, outSample); // EN: Store the filtered sample back in the buffer. / ES: Almacena la muestra filtrada de nuevo en el buffer.
+            buffer.setSample(channel, i, outSample); // EN: Store the filtered sample back in the buffer. / ES: Almacena la muestra filtrada de nuevo en el buffer.
         }
     }
 }
 
 // EN: Processes a single sample for a specific channel using the filter's equations.
 // ES: Procesa una �nica muestra para un canal espec�fico usando las ecuaciones del filtro.
-float Biquad_TDFII_LSF::processSample(float inSample, int channel)
+template <typename SampleType>
+SampleType Biquad_TDFII_LSF_T<SampleType>::processSample(SampleType inSample, int channel)
 {
     auto y = b0 * inSample + r1[channel]; // EN: Calculate the filtered output. / ES: Calcula la salida filtrada.
 
@@ -62,7 +67,8 @@ float Biquad_TDFII_LSF::processSample(float inSample, int channel)
 
 // EN: Sets the cutoff frequency of the filter and updates the coefficients.
 // ES: Configura la frecuencia de corte del filtro y actualiza los coeficientes.
-void Biquad_TDFII_LSF::setFrequency(float inFrequency)
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::setFrequency(float inFrequency)
 {
     frequency = inFrequency;
     updateFilter();
@@ -70,7 +76,8 @@ void Biquad_TDFII_LSF::setFrequency(float inFrequency)
 
 // EN: Sets the Q factor (resonance) of the filter and updates the coefficients.
 // ES: Configura el factor Q (resonancia) del filtro y actualiza los coeficientes.
-void Biquad_TDFII_LSF::setQ(float inQ)
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::setQ(float inQ)
 {
     Q = inQ;
     updateFilter();
@@ -78,7 +85,8 @@ void Biquad_TDFII_LSF::setQ(float inQ)
 
 // EN: Sets the gain of the filter in decibels and updates the coefficients.
 // ES: Configura la ganancia del filtro en decibelios y actualiza los coeficientes.
-void Biquad_TDFII_LSF::setGain(float inGain)
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::setGain(float inGain)
 {
     Gain = inGain;
     updateFilter();
@@ -86,31 +94,46 @@ void Biquad_TDFII_LSF::setGain(float inGain)
 
 // EN: Updates the filter coefficients based on the frequency, Q factor, and gain parameters.
 // ES: Actualiza los coeficientes del filtro bas�ndose en los par�metros de frecuencia, factor Q y ganancia.
-void Biquad_TDFII_LSF::updateFilter()
+template <typename SampleType>
+void Biquad_TDFII_LSF_T<SampleType>::updateFilter()
 {
     // EN: Calculate intermediate values for the filter's equations.
     // ES: Calcula valores intermedios para las ecuaciones del filtro.
-    w0 = (juce::MathConstants<float>::twoPi * frequency) / static_cast<float>(sampleRate);
-    alpha = sinf(w0) / (2.0f * Q);
-    A = sqrt(powf(10.0f, Gain / 20.0f)); // EN: Convert gain to linear amplitude. / ES: Convierte la ganancia a amplitud lineal.
+    w0 = (juce::MathConstants<double>::twoPi * frequency) / sampleRate;
+    alpha = std::sin(w0) / (2.0 * Q);
+    A = std::sqrt(std::pow(10.0, Gain / 20.0)); // EN: Convert gain to linear amplitude. / ES: Convierte la ganancia a amplitud lineal.
 
     // EN: Calculate the feedforward coefficients (b0, b1, b2).
     // ES: Calcula los coeficientes de avance (b0, b1, b2).
-    b0 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha));
-    b1 = 2.0f * A * ((A - 1.0f) - ((A + 1.0f) * cosf(w0)));
-    b2 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha));
+    const double cb0 = A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha));
+    const double cb1 = 2.0 * A * ((A - 1.0) - ((A + 1.0) * std::cos(w0)));
+    const double cb2 = A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha));
 
     // EN: Calculate the feedback coefficients (a0, a1, a2).
     // ES: Calcula los coeficientes de retroalimentaci�n (a0, a1, a2).
-    a0 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha);
-    a1 = -2.0f * ((A - 1.0f) + ((A + 1.0f) * cosf(w0)));
-    a2 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha);
-
-    // EN: Normalize the coefficients by dividing each by a0.
-    // ES: Normaliza los coeficientes dividiendo cada uno por a0.
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
+    const double ca0 = (A + 1.0) + ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha);
+    const double ca1 = -2.0 * ((A - 1.0) + ((A + 1.0) * std::cos(w0)));
+    const double ca2 = (A + 1.0) + ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha);
+
+    // EN: Normalize the coefficients by dividing each by a0 in double, then round them to SampleType.
+    // ES: Normaliza los coeficientes dividiendo cada uno por a0 en double, luego los redondea a SampleType.
+    b0 = static_cast<SampleType>(cb0 / ca0);
+    b1 = static_cast<SampleType>(cb1 / ca0);
+    b2 = static_cast<SampleType>(cb2 / ca0);
+    a0 = static_cast<SampleType>(ca0);
+    a1 = static_cast<SampleType>(ca1 / ca0);
+    a2 = static_cast<SampleType>(ca2 / ca0);
 }
+
+// EN: The coefficients are already divided by a0, so the denominator starts with 1.
+// ES: Los coeficientes ya están divididos por a0, así que el denominador empieza con 1.
+template <typename SampleType>
+TransferFunction Biquad_TDFII_LSF_T<SampleType>::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, 1.0, a1, a2);
+}
+
+// EN: The two sample types the filter is built for.
+// ES: Los dos tipos de muestra para los que se compila el filtro.
+template class Biquad_TDFII_LSF_T<float>;
+template class Biquad_TDFII_LSF_T<double>;
@@ -12,17 +12,20 @@
 //#include <JuceHeader.h>
 
 // EN: Class implementing a Biquad filter in Transposed Direct Form II for a Low Shelf Filter (LSF).
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
 // ES: Clase que implementa un filtro Biquad en Forma Directa Transpuesta II para un Filtro de Estanter�a Baja (LSF).
-class Biquad_TDFII_LSF
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class Biquad_TDFII_LSF_T
 {
 public:
     // EN: Constructor. Initializes the Low Shelf Filter instance.
     // ES: Constructor. Inicializa la instancia del filtro de estanter�a baja.
-    Biquad_TDFII_LSF();
+    Biquad_TDFII_LSF_T();
 
     // EN: Destructor. Cleans up any allocated resources.
     // ES: Destructor. Libera cualquier recurso asignado.
-    ~Biquad_TDFII_LSF();
+    ~Biquad_TDFII_LSF_T();
 
     // EN: Prepares the filter with the specified sample rate and updates the coefficients.
     // ES: Prepara el filtro con la frecuencia de muestreo especificada y actualiza los coeficientes.
@@ -30,11 +33,15 @@ public:
 
     // EN: Processes an entire audio buffer through the Low Shelf Filter.
     // ES: Procesa un buffer completo de audio a trav�s del filtro de estanter�a baja.
-    void process(juce::AudioBuffer<float> inBuffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
 
     // EN: Processes a single sample for a specific channel.
     // ES: Procesa una �nica muestra para un canal espec�fico.
-    float processSample(float inSample, int channel);
+    SampleType processSample(SampleType inSample, int channel);
 
     // EN: Sets the cutoff frequency of the filter.
     // ES: Establece la frecuencia de corte del filtro.
@@ -59,28 +66,31 @@ private:
 
     // EN: Delay lines for the filter (two delay registers per channel).
     // ES: L�neas de retardo para el filtro (dos registros de retardo por canal).
-    float r1[2] = { 0.0f };
-    float r2[2] = { 0.0f };
+    SampleType r1[2] = {};
+    SampleType r2[2] = {};
 
     // EN: Intermediate variables for filter calculations.
     // ES: Variables intermedias para los c�lculos del filtro.
-    float w0{ 0.0f };    // EN: Angular frequency. / ES: Frecuencia angular.
-    float alpha{ 0.0f }; // EN: Slope or bandwidth parameter. / ES: Par�metro de pendiente o ancho de banda.
+    double w0{ 0.0 };   // EN: Angular frequency. / ES: Frecuencia angular.
+    double alpha{ 0.0 }; // EN: Slope or bandwidth parameter. / ES: Par�metro de pendiente o ancho de banda.
 
     // EN: Filter coefficients for feedforward (b0, b1, b2) and feedback (a0, a1, a2).
     // ES: Coeficientes del filtro para avance (b0, b1, b2) y retroalimentaci�n (a0, a1, a2).
-    float b0{ 0.0f };
-    float b1{ 0.0f };
-    float b2{ 0.0f };
-    float a0{ 0.0f };
-    float a1{ 0.0f };
-    float a2{ 0.0f };
+    SampleType b0{ 0 };
+    SampleType b1{ 0 };
+    SampleType b2{ 0 };
+    SampleType a0{ 0 };
+    SampleType a1{ 0 };
+    SampleType a2{ 0 };
 
     // EN: Parameters for the filter.
     // ES: Par�metros para el filtro.
     float frequency{ 1000.0f }; // EN: Cutoff frequency in Hz. / ES: Frecuencia de corte en Hz.
     float Q{ 0.707f };          // EN: Quality factor (resonance). / ES: Factor de calidad (resonancia).
     float Gain{ 0.0f };         // EN: Gain in decibels. / ES: Ganancia en decibelios.
-    float A{ 0.0f };            // EN: Linear amplitude derived from gain. / ES: Amplitud lineal derivada de la ganancia.
+    double A{ 0.0 };           // EN: Linear amplitude derived from gain. / ES: Amplitud lineal derivada de la ganancia.
 };
 
+// EN: The float version keeps the original name; Biquad_TDFII_LSF_T<double> is the double version.
+// ES: La versión float conserva el nombre original; Biquad_TDFII_LSF_T<double> es la versión double.
+using Biquad_TDFII_LSF = Biquad_TDFII_LSF_T<float>;
@@ -111,3 +111,10 @@ void Biquad_TDFII_Notch::updateFilter()
     a1 /= a0;
     a2 /= a0;
 }
+
+// EN: The coefficients are already divided by a0, so the denominator starts with 1.
+// ES: Los coeficientes ya están divididos por a0, así que el denominador empieza con 1.
+TransferFunction Biquad_TDFII_Notch::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, 1.0, a1, a2);
+}
@@ -34,6 +34,10 @@ public:
     // ES: Procesa un buffer completo de audio a trav�s del filtro de muesca.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample for a specific channel using the filter.
     // ES: Procesa una �nica muestra para un canal espec�fico usando el filtro.
     float processSample(float inSample, int channel);
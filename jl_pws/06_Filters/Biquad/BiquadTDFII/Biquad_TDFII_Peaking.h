@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio completo a través del filtro.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample through the filter for a specific channel.
     // ES: Procesa una muestra única a través del filtro para un canal específico.
     float processSample(float inSample, int channel);
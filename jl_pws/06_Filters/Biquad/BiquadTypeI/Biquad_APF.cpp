@@ -97,4 +97,11 @@ void Biquad_APF::updateFilter()
     a0 = 1.0 + alpha;
     a1 = -2.0f * cosf(w0);
     a2 = 1.0f - alpha;
-}
\ No newline at end of file
+}
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_APF::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
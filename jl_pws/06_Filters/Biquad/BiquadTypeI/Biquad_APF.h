@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio aplicando el filtro a cada muestra.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single audio sample and applies the filter's equation.
     // ES: Procesa una sola muestra de audio y aplica la ecuaci�n del filtro.
     float processSample(float inSample, int channel);
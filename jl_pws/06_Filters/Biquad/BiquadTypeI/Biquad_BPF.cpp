@@ -101,3 +101,10 @@ void Biquad_BPF::updateFilter()
     a1 = -2.0f * cosf(w0);   // EN: Denominator coefficient for the previous stage. ES: Coeficiente del denominador para la etapa anterior.
     a2 = 1.0f - alpha;       // EN: Denominator coefficient for two stages back. ES: Coeficiente del denominador para dos etapas atr�s.
 }
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_BPF::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
@@ -102,4 +102,11 @@ void Biquad_BPF2::updateFilter()
     a0 = 1.0 + alpha;          // EN: Normalization term for feedback. ES: T�rmino de normalizaci�n para retroalimentaci�n.
     a1 = -2.0f * cosf(w0);     // EN: Relates to the filter's center frequency. ES: Relacionado con la frecuencia central del filtro.
     a2 = 1.0f - alpha;         // EN: Opposite sign to alpha in feedback. ES: Signo opuesto a alpha en retroalimentaci�n.
-}
\ No newline at end of file
+}
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_BPF2::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio aplicando el filtro de paso banda a cada muestra.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single audio sample for a given channel using the band-pass filter.
     // ES: Procesa una sola muestra de audio para un canal espec�fico utilizando el filtro de paso banda.
     float processSample(float inSample, int channel);
@@ -100,3 +100,9 @@ void Biquad_HPF::updateFilter()
     a2 = 1.0f - alpha;
 }
 
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_HPF::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
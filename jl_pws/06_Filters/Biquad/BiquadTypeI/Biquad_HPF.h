@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio completo aplicando el filtro pasa altos.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample for a specific channel.
     // ES: Procesa una sola muestra para un canal espec�fico.
     float processSample(float inSample, int channel);
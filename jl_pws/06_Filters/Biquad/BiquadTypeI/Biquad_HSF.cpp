@@ -104,4 +104,11 @@ void Biquad_HSF::updateFilter()
     a0 = (A + 1.0f) - ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha);
     a1 = 2.0f * ((A - 1.0f) - ((A + 1.0f) * cosf(w0)));
     a2 = (A + 1.0f) - ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha);
-}
\ No newline at end of file
+}
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_HSF::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
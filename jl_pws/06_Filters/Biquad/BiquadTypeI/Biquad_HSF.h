@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio completo, aplicando el filtro de estante alto a todos los canales y muestras.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample for a specific channel using the high-shelf filter coefficients.
     // ES: Procesa una sola muestra para un canal espec�fico utilizando los coeficientes del filtro de estante alto.
     float processSample(float inSample, int channel);
@@ -30,6 +30,8 @@ public:
                                                       // ES: Procesa todo el buffer de audio, aplicando el LPF a cada muestra.
     float processSample(float inSample, int channel);  // EN: Processes a single sample for a specific channel.
                                                        // ES: Procesa una sola muestra para un canal espec�fico.
+    TransferFunction getTransferFunction() const;  // EN: Returns a snapshot of the coefficients for FilterResponse.
+                                                   // ES: Devuelve una copia de los coeficientes para FilterResponse.
 
     void setFrequency(float inFrequency);  // EN: Sets the cutoff frequency of the LPF.
                                            // ES: Establece la frecuencia de corte del LPF.
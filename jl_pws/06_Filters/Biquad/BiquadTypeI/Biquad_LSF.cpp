@@ -12,15 +12,18 @@
 
 // EN: Constructor for the biquad low-shelving filter (LSF).
 // ES: Constructor para el filtro biquad de tipo shelving bajo (LSF).
-Biquad_LSF::Biquad_LSF() {}
+template <typename SampleType>
+Biquad_LSF_T<SampleType>::Biquad_LSF_T() {}
 
 // EN: Destructor for cleaning up resources.
 // ES: Destructor para limpiar los recursos.
-Biquad_LSF::~Biquad_LSF() {}
+template <typename SampleType>
+Biquad_LSF_T<SampleType>::~Biquad_LSF_T() {}
 
 // EN: Prepares the filter by setting the sample rate and updating filter coefficients.
 // ES: Prepara el filtro configurando la frecuencia de muestreo y actualizando los coeficientes del filtro.
-void Biquad_LSF::prepare(double inSampleRate)
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::prepare(double inSampleRate)
 {
     sampleRate = inSampleRate;
     updateFilter(); // EN: Update coefficients based on the current settings.
@@ -29,31 +32,33 @@ void Biquad_LSF::prepare(double inSampleRate)
 
 // EN: Processes an audio buffer by applying the filter to all samples in all channels.
 // ES: Procesa un buffer de audio aplicando el filtro a todas las muestras en todos los canales.
-void Biquad_LSF::process(juce::AudioBuffer<float> inBuffer)
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
-    for (int channel = 0; channel < inBuffer.getNumChannels(); channel++) // EN: Loop through each channel.
-                                                                          // ES: Recorre cada canal.
+    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // EN: Loop through each channel.
+                                                                        // ES: Recorre cada canal.
     {
-        for (int i = 0; i < inBuffer.getNumSamples(); i++) // EN: Loop through each sample in the channel.
-                                                           // ES: Recorre cada muestra en el canal.
+        for (int i = 0; i < buffer.getNumSamples(); i++) // EN: Loop through each sample in the channel.
+                                                         // ES: Recorre cada muestra en el canal.
         {
-            float inSample = inBuffer.getSample(channel, i); // EN: Get the current sample.
-                                                             // ES: Obtiene la muestra actual.
+            SampleType inSample = buffer.getSample(channel, i); // EN: Get the current sample.
+                                                                // ES: Obtiene la muestra actual.
 
-            float outSample = processSample(inSample, channel); // EN: Process the sample through the filter.
-                                                                // ES: Procesa la muestra a trav�s del filtro.
+            SampleType outSample = processSample(inSample, channel); // EN: Process the sample through the filter.
+                                                                     // ES: Procesa la muestra a trav�s del filtro.
 
-            inBuffer.setSample(channel, i, outSample); // EN: Write the processed sample back to the buffer.
-                                                       // ES: Escribe la muestra procesada de vuelta en el buffer.
+            buffer.setSample(channel, i, outSample); // EN: Write the processed sample back to the buffer.
+                                                     // ES: Escribe la muestra procesada de vuelta en el buffer.
         }
     }
 }
 
 // EN: Processes a single audio sample for a specific channel.
 // ES: Procesa una muestra de audio individual para un canal espec�fico.
-float Biquad_LSF::processSample(float inSample, int channel)
+template <typename SampleType>
+SampleType Biquad_LSF_T<SampleType>::processSample(SampleType inSample, int channel)
 {
-    auto y = (b0 * inSample + b1 * x1[channel] + b2 * x2[channel] + (-a1) * y1[channel] + (-a2) * y2[channel]) * (1.0f / a0);
+    auto y = (b0 * inSample + b1 * x1[channel] + b2 * x2[channel] + (-a1) * y1[channel] + (-a2) * y2[channel]) * (static_cast<SampleType>(1.0) / a0);
 
     // EN: Update delay states for the filter.
     // ES: Actualiza los estados de retardo del filtro.
@@ -72,7 +77,8 @@ float Biquad_LSF::processSample(float inSample, int channel)
 
 // EN: Sets the cutoff frequency for the filter.
 // ES: Establece la frecuencia de corte para el filtro.
-void Biquad_LSF::setFrequency(float inFrequency)
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::setFrequency(float inFrequency)
 {
     frequency = inFrequency;
     updateFilter(); // EN: Update coefficients to reflect the new frequency.
@@ -81,7 +87,8 @@ void Biquad_LSF::setFrequency(float inFrequency)
 
 // EN: Sets the Q factor (resonance) for the filter.
 // ES: Establece el factor Q (resonancia) para el filtro.
-void Biquad_LSF::setQ(float inQ)
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::setQ(float inQ)
 {
     Q = inQ;
     updateFilter(); // EN: Update coefficients to reflect the new Q value.
@@ -90,7 +97,8 @@ void Biquad_LSF::setQ(float inQ)
 
 // EN: Sets the gain for the shelving filter.
 // ES: Establece la ganancia para el filtro shelving.
-void Biquad_LSF::setGain(float inGain)
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::setGain(float inGain)
 {
     Gain = inGain;
     updateFilter(); // EN: Update coefficients to reflect the new gain.
@@ -99,24 +107,38 @@ void Biquad_LSF::setGain(float inGain)
 
 // EN: Updates the filter coefficients based on the current frequency, Q, and gain.
 // ES: Actualiza los coeficientes del filtro seg�n la frecuencia, Q y ganancia actuales.
-void Biquad_LSF::updateFilter()
+template <typename SampleType>
+void Biquad_LSF_T<SampleType>::updateFilter()
 {
     // EN: Calculate intermediate variables for the filter coefficients.
     // ES: Calcula las variables intermedias para los coeficientes del filtro.
-    w0 = (juce::MathConstants<float>::twoPi * frequency) / static_cast<float>(sampleRate); // EN: Angular frequency.
-                                                                                           // ES: Frecuencia angular.
-    alpha = sinf(w0) / (2.0f * Q);  // EN: Bandwidth factor.
-                                    // ES: Factor de ancho de banda.
-    A = sqrt(powf(10.0f, Gain / 20.0f)); // EN: Convert dB gain to linear scale.
-                                         // ES: Convierte la ganancia en dB a escala lineal.
-
-// EN: Calculate filter coefficients for the LSF.
-// ES: Calcula los coeficientes del filtro para el LSF.
-    b0 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha));
-    b1 = 2.0f * A * ((A - 1.0f) - ((A + 1.0f) * cosf(w0)));
-    b2 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha));
-
-    a0 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha);
-    a1 = -2.0f * ((A - 1.0f) + ((A + 1.0f) * cosf(w0)));
-    a2 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha);
-}
\ No newline at end of file
+    w0 = (juce::MathConstants<double>::twoPi * frequency) / sampleRate; // EN: Angular frequency.
+                                                                        // ES: Frecuencia angular.
+    alpha = std::sin(w0) / (2.0 * Q);  // EN: Bandwidth factor.
+                                       // ES: Factor de ancho de banda.
+    A = std::sqrt(std::pow(10.0, Gain / 20.0)); // EN: Convert dB gain to linear scale.
+                                                // ES: Convierte la ganancia en dB a escala lineal.
+
+// EN: Calculate filter coefficients for the LSF, in double, and round them to SampleType.
+// ES: Calcula los coeficientes del filtro para el LSF, en double, y los redondea a SampleType.
+    b0 = static_cast<SampleType>(A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha)));
+    b1 = static_cast<SampleType>(2.0 * A * ((A - 1.0) - ((A + 1.0) * std::cos(w0))));
+    b2 = static_cast<SampleType>(A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha)));
+
+    a0 = static_cast<SampleType>((A + 1.0) + ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha));
+    a1 = static_cast<SampleType>(-2.0 * ((A - 1.0) + ((A + 1.0) * std::cos(w0))));
+    a2 = static_cast<SampleType>((A + 1.0) + ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha));
+}
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+template <typename SampleType>
+TransferFunction Biquad_LSF_T<SampleType>::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
+
+// EN: The two sample types the filter is built for.
+// ES: Los dos tipos de muestra para los que se compila el filtro.
+template class Biquad_LSF_T<float>;
+template class Biquad_LSF_T<double>;
@@ -12,17 +12,20 @@
 //#include "JuceHeader.h"
 
 // EN: Class for implementing a biquad low-shelving filter (LSF).
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
 // ES: Clase para implementar un filtro biquad de tipo shelving bajo (LSF).
-class Biquad_LSF
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class Biquad_LSF_T
 {
 public:
     // EN: Constructor to initialize the filter instance.
     // ES: Constructor para inicializar la instancia del filtro.
-    Biquad_LSF();
+    Biquad_LSF_T();
 
     // EN: Destructor to clean up resources.
     // ES: Destructor para limpiar los recursos.
-    ~Biquad_LSF();
+    ~Biquad_LSF_T();
 
     // EN: Prepares the filter by setting the sample rate and updating coefficients.
     // ES: Prepara el filtro configurando la frecuencia de muestreo y actualizando los coeficientes.
@@ -30,11 +33,15 @@ public:
 
     // EN: Processes an audio buffer by applying the filter to each sample in each channel.
     // ES: Procesa un buffer de audio aplicando el filtro a cada muestra en cada canal.
-    void process(juce::AudioBuffer<float> inBuffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
 
     // EN: Processes a single audio sample for a specific channel.
     // ES: Procesa una muestra de audio individual para un canal espec�fico.
-    float processSample(float inSample, int channel);
+    SampleType processSample(SampleType inSample, int channel);
 
     // EN: Sets the cutoff frequency for the filter.
     // ES: Establece la frecuencia de corte para el filtro.
@@ -59,35 +66,35 @@ private:
 
     // EN: Delay line states for previous input and output samples for both channels.
     // ES: Estados de la l�nea de retardo para muestras de entrada y salida previas en ambos canales.
-    float x1[2] = { 0.0f }; // EN: x[n-1]: previous input sample. 
+    SampleType x1[2] = {};  // EN: x[n-1]: previous input sample. 
                             // ES: x[n-1]: muestra de entrada previa.
-    float x2[2] = { 0.0f }; // EN: x[n-2]: input sample two steps back.
+    SampleType x2[2] = {};  // EN: x[n-2]: input sample two steps back.
                             // ES: x[n-2]: muestra de entrada dos pasos atr�s.
-    float y1[2] = { 0.0f }; // EN: y[n-1]: previous output sample.
+    SampleType y1[2] = {};  // EN: y[n-1]: previous output sample.
                             // ES: y[n-1]: muestra de salida previa.
-    float y2[2] = { 0.0f }; // EN: y[n-2]: output sample two steps back.
+    SampleType y2[2] = {};  // EN: y[n-2]: output sample two steps back.
                             // ES: y[n-2]: muestra de salida dos pasos atr�s.
 
 // EN: Variables for filter calculation.
 // ES: Variables para el c�lculo del filtro.
-    float w0{ 0.0f };       // EN: Angular frequency.
+    double w0{ 0.0 };      // EN: Angular frequency.
                             // ES: Frecuencia angular.
-    float alpha{ 0.0f };    // EN: Bandwidth or damping factor.
+    double alpha{ 0.0 };   // EN: Bandwidth or damping factor.
                             // ES: Ancho de banda o factor de amortiguaci�n.
 
 // EN: Coefficients for the biquad filter.
 // ES: Coeficientes del filtro biquad.
-    float b0{ 0.0f };       // EN: Feedforward coefficient for the current input.
+    SampleType b0{ 0 };     // EN: Feedforward coefficient for the current input.
                             // ES: Coeficiente directo para la entrada actual.
-    float b1{ 0.0f };       // EN: Feedforward coefficient for the previous input.
+    SampleType b1{ 0 };     // EN: Feedforward coefficient for the previous input.
                             // ES: Coeficiente directo para la entrada previa.
-    float b2{ 0.0f };       // EN: Feedforward coefficient for the input two steps back.
+    SampleType b2{ 0 };     // EN: Feedforward coefficient for the input two steps back.
                             // ES: Coeficiente directo para la entrada dos pasos atr�s.
-    float a0{ 0.0f };       // EN: Normalization factor.
+    SampleType a0{ 0 };     // EN: Normalization factor.
                             // ES: Factor de normalizaci�n.
-    float a1{ 0.0f };       // EN: Feedback coefficient for the previous output.
+    SampleType a1{ 0 };     // EN: Feedback coefficient for the previous output.
                             // ES: Coeficiente de realimentaci�n para la salida previa.
-    float a2{ 0.0f };       // EN: Feedback coefficient for the output two steps back.
+    SampleType a2{ 0 };     // EN: Feedback coefficient for the output two steps back.
                             // ES: Coeficiente de realimentaci�n para la salida dos pasos atr�s.
 
 // EN: Filter parameters.
@@ -98,6 +105,10 @@ private:
                                 // ES: Factor de calidad (resonancia).
     float Gain{ 0.0f };         // EN: Gain in dB for the shelving filter.
                                 // ES: Ganancia en dB para el filtro shelving.
-    float A{ 0.0f };            // EN: Linear gain value derived from the dB gain.
+    double A{ 0.0 };           // EN: Linear gain value derived from the dB gain.
                                 // ES: Valor de ganancia lineal derivado de la ganancia en dB.
 };
+
+// EN: The float version keeps the original name; Biquad_LSF_T<double> is the double version.
+// ES: La versión float conserva el nombre original; Biquad_LSF_T<double> es la versión double.
+using Biquad_LSF = Biquad_LSF_T<float>;
@@ -108,3 +108,10 @@ void Biquad_Notch::updateFilter()
     a2 = 1.0f - alpha;              // EN: a2 coefficient.
                                     // ES: Coeficiente a2.
 }
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_Notch::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
@@ -119,4 +119,11 @@ void Biquad_Peaking::updateFilter()
     a0 = 1.0 + alpha / A;
     a1 = -2.0f * cosf(w0);
     a2 = 1.0f - alpha / A;
-}
\ No newline at end of file
+}
+
+// EN: Type I divides by a0 while processing, so a0 is part of the transfer function.
+// ES: El tipo I divide por a0 al procesar, así que a0 forma parte de la función de transferencia.
+TransferFunction Biquad_Peaking::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, a0, a1, a2);
+}
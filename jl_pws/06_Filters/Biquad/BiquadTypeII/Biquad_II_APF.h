@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio, aplicando el filtro All-Pass a cada canal y muestra.
     void process(juce::AudioBuffer<float>& inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single audio sample for a specific channel using the filter.
     // ES: Procesa una �nica muestra de audio para un canal espec�fico utilizando el filtro.
     float processSample(float inSample, int channel);
@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio, aplicando el filtro a cada canal y muestra.
     void process(juce::AudioBuffer<float>& inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample through the filter for a specific channel.
     // ES: Procesa una muestra a trav�s del filtro para un canal espec�fico.
     float processSample(float inSample, int channel);
@@ -32,6 +32,10 @@ public:
     // ES: Procesa un buffer de audio, aplicando el filtro pasa altos a todas las muestras y canales.
     void process(juce::AudioBuffer<float>& inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample for a specific channel.
     // ES: Procesa una �nica muestra para un canal espec�fico.
     float processSample(float inSample, int channel);
@@ -12,15 +12,18 @@
 
 // EN: Constructor - No additional initialization is required as all members are initialized in the class definition.
 // ES: Constructor - No se requiere inicializaci�n adicional ya que todos los miembros se inicializan en la definici�n de la clase.
-Biquad_II_LSF::Biquad_II_LSF() {}
+template <typename SampleType>
+Biquad_II_LSF_T<SampleType>::Biquad_II_LSF_T() {}
 
 // EN: Destructor - Cleans up any resources allocated by the class.
 // ES: Destructor - Limpia cualquier recurso asignado por la clase.
-Biquad_II_LSF::~Biquad_II_LSF() {}
+template <typename SampleType>
+Biquad_II_LSF_T<SampleType>::~Biquad_II_LSF_T() {}
 
 // EN: Prepares the filter with the given sample rate and updates the filter coefficients.
 // ES: Prepara el filtro con la frecuencia de muestreo dada y actualiza los coeficientes del filtro.
-void Biquad_II_LSF::prepare(double inSampleRate)
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::prepare(double inSampleRate)
 {
     sampleRate = inSampleRate;
     updateFilter(); // EN: Updates the filter coefficients based on the sample rate. 
@@ -29,10 +32,11 @@ void Biquad_II_LSF::prepare(double inSampleRate)
 
 // EN: Processes the entire audio buffer, applying the filter to each sample.
 // ES: Procesa el buffer de audio completo, aplicando el filtro a cada muestra.
-void Biquad_II_LSF::process(juce::AudioBuffer<float> inBuffer)
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
-    int numChannels = inBuffer.getNumChannels();
-    int numSamples = inBuffer.getNumSamples();
+    int numChannels = buffer.getNumChannels();
+    int numSamples = buffer.getNumSamples();
 
     // EN: Loops through all the channels and samples in the buffer and applies the filter.
     // ES: Recorre todos los canales y muestras en el buffer y aplica el filtro.
@@ -42,22 +46,23 @@ void Biquad_II_LSF::process(juce::AudioBuffer<float> inBuffer)
         {
             // EN: Retrieves the current sample from the buffer.
             // ES: Obtiene la muestra actual del buffer.
-            float inSample = inBuffer.getSample(channel, i);
+            SampleType inSample = buffer.getSample(channel, i);
 
             // EN: Processes the sample using the filter and stores the output.
             // ES: Procesa la muestra utilizando el filtro y almacena el resultado.
-            float outSample = processSample(inSample, channel);
+            SampleType outSample = processSample(inSample, channel);
 
             // EN: Sets the processed sample back into the buffer.
             // ES: Coloca la muestra procesada de nuevo en el buffer.
-            inBuffer.setSample(channel, i, outSample);
+            buffer.setSample(channel, i, outSample);
         }
     }
 }
 
 // EN: Processes a single sample of audio for the specified channel.
 // ES: Procesa una sola muestra de audio para el canal especificado.
-float Biquad_II_LSF::processSample(float inSample, int channel)
+template <typename SampleType>
+SampleType Biquad_II_LSF_T<SampleType>::processSample(SampleType inSample, int channel)
 {
     // EN: Computes the input to the filter (w) based on the previous states.
     // ES: Calcula la entrada al filtro (w) en funci�n de los estados previos.
@@ -78,7 +83,8 @@ float Biquad_II_LSF::processSample(float inSample, int channel)
 
 // EN: Sets the frequency of the filter and updates the filter coefficients.
 // ES: Establece la frecuencia del filtro y actualiza los coeficientes del filtro.
-void Biquad_II_LSF::setFrequency(float inFrequency)
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::setFrequency(float inFrequency)
 {
     frequency = inFrequency;
     updateFilter(); // EN: Updates the filter coefficients with the new frequency.
@@ -87,7 +93,8 @@ void Biquad_II_LSF::setFrequency(float inFrequency)
 
 // EN: Sets the quality factor (Q) of the filter and updates the filter coefficients.
 // ES: Establece el factor de calidad (Q) del filtro y actualiza los coeficientes del filtro.
-void Biquad_II_LSF::setQ(float inQ)
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::setQ(float inQ)
 {
     Q = inQ;
     updateFilter(); // EN: Updates the filter coefficients with the new Q value.
@@ -96,7 +103,8 @@ void Biquad_II_LSF::setQ(float inQ)
 
 // EN: Sets the gain of the filter and updates the filter coefficients.
 // ES: Establece la ganancia del filtro y actualiza los coeficientes del filtro.
-void Biquad_II_LSF::setGain(float inGain)
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::setGain(float inGain)
 {
     Gain = inGain;
     updateFilter(); // EN: Updates the filter coefficients with the new gain value.
@@ -105,35 +113,50 @@ void Biquad_II_LSF::setGain(float inGain)
 
 // EN: Updates the filter coefficients based on the current frequency, Q, and gain.
 // ES: Actualiza los coeficientes del filtro seg�n la frecuencia, Q y ganancia actuales.
-void Biquad_II_LSF::updateFilter()
+template <typename SampleType>
+void Biquad_II_LSF_T<SampleType>::updateFilter()
 {
     // EN: Calculates the angular frequency (w0) for the filter based on the sample rate.
     // ES: Calcula la frecuencia angular (w0) para el filtro en funci�n de la frecuencia de muestreo.
-    w0 = (juce::MathConstants<float>::twoPi * frequency) / static_cast<float>(sampleRate);
+    w0 = (juce::MathConstants<double>::twoPi * frequency) / sampleRate;
 
     // EN: Calculates the alpha parameter used for coefficient calculations.
     // ES: Calcula el par�metro alpha utilizado para el c�lculo de coeficientes.
-    alpha = sinf(w0) / (2.0f * Q);
+    alpha = std::sin(w0) / (2.0 * Q);
 
     // EN: Calculates the 'A' value for gain adjustments.
     // ES: Calcula el valor 'A' para los ajustes de ganancia.
-    A = sqrt(powf(10.0f, Gain / 20.0f));
+    A = std::sqrt(std::pow(10.0, Gain / 20.0));
 
     // EN: Computes the filter coefficients (b0, b1, b2, a0, a1, a2) based on the frequency, Q, and gain.
     // ES: Calcula los coeficientes del filtro (b0, b1, b2, a0, a1, a2) en funci�n de la frecuencia, Q y ganancia.
-    b0 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha));
-    b1 = 2.0f * A * ((A - 1.0f) - ((A + 1.0f) * cosf(w0)));
-    b2 = A * ((A + 1.0f) - ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha));
-
-    a0 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) + (2.0f * sqrtf(A) * alpha);
-    a1 = -2.0f * ((A - 1.0f) + ((A + 1.0f) * cosf(w0)));
-    a2 = (A + 1.0f) + ((A - 1.0f) * cosf(w0)) - (2.0f * sqrtf(A) * alpha);
-
-    // EN: Normalizes the coefficients by dividing them by a0.
-    // ES: Normaliza los coeficientes dividi�ndolos por a0.
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
+    const double cb0 = A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha));
+    const double cb1 = 2.0 * A * ((A - 1.0) - ((A + 1.0) * std::cos(w0)));
+    const double cb2 = A * ((A + 1.0) - ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha));
+
+    const double ca0 = (A + 1.0) + ((A - 1.0) * std::cos(w0)) + (2.0 * std::sqrt(A) * alpha);
+    const double ca1 = -2.0 * ((A - 1.0) + ((A + 1.0) * std::cos(w0)));
+    const double ca2 = (A + 1.0) + ((A - 1.0) * std::cos(w0)) - (2.0 * std::sqrt(A) * alpha);
+
+    // EN: Normalizes the coefficients by dividing them by a0 in double, then rounds them to SampleType.
+    // ES: Normaliza los coeficientes dividi�ndolos por a0 en double, luego los redondea a SampleType.
+    b0 = static_cast<SampleType>(cb0 / ca0);
+    b1 = static_cast<SampleType>(cb1 / ca0);
+    b2 = static_cast<SampleType>(cb2 / ca0);
+    a0 = static_cast<SampleType>(ca0);
+    a1 = static_cast<SampleType>(ca1 / ca0);
+    a2 = static_cast<SampleType>(ca2 / ca0);
 }
+
+// EN: The coefficients are already divided by a0, so the denominator starts with 1.
+// ES: Los coeficientes ya están divididos por a0, así que el denominador empieza con 1.
+template <typename SampleType>
+TransferFunction Biquad_II_LSF_T<SampleType>::getTransferFunction() const
+{
+    return TransferFunction::fromBiquad(b0, b1, b2, 1.0, a1, a2);
+}
+
+// EN: The two sample types the filter is built for.
+// ES: Los dos tipos de muestra para los que se compila el filtro.
+template class Biquad_II_LSF_T<float>;
+template class Biquad_II_LSF_T<double>;
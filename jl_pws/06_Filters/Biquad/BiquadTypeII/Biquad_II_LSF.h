@@ -11,16 +11,21 @@
 #pragma once
 //#include <JuceHeader.h>
 
-class Biquad_II_LSF
+// EN: Biquad low-shelf filter (LSF) in Direct Form II.
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
+// ES: Filtro biquad de estante bajo (LSF) en Forma Directa II.
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class Biquad_II_LSF_T
 {
 public:
     // EN: Constructor - No additional initialization is required as all members are initialized in the class definition.
     // ES: Constructor - No se requiere inicializaci�n adicional ya que todos los miembros se inicializan en la definici�n de la clase.
-    Biquad_II_LSF();
+    Biquad_II_LSF_T();
 
     // EN: Destructor - Cleans up any resources allocated by the class.
     // ES: Destructor - Limpia cualquier recurso asignado por la clase.
-    ~Biquad_II_LSF();
+    ~Biquad_II_LSF_T();
 
     // EN: Prepares the filter with the given sample rate.
     // ES: Prepara el filtro con la frecuencia de muestreo dada.
@@ -28,11 +33,15 @@ public:
 
     // EN: Processes the entire audio buffer, applying the filter to each sample.
     // ES: Procesa el buffer de audio completo, aplicando el filtro a cada muestra.
-    void process(juce::AudioBuffer<float> inBuffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
 
     // EN: Processes a single sample of audio for the specified channel.
     // ES: Procesa una sola muestra de audio para el canal especificado.
-    float processSample(float inSample, int channel);
+    SampleType processSample(SampleType inSample, int channel);
 
     // EN: Sets the frequency of the filter and updates the filter coefficients.
     // ES: Establece la frecuencia del filtro y actualiza los coeficientes del filtro.
@@ -57,25 +66,25 @@ private:
 
     // EN: State variables for the filter, used for storing delayed values.
     // ES: Variables de estado para el filtro, utilizadas para almacenar valores retardados.
-    float w1[2] = { 0.0f };
-    float w2[2] = { 0.0f };
+    SampleType w1[2] = {};
+    SampleType w2[2] = {};
 
     // EN: The angular frequency of the filter.
     // ES: La frecuencia angular del filtro.
-    float w0{ 0.0f };
+    double w0{ 0.0 };
 
     // EN: The alpha parameter used to calculate filter coefficients.
     // ES: El par�metro alpha utilizado para calcular los coeficientes del filtro.
-    float alpha{ 0.0f };
+    double alpha{ 0.0 };
 
     // EN: Filter coefficients for the Biquad filter.
     // ES: Coeficientes del filtro Biquad.
-    float b0{ 0.0f };
-    float b1{ 0.0f };
-    float b2{ 0.0f };
-    float a0{ 0.0f };
-    float a1{ 0.0f };
-    float a2{ 0.0f };
+    SampleType b0{ 0 };
+    SampleType b1{ 0 };
+    SampleType b2{ 0 };
+    SampleType a0{ 0 };
+    SampleType a1{ 0 };
+    SampleType a2{ 0 };
 
     // EN: Frequency, Q, and gain parameters for the filter.
     // ES: Par�metros de frecuencia, Q y ganancia para el filtro.
@@ -85,5 +94,9 @@ private:
 
     // EN: The 'A' value used for gain adjustments in the filter.
     // ES: El valor 'A' utilizado para los ajustes de ganancia en el filtro.
-    float A{ 0.0f };
+    double A{ 0.0 };
 };
+
+// EN: The float version keeps the original name; Biquad_II_LSF_T<double> is the double version.
+// ES: La versión float conserva el nombre original; Biquad_II_LSF_T<double> es la versión double.
+using Biquad_II_LSF = Biquad_II_LSF_T<float>;
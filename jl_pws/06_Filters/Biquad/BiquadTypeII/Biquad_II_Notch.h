@@ -32,6 +32,10 @@ public:
     // ES: Procesa el buffer de audio completo aplicando el filtro a cada muestra.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample of audio for a specific channel.
     // ES: Procesa una sola muestra de audio para un canal espec�fico.
     float processSample(float inSample, int channel);
@@ -40,6 +40,10 @@ public:
     //     Itera sobre todos los canales y muestras del buffer para aplicar el filtro.
     void process(juce::AudioBuffer<float> inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample for a specific channel by applying the peaking filter.
     //     This function calculates the filter output based on the current sample and the filter state.
     // ES: Procesa una sola muestra para un canal espec�fico aplicando el filtro de pico.
@@ -69,3 +69,13 @@ void DirectFormII_APF::setG(float inG)
 {
     g = inG;
 }
+
+// EN: y[n] = g x[n] + x[n-1] - g y[n-1], so H(z) = (g + z^-1) / (1 + g z^-1).
+// ES: y[n] = g x[n] + x[n-1] - g y[n-1], así que H(z) = (g + z^-1) / (1 + g z^-1).
+TransferFunction DirectFormII_APF::getTransferFunction() const
+{
+    TransferFunction h;
+    h.b = { g, 1.0 };
+    h.a = { 1.0, g };
+    return h;
+}
@@ -29,6 +29,10 @@ public:
     // ES: Procesa un buffer completo de audio a través del APF.
     void process(juce::AudioBuffer<float>& inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single sample through the APF for a specific channel.
     // ES: Procesa una muestra individual a través del APF para un canal específico.
     float processSample(float inSample, int channel);
@@ -77,3 +77,15 @@ void DirectFormII_NestedAPF::setG(float inG1, float inG2)
     g1 = inG1; // EN: Gain for the first APF stage. | ES: Ganancia para la primera etapa del APF.
     g2 = inG2; // EN: Gain for the second APF stage. | ES: Ganancia para la segunda etapa del APF.
 }
+
+// EN: From processSample: W1 = X / (1 + g1 z^-2), V = z^-1 W1 / (1 + g2 z^-1) and Y = X + g2 z^-1 V,
+//     so H(z) = [(1 + g1 z^-2)(1 + g2 z^-1) + g2 z^-2] / [(1 + g1 z^-2)(1 + g2 z^-1)].
+// ES: Desde processSample: W1 = X / (1 + g1 z^-2), V = z^-1 W1 / (1 + g2 z^-1) y Y = X + g2 z^-1 V,
+//     así que H(z) = [(1 + g1 z^-2)(1 + g2 z^-1) + g2 z^-2] / [(1 + g1 z^-2)(1 + g2 z^-1)].
+TransferFunction DirectFormII_NestedAPF::getTransferFunction() const
+{
+    TransferFunction h;
+    h.a = { 1.0, g2, g1, g1 * g2 };
+    h.b = { 1.0, g2, g1 + g2, g1 * g2 };
+    return h;
+}
@@ -28,6 +28,10 @@ public:
     // ES: Procesa un buffer de audio completo a trav�s del APF anidado.
     void process(juce::AudioBuffer<float>& inBuffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Processes a single audio sample through the nested APF for a specific channel.
     // ES: Procesa una sola muestra de audio a trav�s del APF anidado para un canal espec�fico.
     float processSample(float inSample, int channel);
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    FIR_Decimator.cpp
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FIR_Decimator.h"
+
+// EN: Constructor of FIR_Decimator class.
+// ES: Constructor de la clase FIR_Decimator.
+FIR_Decimator::FIR_Decimator()
+{
+}
+
+// EN: Destructor of FIR_Decimator class.
+// ES: Destructor de la clase FIR_Decimator.
+FIR_Decimator::~FIR_Decimator()
+{
+}
+
+// EN: Sets the decimation factor M. The filter is redesigned in prepare.
+// ES: Establece el factor de decimación M. El filtro se rediseña en prepare.
+void FIR_Decimator::setFactor(int newFactor)
+{
+    factor = juce::jmax(1, newFactor);
+}
+
+// EN: Sets the number of taps per polyphase branch.
+// ES: Establece el número de coeficientes por rama polifásica.
+void FIR_Decimator::setTapsPerPhase(int newTapsPerPhase)
+{
+    tapsPerPhase = juce::jmax(2, newTapsPerPhase);
+}
+
+// EN: Selects between the Kaiser (FIR_LPF2) and Hamming (FIR_LPF) designs.
+// ES: Selecciona entre los diseños Kaiser (FIR_LPF2) y Hamming (FIR_LPF).
+void FIR_Decimator::setKaiserDesign(bool useKaiser)
+{
+    kaiserDesign = useKaiser;
+}
+
+// EN: Prepares the decimator: stores the configuration, designs the filter and allocates the history.
+// ES: Prepara el decimador: almacena la configuración, diseña el filtro y reserva el historial.
+void FIR_Decimator::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    sampleRate = inSampleRate;
+    samplesPerBlock = inSamplesPerBlock;
+    numChannels = inChannels;
+    numTaps = factor * tapsPerPhase;
+
+    updateFilter();
+
+    // EN: Each channel keeps 2 * N samples so the window of the last N samples never wraps.
+    // ES: Cada canal guarda 2 * N muestras para que la ventana de las últimas N muestras nunca se divida.
+    history.assign(numChannels, std::vector<float>(2 * numTaps, 0.0f));
+    reset();
+}
+
+// EN: Clears the history and restarts the polyphase position.
+// ES: Limpia el historial y reinicia la posición polifásica.
+void FIR_Decimator::reset()
+{
+    for (auto& channelHistory : history)
+        std::fill(channelHistory.begin(), channelHistory.end(), 0.0f);
+
+    writeIndex = 0;
+    phase = 0;
+}
+
+// EN: Returns ceil(blockSize / M), the maximum number of outputs per block.
+// ES: Devuelve ceil(blockSize / M), el número máximo de salidas por bloque.
+int FIR_Decimator::getMaxOutputSamples() const
+{
+    return (samplesPerBlock + factor - 1) / factor;
+}
+
+// EN: Decimates each channel. Every input sample is stored in the history, but the filter
+//     is only evaluated for the one sample in M that is kept.
+// ES: Decima cada canal. Cada muestra de entrada se guarda en el historial, pero el filtro
+//     solo se evalúa para la única muestra de cada M que se conserva.
+int FIR_Decimator::process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output)
+{
+    const int numSamples = input.getNumSamples();
+    const int channels = juce::jmin(input.getNumChannels(), output.getNumChannels(), numChannels);
+    int numOutputs = 0;
+
+    // EN: All channels advance the same way, so each one starts from the same saved state.
+    // ES: Todos los canales avanzan igual, así que cada uno parte del mismo estado guardado.
+    const int startWriteIndex = writeIndex;
+    const int startPhase = phase;
+
+    for (int channel = 0; channel < channels; channel++)
+    {
+        const float* inData = input.getReadPointer(channel);
+        float* outData = output.getWritePointer(channel);
+        float* channelHistory = history[channel].data();
+
+        int index = startWriteIndex;
+        int countdown = startPhase;
+        int outIndex = 0;
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            // EN: Write the sample twice so that [index + 1, index + N] holds the last N samples in order.
+            // ES: Escribe la muestra dos veces para que [index + 1, index + N] contenga las últimas N muestras en orden.
+            channelHistory[index] = inData[i];
+            channelHistory[index + numTaps] = inData[i];
+
+            if (countdown == 0)
+            {
+                jassert(outIndex < output.getNumSamples());
+                outData[outIndex++] = FIR_Polyphase::dotProduct(coefficients.data(), channelHistory + index + 1, numTaps);
+                countdown = factor;
+            }
+
+            countdown--;
+
+            if (++index >= numTaps)
+                index = 0;
+        }
+
+        writeIndex = index;
+        phase = countdown;
+        numOutputs = outIndex;
+    }
+
+    return numOutputs;
+}
+
+// EN: Designs the anti-aliasing filter at the input rate with its cutoff just below the output Nyquist.
+// ES: Diseña el filtro anti-aliasing a la tasa de entrada con su corte justo por debajo del Nyquist de salida.
+void FIR_Decimator::updateFilter()
+{
+    const size_t order = static_cast<size_t>(numTaps - 1);
+
+    auto prototype = FIR_Polyphase::designPrototype(kaiserDesign, sampleRate / factor, sampleRate, order);
+
+    const float* taps = prototype->getRawCoefficients();
+
+    // EN: Store the taps reversed so the newest sample (last in the window) meets h[0].
+    // ES: Guarda los coeficientes invertidos para que la muestra más reciente (última en la ventana) use h[0].
+    coefficients.resize(numTaps);
+    for (int k = 0; k < numTaps; k++)
+        coefficients[numTaps - 1 - k] = taps[k];
+}
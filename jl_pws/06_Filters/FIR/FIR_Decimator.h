@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    FIR_Decimator.h
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: FIR_Decimator class reduces the sample rate by an integer factor M using a polyphase FIR low-pass filter.
+//     The anti-aliasing filter is designed with the FIR_LPF (Hamming) or FIR_LPF2 (Kaiser) designers,
+//     and only the outputs that are kept are computed, so the cost is N / M multiplies per input sample.
+// ES: La clase FIR_Decimator reduce la tasa de muestreo por un factor entero M usando un filtro FIR de paso bajo polifásico.
+//     El filtro anti-aliasing se diseña con los diseñadores de FIR_LPF (Hamming) o FIR_LPF2 (Kaiser),
+//     y solo se calculan las salidas que se conservan, por lo que el costo es N / M multiplicaciones por muestra de entrada.
+class FIR_Decimator
+{
+public:
+    // EN: Constructor of the FIR_Decimator class, initializes the decimator with default values.
+    // ES: Constructor de la clase FIR_Decimator, inicializa el decimador con valores predeterminados.
+    FIR_Decimator();
+
+    // EN: Destructor of the FIR_Decimator class.
+    // ES: Destructor de la clase FIR_Decimator.
+    ~FIR_Decimator();
+
+    // EN: Sets the decimation factor M (output rate = input rate / M). Call before prepare.
+    // ES: Establece el factor de decimación M (tasa de salida = tasa de entrada / M). Llamar antes de prepare.
+    void setFactor(int newFactor);
+
+    // EN: Sets the number of filter taps per polyphase branch. The prototype filter has factor * taps coefficients.
+    // ES: Establece el número de coeficientes por rama polifásica. El filtro prototipo tiene factor * taps coeficientes.
+    void setTapsPerPhase(int newTapsPerPhase);
+
+    // EN: Selects the Kaiser design of FIR_LPF2 (true) or the Hamming design of FIR_LPF (false).
+    // ES: Selecciona el diseño Kaiser de FIR_LPF2 (true) o el diseño Hamming de FIR_LPF (false).
+    void setKaiserDesign(bool useKaiser);
+
+    // EN: Prepares the decimator with the input sample rate, block size, and number of channels.
+    //     Allocates the history buffers and designs the anti-aliasing filter.
+    // ES: Prepara el decimador con la tasa de muestreo de entrada, el tamaño del bloque y el número de canales.
+    //     Reserva los buffers de historial y diseña el filtro anti-aliasing.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the filter history and the polyphase position.
+    // ES: Limpia el historial del filtro y la posición polifásica.
+    void reset();
+
+    // EN: Decimates the input buffer into the output buffer and returns the number of output samples written.
+    //     The output buffer must hold at least getMaxOutputSamples() samples per channel.
+    // ES: Decima el buffer de entrada en el buffer de salida y devuelve el número de muestras de salida escritas.
+    //     El buffer de salida debe tener al menos getMaxOutputSamples() muestras por canal.
+    int process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output);
+
+    // EN: Returns the largest number of output samples a block of the prepared size can produce.
+    // ES: Devuelve el mayor número de muestras de salida que puede producir un bloque del tamaño preparado.
+    int getMaxOutputSamples() const;
+
+private:
+    // EN: Designs the prototype low-pass filter and stores it reversed for the dot product.
+    // ES: Diseña el filtro prototipo de paso bajo y lo almacena invertido para el producto punto.
+    void updateFilter();
+
+    // EN: Reversed prototype coefficients (oldest sample first).
+    // ES: Coeficientes del prototipo invertidos (muestra más antigua primero).
+    std::vector<float> coefficients;
+
+    // EN: Doubled circular history for each channel, so the last N samples are always contiguous.
+    // ES: Historial circular duplicado para cada canal, de modo que las últimas N muestras siempre son contiguas.
+    std::vector<std::vector<float>> history;
+
+    // EN: Write index in the circular history (shared by all channels).
+    // ES: Índice de escritura en el historial circular (compartido por todos los canales).
+    int writeIndex{ 0 };
+
+    // EN: Number of input samples left until the next output sample is computed.
+    // ES: Número de muestras de entrada restantes hasta calcular la siguiente muestra de salida.
+    int phase{ 0 };
+
+    // EN: Decimation factor, taps per polyphase branch, and total number of taps.
+    // ES: Factor de decimación, coeficientes por rama polifásica y número total de coeficientes.
+    int factor{ 4 };
+    int tapsPerPhase{ 16 };
+    int numTaps{ 64 };
+
+    // EN: Block size and channel count given in prepare.
+    // ES: Tamaño de bloque y número de canales dados en prepare.
+    int samplesPerBlock{ 0 };
+    int numChannels{ 0 };
+
+    // EN: Input sample rate and design selection.
+    // ES: Tasa de muestreo de entrada y selección del diseño.
+    double sampleRate{ 48000.0 };
+    bool kaiserDesign{ false };
+};
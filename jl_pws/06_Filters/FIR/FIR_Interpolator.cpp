@@ -0,0 +1,137 @@
+/*
+  ==============================================================================
+
+    FIR_Interpolator.cpp
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FIR_Interpolator.h"
+
+// EN: Constructor of FIR_Interpolator class.
+// ES: Constructor de la clase FIR_Interpolator.
+FIR_Interpolator::FIR_Interpolator()
+{
+}
+
+// EN: Destructor of FIR_Interpolator class.
+// ES: Destructor de la clase FIR_Interpolator.
+FIR_Interpolator::~FIR_Interpolator()
+{
+}
+
+// EN: Sets the interpolation factor L. The filter is redesigned in prepare.
+// ES: Establece el factor de interpolación L. El filtro se rediseña en prepare.
+void FIR_Interpolator::setFactor(int newFactor)
+{
+    factor = juce::jmax(1, newFactor);
+}
+
+// EN: Sets the number of taps per polyphase branch.
+// ES: Establece el número de coeficientes por rama polifásica.
+void FIR_Interpolator::setTapsPerPhase(int newTapsPerPhase)
+{
+    tapsPerPhase = juce::jmax(2, newTapsPerPhase);
+}
+
+// EN: Selects between the Kaiser (FIR_LPF2) and Hamming (FIR_LPF) designs.
+// ES: Selecciona entre los diseños Kaiser (FIR_LPF2) y Hamming (FIR_LPF).
+void FIR_Interpolator::setKaiserDesign(bool useKaiser)
+{
+    kaiserDesign = useKaiser;
+}
+
+// EN: Prepares the interpolator: stores the configuration, designs the filter and allocates the history.
+// ES: Prepara el interpolador: almacena la configuración, diseña el filtro y reserva el historial.
+void FIR_Interpolator::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    sampleRate = inSampleRate;
+    samplesPerBlock = inSamplesPerBlock;
+    numChannels = inChannels;
+
+    updateFilter();
+
+    history.assign(numChannels, std::vector<float>(2 * tapsPerPhase, 0.0f));
+    reset();
+}
+
+// EN: Clears the history.
+// ES: Limpia el historial.
+void FIR_Interpolator::reset()
+{
+    for (auto& channelHistory : history)
+        std::fill(channelHistory.begin(), channelHistory.end(), 0.0f);
+
+    writeIndex = 0;
+}
+
+// EN: Returns blockSize * L, the number of outputs per block.
+// ES: Devuelve blockSize * L, el número de salidas por bloque.
+int FIR_Interpolator::getMaxOutputSamples() const
+{
+    return samplesPerBlock * factor;
+}
+
+// EN: Interpolates each channel. For every input sample the L branches are evaluated against the
+//     same history window, producing L output samples without ever touching an inserted zero.
+// ES: Interpola cada canal. Para cada muestra de entrada se evalúan las L ramas sobre la misma
+//     ventana del historial, produciendo L muestras de salida sin tocar nunca un cero insertado.
+int FIR_Interpolator::process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output)
+{
+    const int numSamples = input.getNumSamples();
+    const int channels = juce::jmin(input.getNumChannels(), output.getNumChannels(), numChannels);
+    const int startWriteIndex = writeIndex;
+
+    jassert(numSamples * factor <= output.getNumSamples());
+
+    for (int channel = 0; channel < channels; channel++)
+    {
+        const float* inData = input.getReadPointer(channel);
+        float* outData = output.getWritePointer(channel);
+        float* channelHistory = history[channel].data();
+
+        int index = startWriteIndex;
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            channelHistory[index] = inData[i];
+            channelHistory[index + tapsPerPhase] = inData[i];
+
+            const float* window = channelHistory + index + 1;
+            float* out = outData + i * factor;
+
+            for (int p = 0; p < factor; p++)
+                out[p] = FIR_Polyphase::dotProduct(branches.data() + p * tapsPerPhase, window, tapsPerPhase);
+
+            if (++index >= tapsPerPhase)
+                index = 0;
+        }
+
+        writeIndex = index;
+    }
+
+    return numSamples * factor;
+}
+
+// EN: Designs the prototype at the output rate (input rate * L) with its cutoff just below the input Nyquist,
+//     then splits it so that branch p holds h[p], h[p + L], h[p + 2L], ...
+// ES: Diseña el prototipo a la tasa de salida (tasa de entrada * L) con su corte justo por debajo del Nyquist de entrada,
+//     y luego lo divide para que la rama p contenga h[p], h[p + L], h[p + 2L], ...
+void FIR_Interpolator::updateFilter()
+{
+    const int numTaps = factor * tapsPerPhase;
+    const double upsampledRate = sampleRate * factor;
+    const size_t order = static_cast<size_t>(numTaps - 1);
+
+    auto prototype = FIR_Polyphase::designPrototype(kaiserDesign, sampleRate, upsampledRate, order);
+
+    const float* taps = prototype->getRawCoefficients();
+    const float gain = static_cast<float>(factor);
+
+    branches.assign(numTaps, 0.0f);
+    for (int p = 0; p < factor; p++)
+        for (int j = 0; j < tapsPerPhase; j++)
+            branches[p * tapsPerPhase + (tapsPerPhase - 1 - j)] = gain * taps[p + j * factor];
+}
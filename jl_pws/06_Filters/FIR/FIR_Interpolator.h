@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    FIR_Interpolator.h
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: FIR_Interpolator class raises the sample rate by an integer factor L using a polyphase FIR low-pass filter.
+//     The prototype filter (FIR_LPF or FIR_LPF2 design) is split into L branches, so the zeros that a
+//     zero-stuffing upsampler would insert are never multiplied: each output costs N / L multiplies.
+// ES: La clase FIR_Interpolator eleva la tasa de muestreo por un factor entero L usando un filtro FIR de paso bajo polifásico.
+//     El filtro prototipo (diseño de FIR_LPF o FIR_LPF2) se divide en L ramas, así que los ceros que insertaría
+//     un sobremuestreador nunca se multiplican: cada salida cuesta N / L multiplicaciones.
+class FIR_Interpolator
+{
+public:
+    // EN: Constructor of the FIR_Interpolator class, initializes the interpolator with default values.
+    // ES: Constructor de la clase FIR_Interpolator, inicializa el interpolador con valores predeterminados.
+    FIR_Interpolator();
+
+    // EN: Destructor of the FIR_Interpolator class.
+    // ES: Destructor de la clase FIR_Interpolator.
+    ~FIR_Interpolator();
+
+    // EN: Sets the interpolation factor L (output rate = input rate * L). Call before prepare.
+    // ES: Establece el factor de interpolación L (tasa de salida = tasa de entrada * L). Llamar antes de prepare.
+    void setFactor(int newFactor);
+
+    // EN: Sets the number of filter taps per polyphase branch. The prototype filter has factor * taps coefficients.
+    // ES: Establece el número de coeficientes por rama polifásica. El filtro prototipo tiene factor * taps coeficientes.
+    void setTapsPerPhase(int newTapsPerPhase);
+
+    // EN: Selects the Kaiser design of FIR_LPF2 (true) or the Hamming design of FIR_LPF (false).
+    // ES: Selecciona el diseño Kaiser de FIR_LPF2 (true) o el diseño Hamming de FIR_LPF (false).
+    void setKaiserDesign(bool useKaiser);
+
+    // EN: Prepares the interpolator with the input sample rate, block size, and number of channels.
+    // ES: Prepara el interpolador con la tasa de muestreo de entrada, el tamaño del bloque y el número de canales.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the filter history.
+    // ES: Limpia el historial del filtro.
+    void reset();
+
+    // EN: Interpolates the input buffer into the output buffer and returns the number of output samples written.
+    //     The output buffer must hold at least getMaxOutputSamples() samples per channel.
+    // ES: Interpola el buffer de entrada en el buffer de salida y devuelve el número de muestras de salida escritas.
+    //     El buffer de salida debe tener al menos getMaxOutputSamples() muestras por canal.
+    int process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output);
+
+    // EN: Returns the number of output samples a block of the prepared size produces (blockSize * L).
+    // ES: Devuelve el número de muestras de salida que produce un bloque del tamaño preparado (blockSize * L).
+    int getMaxOutputSamples() const;
+
+private:
+    // EN: Designs the prototype filter and splits it into L reversed polyphase branches.
+    // ES: Diseña el filtro prototipo y lo divide en L ramas polifásicas invertidas.
+    void updateFilter();
+
+    // EN: Polyphase branches stored one after another: branch p occupies [p * taps, (p + 1) * taps).
+    //     Each branch is reversed and already scaled by L to keep unity passband gain.
+    // ES: Ramas polifásicas almacenadas una tras otra: la rama p ocupa [p * taps, (p + 1) * taps).
+    //     Cada rama está invertida y ya escalada por L para mantener ganancia unitaria en la banda de paso.
+    std::vector<float> branches;
+
+    // EN: Doubled circular history for each channel, so the last taps samples are always contiguous.
+    // ES: Historial circular duplicado para cada canal, de modo que las últimas muestras siempre son contiguas.
+    std::vector<std::vector<float>> history;
+
+    // EN: Write index in the circular history (shared by all channels).
+    // ES: Índice de escritura en el historial circular (compartido por todos los canales).
+    int writeIndex{ 0 };
+
+    // EN: Interpolation factor and taps per polyphase branch.
+    // ES: Factor de interpolación y coeficientes por rama polifásica.
+    int factor{ 4 };
+    int tapsPerPhase{ 16 };
+
+    // EN: Block size and channel count given in prepare.
+    // ES: Tamaño de bloque y número de canales dados en prepare.
+    int samplesPerBlock{ 0 };
+    int numChannels{ 0 };
+
+    // EN: Input sample rate and design selection.
+    // ES: Tasa de muestreo de entrada y selección del diseño.
+    double sampleRate{ 48000.0 };
+    bool kaiserDesign{ false };
+};
@@ -92,13 +92,32 @@ void FIR_LPF::setCutoffFrequency(float newCutoff)
 void FIR_LPF::updateFilter()
 {
     // Designs the FIR low-pass filter coefficients using the window method.
-    coefficients = juce::dsp::FilterDesign<float>::designFIRLowpassWindowMethod(
-        cutoffFrequency,  // Frecuencia de corte del filtro, que puede cambiar dinámicamente
-        sampleRate,       // Frecuencia de muestreo para el diseño del filtro
-        21,               // Número de coeficientes del filtro (determina el orden del filtro)
-        juce::dsp::WindowingFunction<float>::hamming);  // Función ventana Hamming para suavizar la respuesta del filtro
+    coefficients = designCoefficients(cutoffFrequency, sampleRate, 21);
 
     // Sets the newly calculated coefficients to both FIR filters for left and right channels
     lowPassFilter.coefficients = coefficients;  // Asigna los coeficientes al filtro del canal izquierdo
     lowPassFilter2.coefficients = coefficients; // Asigna los coeficientes al filtro del canal derecho
 }
+
+// EN: Designs the FIR low-pass coefficients using the Hamming window method.
+//     The cutoff, sample rate and order are arguments so other classes can reuse this design.
+// ES: Diseña los coeficientes FIR de paso bajo usando el método de ventana Hamming.
+//     La frecuencia de corte, la tasa de muestreo y el orden son argumentos para que otras clases reutilicen este diseño.
+juce::dsp::FIR::Coefficients<float>::Ptr FIR_LPF::designCoefficients(float cutoff, double sampleRate, size_t order)
+{
+    return juce::dsp::FilterDesign<float>::designFIRLowpassWindowMethod(
+        cutoff,           // Frecuencia de corte del filtro, que puede cambiar dinámicamente
+        sampleRate,       // Frecuencia de muestreo para el diseño del filtro
+        order,            // Orden del filtro (número de coeficientes menos uno)
+        juce::dsp::WindowingFunction<float>::hamming);  // Función ventana Hamming para suavizar la respuesta del filtro
+}
+
+// EN: Copies the taps currently used by the filter (identity before prepare).
+// ES: Copia los coeficientes que usa actualmente el filtro (identidad antes de prepare).
+TransferFunction FIR_LPF::getTransferFunction() const
+{
+    if (lowPassFilter.coefficients == nullptr)
+        return {};
+
+    return TransferFunction::fromFIR(*lowPassFilter.coefficients);
+}
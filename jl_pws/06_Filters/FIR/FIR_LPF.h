@@ -43,6 +43,16 @@ public:
     //     Aplica el filtro a los datos de audio contenidos en el buffer.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
+    // EN: Designs low-pass coefficients with the Hamming window method used by this filter.
+    //     It is static so the polyphase classes can reuse the same design at other rates and orders.
+    // ES: Diseña coeficientes de paso bajo con el método de ventana Hamming usado por este filtro.
+    //     Es estático para que las clases polifásicas reutilicen el mismo diseño con otras tasas y órdenes.
+    static juce::dsp::FIR::Coefficients<float>::Ptr designCoefficients(float cutoff, double sampleRate, size_t order);
+
 private:
     // EN: Low-pass filter objects used for processing the audio signal.
     // ES: Objetos de filtro de paso bajo utilizados para procesar la se�al de audio.
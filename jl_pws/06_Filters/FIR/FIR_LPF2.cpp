@@ -88,14 +88,36 @@ void FIR_LPF2::updateFilter()
 {
     // EN: Designs the FIR low-pass filter coefficients using the Kaiser method with adjustable parameters.
     // ES: Diseña los coeficientes del filtro FIR de paso bajo utilizando el método de Kaiser con parámetros ajustables.
-    auto coefficients = juce::dsp::FilterDesign<float>::designFIRLowpassTransitionMethod(
-        cutoffFrequency,   // Set the cutoff frequency
-        sampleRate,        // Set the sample rate
-        125,               // Number of coefficients (order of the filter); adjust as needed
-        0.4, 4.0);         // Kaiser window parameters (beta for the window)
+    auto coefficients = designCoefficients(cutoffFrequency, sampleRate, 125);
 
     // EN: Assign the calculated coefficients to both filter instances.
     // ES: Asigna los coeficientes calculados a ambas instancias del filtro.
     lowPassFilter.coefficients = coefficients;
     lowPassFilter2.coefficients = coefficients;
 }
+
+// EN: Designs the FIR low-pass coefficients using the Kaiser transition method.
+//     The cutoff, sample rate, order and transition band are arguments so other classes can reuse this design.
+// ES: Diseña los coeficientes FIR de paso bajo usando el método de transición Kaiser.
+//     La frecuencia de corte, la tasa de muestreo, el orden y la banda de transición son argumentos para que otras
+//     clases reutilicen este diseño.
+juce::dsp::FIR::Coefficients<float>::Ptr FIR_LPF2::designCoefficients(float cutoff, double sampleRate, size_t order,
+                                                                      float normalisedTransitionWidth, float spline)
+{
+    return juce::dsp::FilterDesign<float>::designFIRLowpassTransitionMethod(
+        cutoff,                     // Set the cutoff frequency
+        sampleRate,                 // Set the sample rate
+        order,                      // Order of the filter; adjust as needed
+        normalisedTransitionWidth,  // Width of the transition band, as a fraction of the sample rate
+        spline);                    // Exponent of the spline transition
+}
+
+// EN: Copies the taps currently used by the filter (identity before prepare).
+// ES: Copia los coeficientes que usa actualmente el filtro (identidad antes de prepare).
+TransferFunction FIR_LPF2::getTransferFunction() const
+{
+    if (lowPassFilter.coefficients == nullptr)
+        return {};
+
+    return TransferFunction::fromFIR(*lowPassFilter.coefficients);
+}
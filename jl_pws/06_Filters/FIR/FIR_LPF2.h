@@ -38,12 +38,27 @@ public:
     //     El procesamiento se realiza sobre el buffer de audio proporcionado.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Allows the user to change the cutoff frequency of the filter.
     //     This method recalculates the filter coefficients based on the new cutoff frequency.
     // ES: Permite al usuario cambiar la frecuencia de corte del filtro.
     //     Este método recalcula los coeficientes del filtro según la nueva frecuencia de corte.
     void setCutoffFrequency(float newCutoff);
 
+    // EN: Designs low-pass coefficients with the Kaiser transition method used by this filter. The transition band
+    //     is centered on the cutoff and normalisedTransitionWidth wide (a fraction of sampleRate); spline is the
+    //     exponent of its spline transition (1 to 4). The defaults are the ones this filter uses.
+    //     It is static so the polyphase classes can reuse the same design at other rates and orders.
+    // ES: Diseña coeficientes de paso bajo con el método de transición Kaiser usado por este filtro. La banda de
+    //     transición está centrada en el corte y mide normalisedTransitionWidth (una fracción de sampleRate); spline
+    //     es el exponente de su transición spline (1 a 4). Los valores por defecto son los que usa este filtro.
+    //     Es estático para que las clases polifásicas reutilicen el mismo diseño con otras tasas y órdenes.
+    static juce::dsp::FIR::Coefficients<float>::Ptr designCoefficients(float cutoff, double sampleRate, size_t order,
+                                                                       float normalisedTransitionWidth = 0.4f, float spline = 4.0f);
+
 private:
     // EN: Updates the FIR filter coefficients based on the current cutoff frequency and sample rate.
     //     This method is called whenever the cutoff frequency is changed.
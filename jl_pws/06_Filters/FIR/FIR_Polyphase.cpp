@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    FIR_Polyphase.cpp
+    Created: 19 Oct 2026 4:03:25am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FIR_Polyphase.h"
+
+// EN: The transition band of the Kaiser design runs from cutoff - width / 2 to cutoff + width / 2, so a width of
+//     2 * (lowerRate / 2 - cutoff), normalised by the design rate, puts its stopband edge on the lower Nyquist.
+// ES: La banda de transición del diseño Kaiser va de corte - ancho / 2 a corte + ancho / 2, así un ancho de
+//     2 * (lowerRate / 2 - corte), normalizado por la tasa de diseño, pone su borde de rechazo en el Nyquist menor.
+juce::dsp::FIR::Coefficients<float>::Ptr FIR_Polyphase::designPrototype(bool kaiserDesign, double lowerRate, double designRate, size_t order)
+{
+    const double cutoff = 0.45 * lowerRate;
+
+    if (!kaiserDesign)
+        return FIR_LPF::designCoefficients(static_cast<float>(cutoff), designRate, order);
+
+    const double transitionWidth = 2.0 * (0.5 * lowerRate - cutoff) / designRate;
+
+    return FIR_LPF2::designCoefficients(static_cast<float>(cutoff), designRate, order, static_cast<float>(transitionWidth), spline);
+}
+
+// EN: Four independent sums, added in pairs at the end.
+// ES: Cuatro sumas independientes, sumadas por parejas al final.
+float FIR_Polyphase::dotProduct(const float* a, const float* b, int numValues)
+{
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    int i = 0;
+
+    for (; i + 4 <= numValues; i += 4)
+    {
+        sum0 += a[i] * b[i];
+        sum1 += a[i + 1] * b[i + 1];
+        sum2 += a[i + 2] * b[i + 2];
+        sum3 += a[i + 3] * b[i + 3];
+    }
+
+    for (; i < numValues; i++)
+        sum0 += a[i] * b[i];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
@@ -0,0 +1,37 @@
+/*
+  ==============================================================================
+
+    FIR_Polyphase.h
+    Created: 19 Oct 2026 4:03:25am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+
+// EN: Helpers shared by FIR_Decimator, FIR_Interpolator and FIR_Resampler: the design of their prototype low-pass
+//     filter and the dot product of their inner loop.
+// ES: Funciones compartidas por FIR_Decimator, FIR_Interpolator y FIR_Resampler: el diseño de su filtro prototipo
+//     de paso bajo y el producto punto de su bucle interno.
+struct FIR_Polyphase
+{
+    // EN: Designs the prototype at designRate for a signal that must be band-limited to the Nyquist of lowerRate.
+    //     The cutoff is 0.45 * lowerRate. The Kaiser (FIR_LPF2) design centers its transition band on the cutoff,
+    //     so its width is set to reach the stopband exactly at lowerRate / 2; the Hamming design is FIR_LPF's.
+    // ES: Diseña el prototipo a designRate para una señal que debe quedar limitada al Nyquist de lowerRate. El corte
+    //     es 0.45 * lowerRate. El diseño Kaiser (FIR_LPF2) centra su banda de transición en el corte, así su ancho se
+    //     fija para llegar a la banda de rechazo justo en lowerRate / 2; el diseño Hamming es el de FIR_LPF.
+    static juce::dsp::FIR::Coefficients<float>::Ptr designPrototype(bool kaiserDesign, double lowerRate, double designRate, size_t order);
+
+    // EN: Dot product with four partial sums so the compiler can keep several SIMD accumulators busy.
+    // ES: Producto punto con cuatro sumas parciales para que el compilador mantenga ocupados varios acumuladores SIMD.
+    static float dotProduct(const float* a, const float* b, int numValues);
+
+    // EN: Spline exponent of the Kaiser design. With 16 to 32 taps per phase the spline window of exponent 2 fits in
+    //     the filter length and gives the deepest stopband.
+    // ES: Exponente de la spline del diseño Kaiser. Con 16 a 32 coeficientes por fase la ventana spline de exponente
+    //     2 cabe en la longitud del filtro y da la banda de rechazo más profunda.
+    static constexpr float spline = 2.0f;
+};
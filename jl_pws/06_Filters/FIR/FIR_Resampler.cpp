@@ -0,0 +1,180 @@
+/*
+  ==============================================================================
+
+    FIR_Resampler.cpp
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FIR_Resampler.h"
+#include <numeric>
+
+// EN: Constructor of FIR_Resampler class.
+// ES: Constructor de la clase FIR_Resampler.
+FIR_Resampler::FIR_Resampler()
+{
+}
+
+// EN: Destructor of FIR_Resampler class.
+// ES: Destructor de la clase FIR_Resampler.
+FIR_Resampler::~FIR_Resampler()
+{
+}
+
+// EN: Sets L and M directly. The filter is redesigned in prepare.
+// ES: Establece L y M directamente. El filtro se rediseña en prepare.
+void FIR_Resampler::setRatio(int newUpFactor, int newDownFactor)
+{
+    upFactor = juce::jmax(1, newUpFactor);
+    downFactor = juce::jmax(1, newDownFactor);
+    outputSampleRate = 0.0;
+    reduceRatio();
+}
+
+// EN: Stores the output rate; L and M are derived in prepare once the input rate is known.
+// ES: Guarda la tasa de salida; L y M se derivan en prepare cuando se conoce la tasa de entrada.
+void FIR_Resampler::setOutputSampleRate(double newOutputSampleRate)
+{
+    outputSampleRate = newOutputSampleRate;
+}
+
+// EN: Sets the number of taps per polyphase branch.
+// ES: Establece el número de coeficientes por rama polifásica.
+void FIR_Resampler::setTapsPerPhase(int newTapsPerPhase)
+{
+    tapsPerPhase = juce::jmax(2, newTapsPerPhase);
+}
+
+// EN: Selects between the Kaiser (FIR_LPF2) and Hamming (FIR_LPF) designs.
+// ES: Selecciona entre los diseños Kaiser (FIR_LPF2) y Hamming (FIR_LPF).
+void FIR_Resampler::setKaiserDesign(bool useKaiser)
+{
+    kaiserDesign = useKaiser;
+}
+
+// EN: Prepares the resampler: resolves L / M, designs the filter and allocates the history.
+// ES: Prepara el remuestreador: resuelve L / M, diseña el filtro y reserva el historial.
+void FIR_Resampler::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    sampleRate = inSampleRate;
+    samplesPerBlock = inSamplesPerBlock;
+    numChannels = inChannels;
+
+    // EN: Integer sample rates give an exact ratio, e.g. 48000 / 44100 = 160 / 147.
+    // ES: Las tasas enteras dan una relación exacta, p. ej. 48000 / 44100 = 160 / 147.
+    if (outputSampleRate > 0.0)
+    {
+        upFactor = juce::roundToInt(outputSampleRate);
+        downFactor = juce::roundToInt(sampleRate);
+        reduceRatio();
+    }
+
+    updateFilter();
+
+    history.assign(numChannels, std::vector<float>(2 * tapsPerPhase, 0.0f));
+    reset();
+}
+
+// EN: Clears the history and restarts the polyphase position.
+// ES: Limpia el historial y reinicia la posición polifásica.
+void FIR_Resampler::reset()
+{
+    for (auto& channelHistory : history)
+        std::fill(channelHistory.begin(), channelHistory.end(), 0.0f);
+
+    writeIndex = 0;
+    phase = 0;
+}
+
+// EN: Returns ceil(blockSize * L / M), the maximum number of outputs per block.
+// ES: Devuelve ceil(blockSize * L / M), el número máximo de salidas por bloque.
+int FIR_Resampler::getMaxOutputSamples() const
+{
+    return static_cast<int>((static_cast<long long>(samplesPerBlock) * upFactor + downFactor - 1) / downFactor);
+}
+
+// EN: Resamples each channel. After each input sample is stored, every output whose position falls
+//     before the next input is computed with the branch that matches its phase, then the phase moves by M.
+// ES: Remuestrea cada canal. Tras guardar cada muestra de entrada, se calcula cada salida cuya posición
+//     cae antes de la siguiente entrada con la rama que corresponde a su fase, y luego la fase avanza M.
+int FIR_Resampler::process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output)
+{
+    const int numSamples = input.getNumSamples();
+    const int channels = juce::jmin(input.getNumChannels(), output.getNumChannels(), numChannels);
+    const int maxOutputs = output.getNumSamples();
+    int numOutputs = 0;
+
+    const int startWriteIndex = writeIndex;
+    const int startPhase = phase;
+
+    for (int channel = 0; channel < channels; channel++)
+    {
+        const float* inData = input.getReadPointer(channel);
+        float* outData = output.getWritePointer(channel);
+        float* channelHistory = history[channel].data();
+
+        int index = startWriteIndex;
+        int p = startPhase;
+        int outIndex = 0;
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            channelHistory[index] = inData[i];
+            channelHistory[index + tapsPerPhase] = inData[i];
+
+            const float* window = channelHistory + index + 1;
+
+            while (p < upFactor)
+            {
+                jassert(outIndex < maxOutputs);
+                if (outIndex < maxOutputs)
+                    outData[outIndex++] = FIR_Polyphase::dotProduct(branches.data() + p * tapsPerPhase, window, tapsPerPhase);
+                p += downFactor;
+            }
+
+            p -= upFactor;
+
+            if (++index >= tapsPerPhase)
+                index = 0;
+        }
+
+        writeIndex = index;
+        phase = p;
+        numOutputs = outIndex;
+    }
+
+    return numOutputs;
+}
+
+// EN: Reduces L / M to lowest terms so the number of branches stays as small as possible.
+// ES: Reduce L / M a su mínima expresión para que el número de ramas sea el menor posible.
+void FIR_Resampler::reduceRatio()
+{
+    const int divisor = std::gcd(upFactor, downFactor);
+    upFactor /= divisor;
+    downFactor /= divisor;
+}
+
+// EN: Designs the prototype at the upsampled rate (input rate * L) with its cutoff just below the
+//     lower of the two Nyquist frequencies, then splits it into L reversed branches scaled by L.
+// ES: Diseña el prototipo a la tasa sobremuestreada (tasa de entrada * L) con su corte justo por debajo
+//     de la menor de las dos frecuencias de Nyquist, y lo divide en L ramas invertidas escaladas por L.
+void FIR_Resampler::updateFilter()
+{
+    const int numTaps = upFactor * tapsPerPhase;
+    const double upsampledRate = sampleRate * upFactor;
+    const double lowerRate = sampleRate * juce::jmin(1.0, static_cast<double>(upFactor) / downFactor);
+    const size_t order = static_cast<size_t>(numTaps - 1);
+
+    auto prototype = FIR_Polyphase::designPrototype(kaiserDesign, lowerRate, upsampledRate, order);
+
+    const float* taps = prototype->getRawCoefficients();
+    const float gain = static_cast<float>(upFactor);
+
+    branches.assign(numTaps, 0.0f);
+    for (int p = 0; p < upFactor; p++)
+        for (int j = 0; j < tapsPerPhase; j++)
+            branches[p * tapsPerPhase + (tapsPerPhase - 1 - j)] = gain * taps[p + j * upFactor];
+}
@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    FIR_Resampler.h
+    Created: 19 Oct 2026 2:53:23am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <vector>
+
+// EN: FIR_Resampler class converts the sample rate by a rational factor L / M (for example 44.1 kHz -> 48 kHz
+//     is 160 / 147) with a polyphase FIR low-pass filter designed by FIR_LPF or FIR_LPF2.
+//     Only the output samples that are kept are computed and the zeros of the upsampler are never multiplied.
+// ES: La clase FIR_Resampler convierte la tasa de muestreo por un factor racional L / M (por ejemplo 44.1 kHz -> 48 kHz
+//     es 160 / 147) con un filtro FIR de paso bajo polifásico diseñado por FIR_LPF o FIR_LPF2.
+//     Solo se calculan las muestras de salida que se conservan y los ceros del sobremuestreador nunca se multiplican.
+class FIR_Resampler
+{
+public:
+    // EN: Constructor of the FIR_Resampler class, initializes the resampler with default values.
+    // ES: Constructor de la clase FIR_Resampler, inicializa el remuestreador con valores predeterminados.
+    FIR_Resampler();
+
+    // EN: Destructor of the FIR_Resampler class.
+    // ES: Destructor de la clase FIR_Resampler.
+    ~FIR_Resampler();
+
+    // EN: Sets the conversion ratio as interpolation factor L and decimation factor M. Call before prepare.
+    // ES: Establece la relación de conversión como factor de interpolación L y factor de decimación M. Llamar antes de prepare.
+    void setRatio(int newUpFactor, int newDownFactor);
+
+    // EN: Sets the output sample rate. The ratio is reduced from the input rate given in prepare.
+    // ES: Establece la tasa de muestreo de salida. La relación se reduce a partir de la tasa de entrada dada en prepare.
+    void setOutputSampleRate(double newOutputSampleRate);
+
+    // EN: Sets the number of filter taps per polyphase branch. The prototype filter has L * taps coefficients.
+    // ES: Establece el número de coeficientes por rama polifásica. El filtro prototipo tiene L * taps coeficientes.
+    void setTapsPerPhase(int newTapsPerPhase);
+
+    // EN: Selects the Kaiser design of FIR_LPF2 (true) or the Hamming design of FIR_LPF (false).
+    // ES: Selecciona el diseño Kaiser de FIR_LPF2 (true) o el diseño Hamming de FIR_LPF (false).
+    void setKaiserDesign(bool useKaiser);
+
+    // EN: Prepares the resampler with the input sample rate, block size, and number of channels.
+    // ES: Prepara el remuestreador con la tasa de muestreo de entrada, el tamaño del bloque y el número de canales.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the filter history and the polyphase position.
+    // ES: Limpia el historial del filtro y la posición polifásica.
+    void reset();
+
+    // EN: Resamples the input buffer into the output buffer and returns the number of output samples written.
+    //     The output buffer must hold at least getMaxOutputSamples() samples per channel.
+    // ES: Remuestrea el buffer de entrada en el buffer de salida y devuelve el número de muestras de salida escritas.
+    //     El buffer de salida debe tener al menos getMaxOutputSamples() muestras por canal.
+    int process(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output);
+
+    // EN: Returns the largest number of output samples a block of the prepared size can produce.
+    // ES: Devuelve el mayor número de muestras de salida que puede producir un bloque del tamaño preparado.
+    int getMaxOutputSamples() const;
+
+private:
+    // EN: Reduces L / M by their greatest common divisor.
+    // ES: Reduce L / M por su máximo común divisor.
+    void reduceRatio();
+
+    // EN: Designs the prototype filter and splits it into L reversed polyphase branches.
+    // ES: Diseña el filtro prototipo y lo divide en L ramas polifásicas invertidas.
+    void updateFilter();
+
+    // EN: Polyphase branches stored one after another, reversed and scaled by L.
+    // ES: Ramas polifásicas almacenadas una tras otra, invertidas y escaladas por L.
+    std::vector<float> branches;
+
+    // EN: Doubled circular history for each channel, so the last taps samples are always contiguous.
+    // ES: Historial circular duplicado para cada canal, de modo que las últimas muestras siempre son contiguas.
+    std::vector<std::vector<float>> history;
+
+    // EN: Write index in the circular history (shared by all channels).
+    // ES: Índice de escritura en el historial circular (compartido por todos los canales).
+    int writeIndex{ 0 };
+
+    // EN: Polyphase position of the next output, in units of the upsampled rate relative to the newest input.
+    // ES: Posición polifásica de la siguiente salida, en unidades de la tasa sobremuestreada relativa a la entrada más reciente.
+    int phase{ 0 };
+
+    // EN: Interpolation factor L, decimation factor M and taps per polyphase branch.
+    // ES: Factor de interpolación L, factor de decimación M y coeficientes por rama polifásica.
+    int upFactor{ 1 };
+    int downFactor{ 1 };
+    int tapsPerPhase{ 32 };
+
+    // EN: Block size and channel count given in prepare.
+    // ES: Tamaño de bloque y número de canales dados en prepare.
+    int samplesPerBlock{ 0 };
+    int numChannels{ 0 };
+
+    // EN: Input and requested output sample rates (0 means the ratio was set with setRatio).
+    // ES: Tasas de muestreo de entrada y de salida solicitada (0 significa que la relación se fijó con setRatio).
+    double sampleRate{ 48000.0 };
+    double outputSampleRate{ 0.0 };
+    bool kaiserDesign{ false };
+};
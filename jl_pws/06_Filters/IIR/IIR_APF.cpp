@@ -91,4 +91,11 @@ void IIR_APF::updateFilter()
     // EN: Assign the new coefficients to the filter state.
     // ES: Asigna los nuevos coeficientes al estado del filtro.
     *foApf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_APF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foApf.state);
+}
@@ -32,6 +32,10 @@ public:
     // ES: Procesa un b�fer de audio a trav�s del filtro de fase total.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency of the filter and updates the coefficients accordingly.
     // ES: Establece la frecuencia de corte del filtro y actualiza los coeficientes en consecuencia.
     void setCutoffFrequency(float newCutoff);
@@ -79,4 +79,11 @@ void IIR_BPF::updateFilter()
 
     // EN: Assigns the calculated coefficients to the filter state. / ES: Asigna los coeficientes calculados al estado del filtro.
     *bpf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_BPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*bpf.state);
+}
@@ -32,6 +32,10 @@ public:
     // ES: Procesa el búfer de audio a través del filtro pasabanda.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency for the filter.
     // ES: Establece la frecuencia de corte para el filtro.
     void setCutoffFrequency(float newCutoff);
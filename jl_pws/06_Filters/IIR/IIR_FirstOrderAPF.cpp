@@ -88,4 +88,11 @@ void IIRFirstOrderAPF::updateFilter()
     // ES: Asigna los coeficientes creados al estado del filtro.
     //     Esto asegura que el filtro opere con los coeficientes actualizados.
     *foApf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIRFirstOrderAPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foApf.state);
+}
@@ -39,6 +39,10 @@ public:
     //     El m�todo aplica el filtro al b�fer de audio en el lugar.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency for the filter and updates its coefficients.
     // ES: Establece la frecuencia de corte para el filtro y actualiza sus coeficientes.
     void setCutoffFrequency(float newCutoff);
@@ -82,4 +82,11 @@ void IIRFirstOrderHPF::updateFilter()
 
     // Assign the newly calculated coefficients to the filter
     *foHpf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIRFirstOrderHPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foHpf.state);
+}
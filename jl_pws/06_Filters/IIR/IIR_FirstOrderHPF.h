@@ -39,6 +39,10 @@ public:
     //     El filtro se aplica en el lugar, modificando directamente el b�fer.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency of the filter and updates the filter coefficients accordingly.
     //     This method is called when the cutoff frequency needs to be changed.
     // ES: Establece la frecuencia de corte del filtro y actualiza los coeficientes del filtro en consecuencia.
@@ -91,4 +91,11 @@ void IIRFirstOrderLPF::updateFilter()
     // ES: Asigna los coeficientes calculados al estado del filtro.
     //     Este paso asegura que el filtro use los coeficientes actualizados cuando procese el audio.
     *foLpf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIRFirstOrderLPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foLpf.state);
+}
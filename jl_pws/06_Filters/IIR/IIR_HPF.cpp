@@ -98,3 +98,10 @@ void IIR_HPF::updateFilter()
     //     Esto actualiza el estado del filtro con los nuevos coeficientes.
     *hpf.state = *coefficients;
 }
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_HPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*hpf.state);
+}
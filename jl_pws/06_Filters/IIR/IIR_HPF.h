@@ -40,6 +40,10 @@ public:
     //     Este método modifica el búfer directamente con el audio filtrado.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency for the high-pass filter.
     //     The cutoff frequency determines the threshold below which frequencies will be attenuated.
     // ES: Establece la frecuencia de corte para el filtro pasa-altos.
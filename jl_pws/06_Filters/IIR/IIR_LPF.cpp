@@ -116,4 +116,11 @@ void IIR_LPF::updateFilter()
     // ES: Asigna los coeficientes calculados al filtro.
     //     Esto actualiza el filtro para utilizar los coeficientes reci�n calculados para procesar el audio.
     *foApf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_LPF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foApf.state);
+}
@@ -38,6 +38,10 @@ public:
     //     Este m�todo modifica el b�fer aplicando el filtro a los datos de audio.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency for the low-pass filter.
     //     The cutoff frequency determines the point at which the filter starts attenuating higher frequencies.
     // ES: Establece la frecuencia de corte para el filtro pasa bajos.
@@ -14,7 +14,8 @@
 //     Configuration happens in the `prepare` method.
 // ES: Constructor de la clase IIR_LSF. Inicializa el objeto del filtro, pero no realiza ninguna configuraci�n espec�fica.
 //     La configuraci�n se realiza en el m�todo `prepare`.
-IIR_LSF::IIR_LSF()
+template <typename SampleType>
+IIR_LSF_T<SampleType>::IIR_LSF_T()
 {
 }
 
@@ -22,7 +23,8 @@ IIR_LSF::IIR_LSF()
 //     No explicit resource management is required since DSP objects are managed by JUCE.
 // ES: Destructor de la clase IIR_LSF. Libera los recursos cuando el objeto es destruido.
 //     No se requiere una gesti�n expl�cita de recursos ya que los objetos DSP son gestionados por JUCE.
-IIR_LSF::~IIR_LSF()
+template <typename SampleType>
+IIR_LSF_T<SampleType>::~IIR_LSF_T()
 {
 }
 
@@ -30,7 +32,8 @@ IIR_LSF::~IIR_LSF()
 //     It sets up the DSP objects and stores the sample rate for later use in filter coefficient calculations.
 // ES: Prepara el filtro de estante bajo con la frecuencia de muestreo, el tama�o del bloque y el n�mero de canales proporcionados.
 //     Configura los objetos DSP y almacena la frecuencia de muestreo para su uso posterior en el c�lculo de los coeficientes del filtro.
-void IIR_LSF::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
 {
     juce::dsp::ProcessSpec spec;
 
@@ -50,12 +53,13 @@ void IIR_LSF::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels
 
 // EN: Processes the audio buffer using the low-shelf filter. The buffer is modified in place by applying the filter.
 // ES: Procesa el b�fer de audio utilizando el filtro de estante bajo. El b�fer se modifica en el lugar aplicando el filtro.
-void IIR_LSF::process(juce::AudioBuffer<float>& buffer)
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
-    juce::dsp::AudioBlock<float> block(buffer);  // EN: Converts the buffer into an audio block for DSP processing.
+    juce::dsp::AudioBlock<SampleType> block(buffer);  // EN: Converts the buffer into an audio block for DSP processing.
     // ES: Convierte el b�fer en un bloque de audio para el procesamiento DSP.
 
-    juce::dsp::ProcessContextReplacing<float> context(block);  // EN: Creates a processing context to replace the audio data.
+    juce::dsp::ProcessContextReplacing<SampleType> context(block);  // EN: Creates a processing context to replace the audio data.
     // ES: Crea un contexto de procesamiento para reemplazar los datos de audio.
 
     foApf.process(context);  // EN: Applies the filter to the audio block using the context.
@@ -66,7 +70,8 @@ void IIR_LSF::process(juce::AudioBuffer<float>& buffer)
 //     The filter coefficients are recalculated after updating the cutoff frequency.
 // ES: Establece la frecuencia de corte para el filtro de estante bajo. Esta frecuencia determina d�nde comienza a afectar la se�al el filtro.
 //     Los coeficientes del filtro se recalculan despu�s de actualizar la frecuencia de corte.
-void IIR_LSF::setCutoffFrequency(float frequency)
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::setCutoffFrequency(float frequency)
 {
     cutoffFrequency = frequency;  // EN: Updates the cutoff frequency.
     // ES: Actualiza la frecuencia de corte.
@@ -78,7 +83,8 @@ void IIR_LSF::setCutoffFrequency(float frequency)
 //     After updating the Q, the filter coefficients are recalculated.
 // ES: Establece el factor Q para el filtro, que afecta el ancho de banda de la influencia del filtro. Un valor Q m�s alto resulta en un rango de filtro m�s estrecho.
 //     Despu�s de actualizar el Q, los coeficientes del filtro se recalculan.
-void IIR_LSF::setQ(float newQ)
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::setQ(float newQ)
 {
     q = newQ;  // EN: Updates the Q value for the filter.
     // ES: Actualiza el valor Q para el filtro.
@@ -90,7 +96,8 @@ void IIR_LSF::setQ(float newQ)
 //     The filter coefficients are recalculated after setting the new gain.
 // ES: Establece la ganancia para el filtro de estante bajo, determinando cu�nto se amplifican o aten�an las frecuencias bajas.
 //     Los coeficientes del filtro se recalculan despu�s de establecer la nueva ganancia.
-void IIR_LSF::setGain(float newGain)
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::setGain(float newGain)
 {
     gain = newGain;  // EN: Updates the gain value for the filter.
     // ES: Actualiza el valor de ganancia para el filtro.
@@ -102,13 +109,14 @@ void IIR_LSF::setGain(float newGain)
 //     This method recalculates the filter behavior by generating the appropriate coefficients.
 // ES: Actualiza los coeficientes del filtro en funci�n de la frecuencia de corte, el Q y la ganancia actuales.
 //     Este m�todo recalcula el comportamiento del filtro generando los coeficientes adecuados.
-void IIR_LSF::updateFilter()
+template <typename SampleType>
+void IIR_LSF_T<SampleType>::updateFilter()
 {
     // EN: Creates the filter coefficients for a low-shelf filter with the specified parameters.
     //     These coefficients define the filter�s frequency response.
     // ES: Crea los coeficientes del filtro para un filtro de estante bajo con los par�metros especificados.
     //     Estos coeficientes definen la respuesta en frecuencia del filtro.
-    auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+    auto coefficients = juce::dsp::IIR::Coefficients<SampleType>::makeLowShelf(
         sampleRate,      // EN: Sample rate used to calculate the coefficients.
         // ES: Frecuencia de muestreo utilizada para calcular los coeficientes.
         cutoffFrequency, // EN: Cutoff frequency where the filter starts to affect the signal.
@@ -123,4 +131,17 @@ void IIR_LSF::updateFilter()
 // ES: Asigna los coeficientes reci�n calculados al filtro.
 //     Esto asegura que el filtro funcione con los par�metros actualizados.
     *foApf.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+template <typename SampleType>
+TransferFunction IIR_LSF_T<SampleType>::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*foApf.state);
+}
+
+// EN: The two sample types the filter is built for.
+// ES: Los dos tipos de muestra para los que se compila el filtro.
+template class IIR_LSF_T<float>;
+template class IIR_LSF_T<double>;
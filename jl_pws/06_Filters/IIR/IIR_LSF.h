@@ -14,22 +14,25 @@
 
 // EN: Declaration of the IIR_LSF class, which represents an IIR Low Shelf Filter.
 //     This filter adjusts the gain of low frequencies while leaving the high frequencies unaffected or with less effect.
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
 // ES: Declaraci�n de la clase IIR_LSF, que representa un filtro de estante bajo IIR.
 //     Este filtro ajusta la ganancia de las frecuencias bajas mientras deja las frecuencias altas inalteradas o con menos efecto.
-class IIR_LSF
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class IIR_LSF_T
 {
 public:
     // EN: Constructor of the IIR_LSF class. Initializes the filter object.
     //     Does not perform any actual filter setup. Configuration happens in `prepare`.
     // ES: Constructor de la clase IIR_LSF. Inicializa el objeto del filtro.
     //     No realiza ninguna configuraci�n real del filtro. La configuraci�n se realiza en `prepare`.
-    IIR_LSF();
+    IIR_LSF_T();
 
     // EN: Destructor of the IIR_LSF class. Cleans up the resources when the object is destroyed.
     //     No explicit resource management is needed as the DSP objects are managed by JUCE.
     // ES: Destructor de la clase IIR_LSF. Libera los recursos cuando el objeto es destruido.
     //     No se necesita una gesti�n expl�cita de recursos ya que los objetos DSP son gestionados por JUCE.
-    ~IIR_LSF();
+    ~IIR_LSF_T();
 
     // EN: Prepares the low-shelf filter with the sample rate, block size, and number of channels.
     //     This function is called once before processing the audio and sets up the necessary DSP objects.
@@ -43,7 +46,11 @@ public:
     //     This modifies the audio buffer in place by applying the filter to it.
     // ES: Procesa el b�fer de audio utilizando el filtro de estante bajo.
     //     Esto modifica el b�fer de audio aplicando el filtro sobre �l.
-    void process(juce::AudioBuffer<float>& buffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
 
     // EN: Sets the cutoff frequency for the low-shelf filter.
     //     The cutoff frequency determines the point at which the filter starts affecting the audio signal.
@@ -80,7 +87,7 @@ private:
     //     It is a duplicator that uses an IIR filter and its coefficients to apply the filter to the audio buffer.
     // ES: Un objeto de procesador DSP que maneja el proceso de filtrado real.
     //     Es un duplicador que utiliza un filtro IIR y sus coeficientes para aplicar el filtro al b�fer de audio.
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> foApf;
+    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<SampleType>, juce::dsp::IIR::Coefficients<SampleType>> foApf;
 
     // EN: Stores the sample rate used for filter calculations.
     // ES: Almacena la frecuencia de muestreo utilizada para los c�lculos del filtro.
@@ -97,4 +104,8 @@ private:
     // EN: Stores the gain for the filter. This is how much the filter will amplify or attenuate low frequencies.
     // ES: Almacena la ganancia para el filtro. Esta es la cantidad que el filtro amplificar� o atenuar� las frecuencias bajas.
     float gain{};
-};
\ No newline at end of file
+};
+
+// EN: The float version keeps the original name; IIR_LSF_T<double> is the double version.
+// ES: La versión float conserva el nombre original; IIR_LSF_T<double> es la versión double.
+using IIR_LSF = IIR_LSF_T<float>;
@@ -92,4 +92,11 @@ void IIR_Notch::updateFilter()
 // EN: Assigns the new coefficients to the notch filter state.
 // ES: Asigna los nuevos coeficientes al estado del filtro notch.
     *notch.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_Notch::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*notch.state);
+}
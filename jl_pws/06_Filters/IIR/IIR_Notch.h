@@ -37,6 +37,10 @@ public:
     // ES: Procesa el búfer de audio aplicando el filtro notch. Modifica el búfer en su lugar.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency for the notch filter. This frequency determines the center of the attenuation band.
     //     After setting the frequency, the filter coefficients are updated.
     // ES: Establece la frecuencia de corte para el filtro notch. Esta frecuencia determina el centro de la banda de atenuación.
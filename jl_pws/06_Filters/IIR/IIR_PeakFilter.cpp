@@ -100,4 +100,11 @@ void IIR_PeakF::updateFilter()
 // EN: Assigns the computed coefficients to the filter state.
 // ES: Asigna los coeficientes calculados al estado del filtro.
     *notch.state = *coefficients;
-}
\ No newline at end of file
+}
+
+// EN: Copies the JUCE coefficients currently used by the filter.
+// ES: Copia los coeficientes de JUCE que usa actualmente el filtro.
+TransferFunction IIR_PeakF::getTransferFunction() const
+{
+    return TransferFunction::fromIIR(*notch.state);
+}
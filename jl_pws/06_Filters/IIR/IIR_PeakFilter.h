@@ -34,6 +34,10 @@ public:
     // ES: Procesa un b�fer de audio a trav�s del filtro pico. Aplica el filtro directamente en el b�fer.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Returns a snapshot of the coefficients as a transfer function, to be evaluated by FilterResponse.
+    // ES: Devuelve una copia de los coeficientes como función de transferencia, para evaluarla con FilterResponse.
+    TransferFunction getTransferFunction() const;
+
     // EN: Sets the cutoff frequency of the peak filter. Updates the filter coefficients.
     // ES: Establece la frecuencia de corte del filtro pico. Actualiza los coeficientes del filtro.
     void setCutoffFrequency(float newCutoff);
@@ -0,0 +1,349 @@
+/*
+  ==============================================================================
+
+    ParametricEQ.h
+    Created: 19 Oct 2026 2:54:27am
+    Author:  Jhonatan López
+
+    notes: NumBands is fixed at compile time. Gains are in dB, like the Biquad_* filters.
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: ParametricEQ class runs NumBands biquad bands (shelves, peaks, notch, low/high-pass) in a single pass.
+//     All band coefficients are stored contiguously and each sample is cascaded through every active band
+//     inside one loop, so the buffer is read and written only once. Bypassed or flat bands are removed from
+//     the active list when the settings change, so they cost nothing while processing.
+//     Settings are applied as a complete set: the audio thread swaps them in at the start of a block.
+// ES: La clase ParametricEQ ejecuta NumBands bandas biquad (estantes, picos, notch, pasa bajos/altos) en una sola pasada.
+//     Todos los coeficientes se almacenan de forma contigua y cada muestra pasa en cascada por todas las bandas activas
+//     dentro de un solo bucle, así el buffer se lee y escribe una sola vez. Las bandas en bypass o planas se quitan
+//     de la lista activa cuando cambian los ajustes, por lo que no cuestan nada durante el procesamiento.
+//     Los ajustes se aplican como un conjunto completo: el hilo de audio los intercambia al inicio de un bloque.
+template <int NumBands>
+class ParametricEQ
+{
+public:
+    // EN: Filter shape of one band.
+    // ES: Forma del filtro de una banda.
+    enum class BandType
+    {
+        peak,
+        lowShelf,
+        highShelf,
+        notch,
+        lowPass,
+        highPass
+    };
+
+    // EN: Parameters of one band. Gain is in dB and only used by peak and shelf bands.
+    // ES: Parámetros de una banda. La ganancia está en dB y solo la usan las bandas de pico y estante.
+    struct BandSettings
+    {
+        BandType type{ BandType::peak };
+        float frequency{ 1000.0f };
+        float Q{ 0.707f };
+        float gain{ 0.0f };
+        bool bypassed{ false };
+    };
+
+    // EN: Constructor. All bands start as flat peaks, so the EQ starts transparent.
+    // ES: Constructor. Todas las bandas empiezan como picos planos, así el EQ empieza transparente.
+    ParametricEQ() {}
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~ParametricEQ() {}
+
+    // EN: Prepares the EQ with the sample rate and number of channels, and allocates the filter states.
+    // ES: Prepara el EQ con la frecuencia de muestreo y el número de canales, y reserva los estados del filtro.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+    {
+        sampleRate = inSampleRate;
+        numChannels = inChannels;
+
+        z1.assign(numChannels, {});
+        z2.assign(numChannels, {});
+
+        const juce::SpinLock::ScopedLockType lock(settingsLock);
+        pending = computeCoefficients(settings);
+        live = pending;
+        pendingChanged = false;
+        reset();
+    }
+
+    // EN: Clears the state of every band on every channel.
+    // ES: Limpia el estado de cada banda en cada canal.
+    void reset()
+    {
+        for (auto& channelState : z1)
+            channelState.fill(0.0f);
+        for (auto& channelState : z2)
+            channelState.fill(0.0f);
+    }
+
+    // EN: Changes one band. The new coefficients are published together with the other bands.
+    // ES: Cambia una banda. Los nuevos coeficientes se publican junto con las demás bandas.
+    void setBand(int index, const BandSettings& newSettings)
+    {
+        jassert(index >= 0 && index < NumBands);
+        settings[index] = newSettings;
+        publish();
+    }
+
+    // EN: Changes all bands at once; the audio thread never sees a mix of old and new bands.
+    // ES: Cambia todas las bandas a la vez; el hilo de audio nunca ve una mezcla de bandas viejas y nuevas.
+    void setBands(const std::array<BandSettings, NumBands>& newSettings)
+    {
+        settings = newSettings;
+        publish();
+    }
+
+    // EN: Returns the current settings of one band.
+    // ES: Devuelve los ajustes actuales de una banda.
+    const BandSettings& getBand(int index) const
+    {
+        return settings[index];
+    }
+
+    // EN: Returns one transfer function per active band, in processing order, for FilterResponse.
+    //     Bypassed and flat bands are skipped exactly like in process.
+    // ES: Devuelve una función de transferencia por banda activa, en orden de procesamiento, para FilterResponse.
+    //     Las bandas anuladas o planas se omiten igual que en process.
+    std::vector<TransferFunction> getTransferFunctions() const
+    {
+        const auto set = computeCoefficients(settings);
+        std::vector<TransferFunction> stages;
+        stages.reserve(static_cast<size_t>(set.numActive));
+
+        for (int k = 0; k < set.numActive; k++)
+            stages.push_back(TransferFunction::fromBiquad(set.b0[k], set.b1[k], set.b2[k], 1.0, set.a1[k], set.a2[k]));
+
+        return stages;
+    }
+
+    // EN: Processes the buffer. Each sample runs through all active bands before the next sample is read.
+    // ES: Procesa el buffer. Cada muestra pasa por todas las bandas activas antes de leer la siguiente.
+    void process(juce::AudioBuffer<float>& buffer)
+    {
+        juce::ScopedNoDenormals noDenormals;
+
+        pullPendingCoefficients();
+
+        const int numActive = live.numActive;
+        if (numActive == 0)
+            return;
+
+        const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+        const int numSamples = buffer.getNumSamples();
+
+        for (int channel = 0; channel < channels; channel++)
+        {
+            float* data = buffer.getWritePointer(channel);
+
+            // EN: Copy the states of the active bands into a packed local array for the block.
+            // ES: Copia los estados de las bandas activas a un arreglo local compacto para el bloque.
+            std::array<float, NumBands> s1, s2;
+            for (int a = 0; a < numActive; a++)
+            {
+                s1[a] = z1[channel][live.band[a]];
+                s2[a] = z2[channel][live.band[a]];
+            }
+
+            for (int i = 0; i < numSamples; i++)
+            {
+                float x = data[i];
+
+                // EN: Transposed Direct Form II cascade, the same structure as Biquad_TDFII_*.
+                // ES: Cascada en forma directa transpuesta II, la misma estructura que Biquad_TDFII_*.
+                for (int a = 0; a < numActive; a++)
+                {
+                    const float y = live.b0[a] * x + s1[a];
+                    s1[a] = live.b1[a] * x - live.a1[a] * y + s2[a];
+                    s2[a] = live.b2[a] * x - live.a2[a] * y;
+                    x = y;
+                }
+
+                data[i] = x;
+            }
+
+            for (int a = 0; a < numActive; a++)
+            {
+                z1[channel][live.band[a]] = s1[a];
+                z2[channel][live.band[a]] = s2[a];
+            }
+        }
+    }
+
+private:
+    // EN: Packed coefficients of the active bands, in processing order (structure of arrays).
+    // ES: Coeficientes compactos de las bandas activas, en orden de procesamiento (estructura de arreglos).
+    struct CoefficientSet
+    {
+        std::array<float, NumBands> b0{}, b1{}, b2{}, a1{}, a2{};
+        std::array<int, NumBands> band{};
+        int numActive{ 0 };
+    };
+
+    // EN: Recomputes the coefficient set and hands it to the audio thread.
+    // ES: Recalcula el conjunto de coeficientes y lo entrega al hilo de audio.
+    void publish()
+    {
+        auto newSet = computeCoefficients(settings);
+
+        const juce::SpinLock::ScopedLockType lock(settingsLock);
+        pending = newSet;
+        pendingChanged = true;
+    }
+
+    // EN: Takes the pending set if one is waiting. Never blocks: if the message thread holds the lock,
+    //     the swap is retried on the next block.
+    // ES: Toma el conjunto pendiente si hay uno esperando. Nunca bloquea: si el hilo de mensajes tiene el
+    //     candado, el intercambio se reintenta en el siguiente bloque.
+    void pullPendingCoefficients()
+    {
+        const juce::SpinLock::ScopedTryLockType tryLock(settingsLock);
+
+        if (! tryLock.isLocked() || ! pendingChanged)
+            return;
+
+        // EN: Bands that were not active before start from silence instead of a stale state.
+        // ES: Las bandas que no estaban activas empiezan desde silencio en lugar de un estado viejo.
+        std::array<bool, NumBands> wasActive{};
+        for (int a = 0; a < live.numActive; a++)
+            wasActive[live.band[a]] = true;
+
+        for (int a = 0; a < pending.numActive; a++)
+        {
+            const int k = pending.band[a];
+            if (! wasActive[k])
+            {
+                for (int channel = 0; channel < numChannels; channel++)
+                {
+                    z1[channel][k] = 0.0f;
+                    z2[channel][k] = 0.0f;
+                }
+            }
+        }
+
+        live = pending;
+        pendingChanged = false;
+    }
+
+    // EN: Builds the packed set: bypassed bands and peak/shelf bands with (almost) 0 dB gain are skipped.
+    //     The RBJ cookbook formulas are evaluated in double precision and normalised by a0.
+    // ES: Construye el conjunto compacto: se omiten las bandas en bypass y los picos/estantes con ganancia (casi) 0 dB.
+    //     Las fórmulas del cookbook de RBJ se evalúan en doble precisión y se normalizan por a0.
+    CoefficientSet computeCoefficients(const std::array<BandSettings, NumBands>& bands) const
+    {
+        CoefficientSet set;
+
+        for (int k = 0; k < NumBands; k++)
+        {
+            const auto& band = bands[k];
+            const bool usesGain = band.type == BandType::peak || band.type == BandType::lowShelf || band.type == BandType::highShelf;
+
+            if (band.bypassed || (usesGain && std::abs(band.gain) < 0.01f))
+                continue;
+
+            const double frequency = juce::jlimit(1.0, 0.499 * sampleRate, static_cast<double>(band.frequency));
+            const double w0 = juce::MathConstants<double>::twoPi * frequency / sampleRate;
+            const double cosW0 = std::cos(w0);
+            const double alpha = std::sin(w0) / (2.0 * juce::jmax(0.01, static_cast<double>(band.Q)));
+            const double A = std::pow(10.0, band.gain / 40.0);
+            const double sqrtA = std::sqrt(A);
+
+            double b0 = 1.0, b1 = 0.0, b2 = 0.0, a0 = 1.0, a1 = 0.0, a2 = 0.0;
+
+            switch (band.type)
+            {
+                case BandType::peak:
+                    b0 = 1.0 + alpha * A;
+                    b1 = -2.0 * cosW0;
+                    b2 = 1.0 - alpha * A;
+                    a0 = 1.0 + alpha / A;
+                    a1 = -2.0 * cosW0;
+                    a2 = 1.0 - alpha / A;
+                    break;
+
+                case BandType::lowShelf:
+                    b0 = A * ((A + 1.0) - (A - 1.0) * cosW0 + 2.0 * sqrtA * alpha);
+                    b1 = 2.0 * A * ((A - 1.0) - (A + 1.0) * cosW0);
+                    b2 = A * ((A + 1.0) - (A - 1.0) * cosW0 - 2.0 * sqrtA * alpha);
+                    a0 = (A + 1.0) + (A - 1.0) * cosW0 + 2.0 * sqrtA * alpha;
+                    a1 = -2.0 * ((A - 1.0) + (A + 1.0) * cosW0);
+                    a2 = (A + 1.0) + (A - 1.0) * cosW0 - 2.0 * sqrtA * alpha;
+                    break;
+
+                case BandType::highShelf:
+                    b0 = A * ((A + 1.0) + (A - 1.0) * cosW0 + 2.0 * sqrtA * alpha);
+                    b1 = -2.0 * A * ((A - 1.0) + (A + 1.0) * cosW0);
+                    b2 = A * ((A + 1.0) + (A - 1.0) * cosW0 - 2.0 * sqrtA * alpha);
+                    a0 = (A + 1.0) - (A - 1.0) * cosW0 + 2.0 * sqrtA * alpha;
+                    a1 = 2.0 * ((A - 1.0) - (A + 1.0) * cosW0);
+                    a2 = (A + 1.0) - (A - 1.0) * cosW0 - 2.0 * sqrtA * alpha;
+                    break;
+
+                case BandType::notch:
+                    b0 = 1.0;
+                    b1 = -2.0 * cosW0;
+                    b2 = 1.0;
+                    a0 = 1.0 + alpha;
+                    a1 = -2.0 * cosW0;
+                    a2 = 1.0 - alpha;
+                    break;
+
+                case BandType::lowPass:
+                    b0 = (1.0 - cosW0) / 2.0;
+                    b1 = 1.0 - cosW0;
+                    b2 = (1.0 - cosW0) / 2.0;
+                    a0 = 1.0 + alpha;
+                    a1 = -2.0 * cosW0;
+                    a2 = 1.0 - alpha;
+                    break;
+
+                case BandType::highPass:
+                    b0 = (1.0 + cosW0) / 2.0;
+                    b1 = -(1.0 + cosW0);
+                    b2 = (1.0 + cosW0) / 2.0;
+                    a0 = 1.0 + alpha;
+                    a1 = -2.0 * cosW0;
+                    a2 = 1.0 - alpha;
+                    break;
+            }
+
+            const int a = set.numActive++;
+            set.b0[a] = static_cast<float>(b0 / a0);
+            set.b1[a] = static_cast<float>(b1 / a0);
+            set.b2[a] = static_cast<float>(b2 / a0);
+            set.a1[a] = static_cast<float>(a1 / a0);
+            set.a2[a] = static_cast<float>(a2 / a0);
+            set.band[a] = k;
+        }
+
+        return set;
+    }
+
+    // EN: Settings of every band, owned by the message thread.
+    // ES: Ajustes de cada banda, propiedad del hilo de mensajes.
+    std::array<BandSettings, NumBands> settings{};
+
+    // EN: Coefficients used by the audio thread and the next set waiting to be swapped in.
+    // ES: Coeficientes usados por el hilo de audio y el siguiente conjunto esperando a ser intercambiado.
+    CoefficientSet live;
+    CoefficientSet pending;
+    bool pendingChanged{ false };
+    juce::SpinLock settingsLock;
+
+    // EN: TDF-II states per channel, indexed by band number.
+    // ES: Estados TDF-II por canal, indexados por número de banda.
+    std::vector<std::array<float, NumBands>> z1;
+    std::vector<std::array<float, NumBands>> z2;
+
+    double sampleRate{ 48000.0 };
+    int numChannels{ 0 };
+};
@@ -0,0 +1,418 @@
+/*
+  ==============================================================================
+
+    BandLimitedOscillator.cpp
+    Created: 19 Oct 2026 3:18:19am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "BandLimitedOscillator.h"
+
+// EN: Constructor of BandLimitedOscillator class.
+// ES: Constructor de la clase BandLimitedOscillator.
+BandLimitedOscillator::BandLimitedOscillator()
+{
+}
+
+// EN: Destructor of BandLimitedOscillator class.
+// ES: Destructor de la clase BandLimitedOscillator.
+BandLimitedOscillator::~BandLimitedOscillator()
+{
+}
+
+// EN: Sets the sample rate and recalculates the phase increment.
+// ES: Establece la frecuencia de muestreo y recalcula el incremento de fase.
+void BandLimitedOscillator::prepare(double inSampleRate)
+{
+    sampleRate = inSampleRate;
+    accumulator.prepare(sampleRate);
+    setFrequency(frequency);
+}
+
+// EN: Sets the phase, wrapped to [0, 1).
+// ES: Establece la fase, ajustada a [0, 1).
+void BandLimitedOscillator::reset(float inPhase)
+{
+    accumulator.reset(inPhase);
+}
+
+// EN: Sets the waveform.
+// ES: Establece la forma de onda.
+void BandLimitedOscillator::setWaveform(Waveform inWaveform)
+{
+    waveform = inWaveform;
+}
+
+// EN: The increment is the fraction of the cycle advanced per sample, limited to the Nyquist frequency.
+// ES: El incremento es la fracción del ciclo que avanza por muestra, limitada a la frecuencia de Nyquist.
+void BandLimitedOscillator::setFrequency(float inFrequency)
+{
+    frequency = inFrequency;
+    accumulator.setFrequency(juce::jlimit(0.0, maxIncrement * sampleRate, static_cast<double>(frequency)));
+}
+
+// EN: Sets the pulse width.
+// ES: Establece el ancho de pulso.
+void BandLimitedOscillator::setPulseWidth(float inPulseWidth)
+{
+    pulseWidth = juce::jlimit(0.0f, 1.0f, inPulseWidth);
+}
+
+// EN: Sets the phase offset, wrapped to [0, 1).
+// ES: Establece el desfase, ajustado a [0, 1).
+void BandLimitedOscillator::setPhaseOffset(float inPhaseOffset)
+{
+    phaseOffset = inPhaseOffset - std::floor(inPhaseOffset);
+}
+
+// EN: With x the distance to the step in samples, the residual is -(1 - x)^2 / 2 just after it and
+//     (1 + x)^2 / 2 just before it.
+// ES: Con x la distancia al salto en muestras, el residuo es -(1 - x)^2 / 2 justo después y (1 + x)^2 / 2
+//     justo antes.
+float BandLimitedOscillator::polyBlep(float t, float dt)
+{
+    if (t < dt)
+    {
+        const float x = 1.0f - t / dt;
+        return -0.5f * x * x;
+    }
+
+    if (t > 1.0f - dt)
+    {
+        const float x = 1.0f + (t - 1.0f) / dt;
+        return 0.5f * x * x;
+    }
+
+    return 0.0f;
+}
+
+// EN: Integral of the PolyBLEP residual: (1 - |x|)^3 / 6 on both sides of the corner.
+// ES: Integral del residuo PolyBLEP: (1 - |x|)^3 / 6 a ambos lados de la esquina.
+float BandLimitedOscillator::polyBlamp(float t, float dt)
+{
+    if (t < dt)
+    {
+        const float x = 1.0f - t / dt;
+        return x * x * x * (1.0f / 6.0f);
+    }
+
+    if (t > 1.0f - dt)
+    {
+        const float x = 1.0f + (t - 1.0f) / dt;
+        return x * x * x * (1.0f / 6.0f);
+    }
+
+    return 0.0f;
+}
+
+// EN: Splits the block into chunks. The pulse width of a chunk is copied into widths, limited to the range
+//     of the waveform.
+// ES: Divide el bloque en tramos. El ancho de pulso de un tramo se copia en widths, limitado al rango de la
+//     forma de onda.
+void BandLimitedOscillator::process(float* output, int numSamples, const float* frequencyBuffer, const float* pulseWidthBuffer,
+                                    const float* phaseModBuffer, const float* syncInput, float* syncOutput)
+{
+    const float minWidth = waveform == Waveform::Triangle ? minTriangleWidth : 0.0f;
+    const float maxWidth = waveform == Waveform::Triangle ? maxTriangleWidth : 1.0f;
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int n = juce::jmin(chunkSize, numSamples - start);
+
+        advancePhase(n, frequencyBuffer != nullptr ? frequencyBuffer + start : nullptr,
+                     syncInput != nullptr ? syncInput + start : nullptr,
+                     syncOutput != nullptr ? syncOutput + start : nullptr);
+
+        modulatePhase(n, phaseModBuffer != nullptr ? phaseModBuffer + start : nullptr);
+
+        if (pulseWidthBuffer != nullptr)
+            juce::FloatVectorOperations::clip(widths.data(), pulseWidthBuffer + start, minWidth, maxWidth, n);
+        else
+            juce::FloatVectorOperations::fill(widths.data(), juce::jlimit(minWidth, maxWidth, pulseWidth), n);
+
+        renderChunk(output + start, n);
+
+        if (numSyncs > 0)
+            correctSync(output + start, start > 0);
+    }
+}
+
+// EN: Both oscillators get the same frequency, modulation and sync, so copying the phase state (phase, last phase
+//     modulation and last increment) keeps the second one exactly where it would be after rendering the block.
+// ES: Ambos osciladores reciben la misma frecuencia, modulación y sync, así copiar el estado de fase (fase, última
+//     modulación de fase y último incremento) deja al segundo exactamente donde estaría tras generar el bloque.
+void BandLimitedOscillator::processChannels(BandLimitedOscillator (&oscillators)[2], juce::AudioBuffer<float>& buffer, const float* frequencyBuffer,
+                                            const float* pulseWidthBuffer, const float* phaseModBuffer, const float* syncInput)
+{
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    if (numChannels == 0)
+        return;
+
+    auto& first = oscillators[0];
+    auto& second = oscillators[1];
+
+    first.process(buffer.getWritePointer(0), numSamples, frequencyBuffer, pulseWidthBuffer, phaseModBuffer, syncInput);
+
+    const bool spread = numChannels > 1 && second.phaseOffset != first.phaseOffset;
+
+    if (spread)
+    {
+        second.process(buffer.getWritePointer(1), numSamples, frequencyBuffer, pulseWidthBuffer, phaseModBuffer, syncInput);
+    }
+    else
+    {
+        second.accumulator = first.accumulator;
+        second.lastPhaseMod = first.lastPhaseMod;
+        second.lastIncrement = first.lastIncrement;
+    }
+
+    for (int channel = spread ? 2 : 1; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+}
+
+// EN: With a fixed frequency and no sync the accumulator writes the phases of the chunk directly. Otherwise the
+//     increments (scaled as a vector from the frequency buffer) are converted to fixed point and accumulated, and a
+//     sync reset at position s restarts the phase at (1 - s) * increment. The fixed-point phase wraps by itself.
+//     A cycle starts where the phase is below the increment that led to it; its position is 1 - phase / increment.
+// ES: Con una frecuencia fija y sin sync el acumulador escribe directamente las fases del tramo. Si no, los
+//     incrementos (escalados como vector desde el buffer de frecuencia) se convierten a punto fijo y se acumulan, y
+//     un reinicio de sync en la posición s reinicia la fase en (1 - s) * incremento. La fase en punto fijo se ajusta sola.
+//     Un ciclo empieza donde la fase es menor que el incremento que llevó a ella; su posición es 1 - fase / incremento.
+void BandLimitedOscillator::advancePhase(int numSamples, const float* frequencyBuffer, const float* syncInput, float* syncOutput)
+{
+    float* p = phases.data();
+    float* dt = increments.data();
+    uint32_t* fixedDt = fixedIncrements.data();
+
+    numSyncs = 0;
+
+    if (frequencyBuffer == nullptr && syncInput == nullptr && syncOutput == nullptr)
+    {
+        accumulator.process(p, numSamples);
+        juce::FloatVectorOperations::fill(dt, accumulator.getIncrement(), numSamples);
+        lastIncrement = accumulator.getFixedIncrement();
+        return;
+    }
+
+    if (frequencyBuffer != nullptr)
+    {
+        juce::FloatVectorOperations::multiply(dt, frequencyBuffer, static_cast<float>(1.0 / sampleRate), numSamples);
+        juce::FloatVectorOperations::clip(dt, dt, 0.0f, maxIncrement, numSamples);
+
+        // EN: dt is at most 0.5, so dt * 2^31 fits in a signed integer, which converts faster than an unsigned one.
+        // ES: dt es como mucho 0.5, así dt * 2^31 cabe en un entero con signo, que se convierte más rápido que uno sin signo.
+        for (int i = 0; i < numSamples; i++)
+            fixedDt[i] = static_cast<uint32_t>(static_cast<int32_t>(dt[i] * 2147483648.0f)) << 1;
+    }
+    else
+    {
+        juce::FloatVectorOperations::fill(dt, accumulator.getIncrement(), numSamples);
+        std::fill(fixedDt, fixedDt + numSamples, accumulator.getFixedIncrement());
+    }
+
+    uint32_t value = accumulator.getFixedPhase();
+    uint32_t incoming = lastIncrement;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        if (syncInput != nullptr && syncInput[i] > 0.0f)
+        {
+            const float position = juce::jmin(syncInput[i], 1.0f);
+            const uint32_t elapsed = static_cast<uint32_t>((1.0 - position) * incoming);
+
+            syncIndices[static_cast<size_t>(numSyncs)] = i;
+            syncPositions[static_cast<size_t>(numSyncs)] = position;
+            syncPhasesBefore[static_cast<size_t>(numSyncs)] = PhaseAccumulator::toCycles(value - elapsed);
+            syncPhasesAfter[static_cast<size_t>(numSyncs)] = 0.0f;
+            numSyncs++;
+
+            value = elapsed;
+        }
+
+        p[i] = PhaseAccumulator::toCycles(value);
+
+        if (syncOutput != nullptr)
+            syncOutput[i] = value < incoming ? 1.0f - static_cast<float>(value) / static_cast<float>(incoming) : 0.0f;
+
+        incoming = fixedDt[i];
+        value += incoming;
+    }
+
+    accumulator.setFixedPhase(value);
+    lastIncrement = incoming;
+}
+
+// EN: The phase modulation also changes how fast the phase moves, so the increment used by the residuals becomes
+//     |increment + change of the modulation| (the change wrapped to half a cycle). The residuals are symmetric,
+//     so a phase moving backwards is corrected the same way.
+// ES: La modulación de fase también cambia la velocidad de la fase, así el incremento usado por los residuos pasa
+//     a ser |incremento + cambio de la modulación| (el cambio ajustado a medio ciclo). Los residuos son simétricos,
+//     así una fase que retrocede se corrige igual.
+void BandLimitedOscillator::modulatePhase(int numSamples, const float* phaseModBuffer)
+{
+    float* p = phases.data();
+    float* dt = increments.data();
+
+    if (phaseModBuffer == nullptr)
+    {
+        lastPhaseMod = 0.0f;
+
+        if (phaseOffset != 0.0f)
+        {
+            for (int i = 0; i < numSamples; i++)
+            {
+                const float value = p[i] + phaseOffset;
+                p[i] = value - std::floor(value);
+            }
+        }
+    }
+    else
+    {
+        float previous = lastPhaseMod;
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            const float value = p[i] + phaseOffset + phaseModBuffer[i];
+            p[i] = value - std::floor(value);
+
+            float change = phaseModBuffer[i] - previous;
+            change -= std::round(change);
+            dt[i] = juce::jmin(maxIncrement, std::abs(dt[i] + change));
+
+            previous = phaseModBuffer[i];
+        }
+
+        lastPhaseMod = previous;
+    }
+
+    for (int k = 0; k < numSyncs; k++)
+    {
+        const size_t s = static_cast<size_t>(k);
+        const float shift = phaseOffset + (phaseModBuffer != nullptr ? phaseModBuffer[syncIndices[s]] : 0.0f);
+
+        syncPhasesBefore[s] += shift;
+        syncPhasesBefore[s] -= std::floor(syncPhasesBefore[s]);
+        syncPhasesAfter[s] = shift - std::floor(shift);
+    }
+}
+
+// EN: The naive waveform plus the residuals of its discontinuities. t2 is the phase measured from the pulse
+//     width, where the pulse falls and the triangle has its peak.
+// ES: La forma de onda ingenua más los residuos de sus discontinuidades. t2 es la fase medida desde el ancho de
+//     pulso, donde el pulso baja y el triángulo tiene su pico.
+void BandLimitedOscillator::renderChunk(float* output, int numSamples) const
+{
+    const float* p = phases.data();
+    const float* dt = increments.data();
+    const float* w = widths.data();
+
+    switch (waveform)
+    {
+        case Waveform::Sawtooth:
+            for (int i = 0; i < numSamples; i++)
+                output[i] = 2.0f * p[i] - 1.0f - 2.0f * polyBlep(p[i], dt[i]);
+            break;
+
+        case Waveform::Pulse:
+            for (int i = 0; i < numSamples; i++)
+            {
+                float t2 = p[i] - w[i];
+                t2 += t2 < 0.0f ? 1.0f : 0.0f;
+
+                const float naive = p[i] < w[i] ? 1.0f : -1.0f;
+                output[i] = naive + 2.0f * (polyBlep(p[i], dt[i]) - polyBlep(t2, dt[i]));
+            }
+            break;
+
+        case Waveform::Triangle:
+            for (int i = 0; i < numSamples; i++)
+            {
+                float t2 = p[i] - w[i];
+                t2 += t2 < 0.0f ? 1.0f : 0.0f;
+
+                // EN: Rises from -1 to 1 until the width, then falls back to -1.
+                // ES: Sube de -1 a 1 hasta el ancho, luego baja de vuelta a -1.
+                const float rising = 2.0f * p[i] / w[i] - 1.0f;
+                const float falling = 1.0f - 2.0f * t2 / (1.0f - w[i]);
+                const float naive = p[i] < w[i] ? rising : falling;
+
+                // EN: Both corners change the slope by the same amount, converted to a change per sample.
+                // ES: Las dos esquinas cambian la pendiente en la misma cantidad, convertida a cambio por muestra.
+                const float slopeChange = (2.0f / w[i] + 2.0f / (1.0f - w[i])) * dt[i];
+                output[i] = naive + slopeChange * (polyBlamp(p[i], dt[i]) - polyBlamp(t2, dt[i]));
+            }
+            break;
+
+        case Waveform::ImpulseTrain:
+            for (int i = 0; i < numSamples; i++)
+            {
+                // EN: Weight of the impulse at phase 0 on this sample, by its distance in samples.
+                // ES: Peso del impulso en la fase 0 sobre esta muestra, según su distancia en muestras.
+                const float after = p[i] < dt[i] ? 1.0f - p[i] / dt[i] : 0.0f;
+                const float before = p[i] > 1.0f - dt[i] ? 1.0f - (1.0f - p[i]) / dt[i] : 0.0f;
+                output[i] = after + before;
+            }
+            break;
+
+        case Waveform::Sine:
+            for (int i = 0; i < numSamples; i++)
+                output[i] = PhaseAccumulator::sine(p[i]);
+            break;
+    }
+}
+
+// EN: A reset jumps from the phase before to the phase after, a step of height h. The sample of the reset is
+//     rendered again from its naive value (the residuals of the waveform's own edges assumed a continuous phase)
+//     plus the residual -h s^2 / 2, and the previous sample gets h (1 - s)^2 / 2. The impulse train has no steps:
+//     a reset at phase 0 is an impulse, split between the two samples like the others.
+//     Only the step is corrected; the corner a reset leaves in the triangle and the sine is not.
+// ES: Un reinicio salta de la fase anterior a la fase posterior, un salto de altura h. La muestra del reinicio se
+//     genera de nuevo desde su valor ingenuo (los residuos de los bordes propios de la forma de onda suponían una
+//     fase continua) más el residuo -h s^2 / 2, y la muestra anterior recibe h (1 - s)^2 / 2. El tren de impulsos
+//     no tiene saltos: un reinicio en la fase 0 es un impulso, repartido entre las dos muestras como los demás.
+//     Solo se corrige el salto; la esquina que un reinicio deja en el triángulo y el seno no.
+void BandLimitedOscillator::correctSync(float* output, bool hasPrevious) const
+{
+    for (int k = 0; k < numSyncs; k++)
+    {
+        const size_t s = static_cast<size_t>(k);
+        const int i = syncIndices[s];
+        const float position = syncPositions[s];
+        const bool previousExists = i > 0 || hasPrevious;
+
+        if (waveform == Waveform::ImpulseTrain)
+        {
+            if (syncPhasesAfter[s] == 0.0f && previousExists)
+                output[i - 1] += 1.0f - position;
+            continue;
+        }
+
+        const float width = widths[static_cast<size_t>(i)];
+        const float step = naiveValue(syncPhasesAfter[s], width) - naiveValue(syncPhasesBefore[s], width);
+
+        output[i] = naiveValue(phases[static_cast<size_t>(i)], width) - 0.5f * step * position * position;
+
+        if (previousExists)
+            output[i - 1] += 0.5f * step * (1.0f - position) * (1.0f - position);
+    }
+}
+
+// EN: The same shapes as renderChunk, without the residuals.
+// ES: Las mismas formas que renderChunk, sin los residuos.
+float BandLimitedOscillator::naiveValue(float p, float width) const
+{
+    switch (waveform)
+    {
+        case Waveform::Sawtooth:     return 2.0f * p - 1.0f;
+        case Waveform::Pulse:        return p < width ? 1.0f : -1.0f;
+        case Waveform::Triangle:     return p < width ? 2.0f * p / width - 1.0f : 1.0f - 2.0f * (p - width) / (1.0f - width);
+        case Waveform::Sine:         return PhaseAccumulator::sine(p);
+        case Waveform::ImpulseTrain: return 0.0f;
+    }
+
+    return 0.0f;
+}
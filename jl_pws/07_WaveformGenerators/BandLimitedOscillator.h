@@ -0,0 +1,197 @@
+/*
+  ==============================================================================
+
+    BandLimitedOscillator.h
+    Created: 19 Oct 2026 3:18:19am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
+
+// EN: BandLimitedOscillator is the phase-accumulator core shared by SawtoothWave2, SquareWave2, DutyCicleWave,
+//     TriangleWave2 and ImpulseTrain. It renders a whole block per call with PolyBLEP/PolyBLAMP corrections, so
+//     the waveforms do not need oversampling:
+//     - Sawtooth and Pulse: PolyBLEP removes the aliasing of the steps (a two-sample polynomial residual).
+//     - Triangle: PolyBLAMP removes the aliasing of the corners (the integral of the PolyBLEP residual).
+//     - ImpulseTrain: each impulse is split between the two samples around its exact position (the derivative
+//       of the PolyBLEP step), so the impulses are not rounded to the sample grid.
+//     The block is rendered in chunks of chunkSize samples: first the phases and increments of the chunk are
+//     computed with the fixed-point PhaseAccumulator, then the waveform is computed over the arrays in a straight
+//     loop the compiler can vectorize.
+//     Frequency, pulse width, phase modulation and hard sync can be given per sample with buffers, so FM/PM cost a
+//     multiply-add per sample instead of a setFrequency call. A sync reset is a step of the waveform and is
+//     corrected with the same PolyBLEP residual, placed at the sub-sample position of the reset.
+// ES: BandLimitedOscillator es el núcleo acumulador de fase compartido por SawtoothWave2, SquareWave2,
+//     DutyCicleWave, TriangleWave2 e ImpulseTrain. Genera un bloque completo por llamada con correcciones
+//     PolyBLEP/PolyBLAMP, así las formas de onda no necesitan sobremuestreo:
+//     - Sawtooth y Pulse: PolyBLEP elimina el aliasing de los saltos (un residuo polinómico de dos muestras).
+//     - Triangle: PolyBLAMP elimina el aliasing de las esquinas (la integral del residuo PolyBLEP).
+//     - ImpulseTrain: cada impulso se reparte entre las dos muestras alrededor de su posición exacta (la derivada
+//       del salto PolyBLEP), así los impulsos no se redondean a la rejilla de muestras.
+//     El bloque se genera en tramos de chunkSize muestras: primero se calculan las fases e incrementos del tramo
+//     con el PhaseAccumulator de punto fijo, luego la forma de onda se calcula sobre los arrays en un bucle directo que el compilador puede vectorizar.
+//     La frecuencia, el ancho de pulso, la modulación de fase y el sync duro se pueden dar por muestra con buffers,
+//     así FM/PM cuestan una multiplicación-suma por muestra en lugar de una llamada a setFrequency. Un reinicio de
+//     sync es un salto de la forma de onda y se corrige con el mismo residuo PolyBLEP, situado en la posición
+//     dentro de la muestra del reinicio.
+class BandLimitedOscillator
+{
+public:
+    // EN: Pulse uses the pulse width as the duty cycle (0.5 is a square). Triangle uses it as the position of
+    //     the peak (0.5 is symmetric). Sine has no discontinuities except the sync ones.
+    // ES: Pulse usa el ancho de pulso como ciclo de trabajo (0.5 es una cuadrada). Triangle lo usa como la
+    //     posición del pico (0.5 es simétrica). Sine no tiene discontinuidades salvo las de sync.
+    enum class Waveform
+    {
+        Sawtooth,
+        Pulse,
+        Triangle,
+        ImpulseTrain,
+        Sine
+    };
+
+    // EN: Constructor.
+    // ES: Constructor.
+    BandLimitedOscillator();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~BandLimitedOscillator();
+
+    // EN: Sets the sample rate.
+    // ES: Establece la frecuencia de muestreo.
+    void prepare(double inSampleRate);
+
+    // EN: Sets the phase (0 to 1).
+    // ES: Establece la fase (0 a 1).
+    void reset(float inPhase = 0.0f);
+
+    // EN: Sets the waveform.
+    // ES: Establece la forma de onda.
+    void setWaveform(Waveform inWaveform);
+
+    // EN: Sets the frequency in Hz, used when process gets no frequency buffer.
+    // ES: Establece la frecuencia en Hz, usada cuando process no recibe un buffer de frecuencia.
+    void setFrequency(float inFrequency);
+
+    // EN: Sets the pulse width (0 to 1), used when process gets no pulse width buffer.
+    // ES: Establece el ancho de pulso (0 a 1), usado cuando process no recibe un buffer de ancho de pulso.
+    void setPulseWidth(float inPulseWidth);
+
+    // EN: Sets a constant phase offset in cycles, added to the phase modulation.
+    // ES: Establece un desfase constante en ciclos, sumado a la modulación de fase.
+    void setPhaseOffset(float inPhaseOffset);
+
+    // EN: Writes numSamples of the waveform to output. Every buffer is optional and holds one value per sample:
+    //     - frequencyBuffer: frequency in Hz.
+    //     - pulseWidthBuffer: pulse width (0 to 1).
+    //     - phaseModBuffer: phase offset in cycles (1 is a whole cycle).
+    //     - syncInput: 0 for no reset, or the position of a reset between the previous sample (just above 0)
+    //       and this one (1). The phase restarts at 0 there.
+    //     - syncOutput: receives the positions where this oscillator starts a cycle, in the same format, to drive
+    //       the syncInput of another oscillator.
+    // ES: Escribe numSamples de la forma de onda en output. Cada buffer es opcional y tiene un valor por muestra:
+    //     - frequencyBuffer: frecuencia en Hz.
+    //     - pulseWidthBuffer: ancho de pulso (0 a 1).
+    //     - phaseModBuffer: desfase en ciclos (1 es un ciclo completo).
+    //     - syncInput: 0 si no hay reinicio, o la posición de un reinicio entre la muestra anterior (justo por
+    //       encima de 0) y esta (1). La fase vuelve a 0 ahí.
+    //     - syncOutput: recibe las posiciones donde este oscilador empieza un ciclo, en el mismo formato, para
+    //       controlar el syncInput de otro oscilador.
+    void process(float* output, int numSamples, const float* frequencyBuffer = nullptr, const float* pulseWidthBuffer = nullptr,
+                 const float* phaseModBuffer = nullptr, const float* syncInput = nullptr, float* syncOutput = nullptr);
+
+    // EN: Renders a stereo pair of oscillators into buffer. oscillators[0] writes the first channel, which is
+    //     copied to the other channels. oscillators[1] only renders the second channel when its phase offset
+    //     differs from the first one; otherwise it follows the phase of oscillators[0], so the offset can be
+    //     changed at any time without a jump.
+    // ES: Genera un par estéreo de osciladores en buffer. oscillators[0] escribe el primer canal, que se copia a
+    //     los demás canales. oscillators[1] solo genera el segundo canal cuando su desfase es distinto del primero;
+    //     si no, sigue la fase de oscillators[0], así el desfase se puede cambiar en cualquier momento sin saltos.
+    static void processChannels(BandLimitedOscillator (&oscillators)[2], juce::AudioBuffer<float>& buffer, const float* frequencyBuffer = nullptr,
+                                const float* pulseWidthBuffer = nullptr, const float* phaseModBuffer = nullptr, const float* syncInput = nullptr);
+
+    // EN: PolyBLEP residual of a unit step at phase 0, for a phase t (0 to 1) that advances dt per sample.
+    // ES: Residuo PolyBLEP de un salto unitario en la fase 0, para una fase t (0 a 1) que avanza dt por muestra.
+    static float polyBlep(float t, float dt);
+
+    // EN: PolyBLAMP residual of a unit slope change (per sample) at phase 0.
+    // ES: Residuo PolyBLAMP de un cambio de pendiente unitario (por muestra) en la fase 0.
+    static float polyBlamp(float t, float dt);
+
+    static constexpr int chunkSize = 64;
+
+private:
+    // EN: Fills phases and increments for numSamples (at most chunkSize), applies the sync resets, writes the
+    //     sync output and advances the phase.
+    // ES: Llena phases e increments para numSamples (como mucho chunkSize), aplica los reinicios de sync,
+    //     escribe la salida de sync y avanza la fase.
+    void advancePhase(int numSamples, const float* frequencyBuffer, const float* syncInput, float* syncOutput);
+
+    // EN: Adds the phase offset and the phase modulation to the phases of the chunk.
+    // ES: Suma el desfase y la modulación de fase a las fases del tramo.
+    void modulatePhase(int numSamples, const float* phaseModBuffer);
+
+    // EN: Applies the PolyBLEP residual of each sync reset of the chunk. hasPrevious tells whether
+    //     output[-1] belongs to the block.
+    // ES: Aplica el residuo PolyBLEP de cada reinicio de sync del tramo. hasPrevious indica si output[-1]
+    //     pertenece al bloque.
+    void correctSync(float* output, bool hasPrevious) const;
+
+    // EN: Value of the waveform without corrections at phase p.
+    // ES: Valor de la forma de onda sin correcciones en la fase p.
+    float naiveValue(float p, float width) const;
+
+    // EN: Computes the waveform of the chunk from phases, increments and widths.
+    // ES: Calcula la forma de onda del tramo a partir de phases, increments y widths.
+    void renderChunk(float* output, int numSamples) const;
+
+    // EN: The correction polynomials span one sample on each side of a discontinuity, so the increment is kept
+    //     below half a cycle (the Nyquist frequency).
+    // ES: Los polinomios de corrección abarcan una muestra a cada lado de una discontinuidad, así el incremento
+    //     se mantiene por debajo de medio ciclo (la frecuencia de Nyquist).
+    static constexpr float maxIncrement = 0.5f;
+
+    // EN: Limits of the triangle peak position, which keep its slopes finite.
+    // ES: Límites de la posición del pico del triángulo, que mantienen sus pendientes finitas.
+    static constexpr float minTriangleWidth = 0.001f;
+    static constexpr float maxTriangleWidth = 0.999f;
+
+    Waveform waveform{ Waveform::Sawtooth };
+
+    double sampleRate{ 44100.0 };
+    float frequency{ 100.0f };
+    float pulseWidth{ 0.5f };
+
+    // EN: Fixed-point phase, and the increment of the fixed frequency.
+    // ES: Fase en punto fijo, y el incremento de la frecuencia fija.
+    PhaseAccumulator accumulator;
+
+    // EN: Constant phase offset, and the phase modulation and increment of the last sample, which continue
+    //     into the next block.
+    // ES: Desfase constante, y la modulación de fase y el incremento de la última muestra, que continúan en el
+    //     siguiente bloque.
+    float phaseOffset{ 0.0f };
+    float lastPhaseMod{ 0.0f };
+    uint32_t lastIncrement{ 0 };
+
+    // EN: Chunk scratch arrays.
+    // ES: Arrays temporales del tramo.
+    std::array<float, chunkSize> phases{};
+    std::array<float, chunkSize> increments{};
+    std::array<uint32_t, chunkSize> fixedIncrements{};
+    std::array<float, chunkSize> widths{};
+
+    // EN: Sync resets of the chunk: sample index, position in the sample and phase just before and just after.
+    // ES: Reinicios de sync del tramo: índice de muestra, posición en la muestra y fase justo antes y justo después.
+    std::array<int, chunkSize> syncIndices{};
+    std::array<float, chunkSize> syncPositions{};
+    std::array<float, chunkSize> syncPhasesBefore{};
+    std::array<float, chunkSize> syncPhasesAfter{};
+    int numSyncs{ 0 };
+};
@@ -14,14 +14,19 @@
 // ES: Establece la frecuencia de la forma de onda y calcula el incremento de fase.
 void DutyCicleWave::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
 
-    // EN: Calculate the phase increment based on the frequency and sample rate.
-    // ES: Calcula el incremento de fase basado en la frecuencia y la frecuencia de muestreo.
-    if (sampleRate > 0.0f)
-    {
-        phaseIncrement = 1.0f / (sampleRate / frequency);
-    }
+    // EN: The oscillators calculate the phase increment based on the frequency and sample rate.
+    // ES: Los osciladores calculan el incremento de fase basado en la frecuencia y la frecuencia de muestreo.
+    for (auto& osc : oscillator)
+        osc.setFrequency(frequency);
+}
+
+// EN: Sets the phase offset of one channel.
+// ES: Establece el desfase de un canal.
+void DutyCicleWave::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    oscillator[juce::jlimit(0, 1, channel)].setPhaseOffset(inPhaseOffset);
 }
 
 // EN: Sets the duty cycle of the waveform, ensuring it is in the range [0.0, 1.0].
@@ -30,7 +35,10 @@ void DutyCicleWave::setDutyCycle(float inDutyCycle)
 {
     // EN: Convert percentage to a normalized value between 0.0 and 1.0.
     // ES: Convierte el porcentaje en un valor normalizado entre 0.0 y 1.0.
-    dutyCycle = inDutyCycle / 100.f;
+    dutyCycle = juce::jlimit(0.0f, 1.0f, inDutyCycle / 100.f);
+
+    for (auto& osc : oscillator)
+        osc.setPulseWidth(dutyCycle);
 }
 
 // EN: Prepares the waveform generator by setting the sample rate.
@@ -40,50 +48,29 @@ void DutyCicleWave::prepare(double theSampleRate)
     // EN: Cast sample rate to float for consistent internal calculations.
     // ES: Convierte la frecuencia de muestreo a float para c�lculos internos consistentes.
     sampleRate = static_cast<float>(theSampleRate);
+
+    for (auto& osc : oscillator)
+        osc.prepare(theSampleRate);
 }
 
-// EN: Processes the audio buffer by generating a square waveform with the specified duty cycle.
-// ES: Procesa el buffer de audio generando una onda cuadrada con el ciclo de trabajo especificado.
+// EN: Processes the audio buffer by generating a band-limited pulse wave with the specified duty cycle.
+// ES: Procesa el buffer de audio generando una onda de pulso de banda limitada con el ciclo de trabajo especificado.
 void DutyCicleWave::process(juce::AudioBuffer<float>& buffer)
 {
-    // EN: Loop through each audio channel.
-    // ES: Itera por cada canal de audio.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
-    {
-        // EN: Loop through each sample in the channel.
-        // ES: Itera por cada muestra del canal.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            // EN: Calculate the total period and the active portion based on duty cycle.
-            // ES: Calcula el periodo total y la porci�n activa basada en el ciclo de trabajo.
-            float fullPeriodTime = 1.0f / frequency;
-            float halfPeriodTime = fullPeriodTime * dutyCycle;
-
-            // EN: Determine the current phase time within the waveform's period.
-            // ES: Determina el tiempo actual de la fase dentro del periodo de la forma de onda.
-            float localTime = fmod(phase[channel] * fullPeriodTime, fullPeriodTime);
-
-            // EN: Output +1.0 if within the active duty cycle, otherwise -1.0.
-            // ES: Produce +1.0 si est� dentro del ciclo activo, de lo contrario -1.0.
-            float outSample = (localTime < halfPeriodTime) ? 1.0f : -1.0f;
-
-            // EN: Write the generated sample to the buffer.
-            // ES: Escribe la muestra generada en el buffer.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Update the phase and wrap it to stay within [0, 1).
-            // ES: Actualiza la fase y la ajusta para mantenerse dentro del rango [0, 1).
-            phase[channel] += phaseIncrement;
-            if (phase[channel] >= 1.0f)
-                phase[channel] -= 1.0f;
-        }
-    }
+    // EN: The oscillator outputs +1.0 within the active duty cycle and -1.0 otherwise, with PolyBLEP on both edges.
+    // ES: El oscilador produce +1.0 dentro del ciclo activo y -1.0 en el resto, con PolyBLEP en ambos flancos.
+    BandLimitedOscillator::processChannels(oscillator, buffer);
 }
 
 // EN: Constructor - Initializes the class, setting default values for its members.
 // ES: Constructor - Inicializa la clase, configurando valores predeterminados para sus miembros.
 DutyCicleWave::DutyCicleWave()
 {
+    for (auto& osc : oscillator)
+    {
+        osc.setWaveform(BandLimitedOscillator::Waveform::Pulse);
+        osc.setPulseWidth(dutyCycle);
+    }
 }
 
 // EN: Destructor - Cleans up any resources (none in this case).
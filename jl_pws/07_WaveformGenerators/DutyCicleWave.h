@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la forma de onda.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Sets the duty cycle of the waveform (percentage of the cycle where the signal is "on").
     // ES: Establece el ciclo de trabajo de la forma de onda (porcentaje del ciclo en el que la se�al est� "activa").
     void setDutyCycle(float inDutyCycle);
@@ -49,13 +55,9 @@ private:
     // ES: La frecuencia de muestreo del sistema de audio en Hz (por defecto: 44100 Hz).
     float sampleRate{ 44100 };
 
-    // EN: The amount by which the phase increases per sample, based on frequency and sample rate.
-    // ES: La cantidad por la que incrementa la fase por muestra, basada en la frecuencia y la frecuencia de muestreo.
-    float phaseIncrement{};
-
-    // EN: The current phase of the waveform for each channel.
-    // ES: La fase actual de la forma de onda para cada canal.
-    float phase[2]{};
+    // EN: The band-limited (PolyBLEP) oscillator of each channel.
+    // ES: El oscilador de banda limitada (PolyBLEP) de cada canal.
+    BandLimitedOscillator oscillator[2];
 
     // EN: The duty cycle of the waveform as a percentage (0�100%).
     // ES: El ciclo de trabajo de la forma de onda como porcentaje (0�100%).
@@ -22,6 +22,13 @@ public:
     // ES: Establece la frecuencia del tren de impulsos.
     void setFrequency(double inFrequency);
 
+    // Método para establecer el desfase de un canal
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // M�todo para preparar el tren de impulsos con una frecuencia de muestreo espec�fica
     // EN: Prepares the impulse train with a specified sample rate.
     // ES: Prepara el tren de impulsos con una frecuencia de muestreo espec�fica.
@@ -43,15 +50,10 @@ public:
     ~ImpulseTrain();
 
 private:
-    // Fase para cada canal
-    // EN: Phase for each audio channel.
-    // ES: Fase para cada canal de audio.
-    float phase[2]{ 0.0f, 0.0f };
-
-    // Incremento de fase para controlar el ciclo de la onda
-    // EN: Phase increment to control the wave cycle.
-    // ES: Incremento de fase para controlar el ciclo de la onda.
-    float phaseIncrement = 0.0f;
+    // Oscilador de banda limitada para cada canal
+    // EN: Band-limited oscillator for each audio channel.
+    // ES: Oscilador de banda limitada para cada canal de audio.
+    BandLimitedOscillator oscillator[2];
 
     // Frecuencia de muestreo
     // EN: The sample rate of the audio system.
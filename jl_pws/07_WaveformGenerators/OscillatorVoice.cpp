@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    OscillatorVoice.cpp
+    Created: 19 Oct 2026 3:25:15am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "OscillatorVoice.h"
+
+// EN: Constructor of OscillatorVoice class (attack and release ramps with a full sustain by default).
+// ES: Constructor de la clase OscillatorVoice (rampas de ataque y liberación con sostenimiento completo por defecto).
+OscillatorVoice::OscillatorVoice()
+{
+    envelope.setAttackTime(0.002f);
+    envelope.setDecayTime(0.0f);
+    envelope.setSustainLevel(1.0f);
+    envelope.setReleaseTime(0.05f);
+}
+
+// EN: Destructor of OscillatorVoice class.
+// ES: Destructor de la clase OscillatorVoice.
+OscillatorVoice::~OscillatorVoice()
+{
+}
+
+// EN: Sets the sample rate of the voice and its oscillator.
+// ES: Establece la frecuencia de muestreo de la voz y de su oscilador.
+void OscillatorVoice::prepare(double inSampleRate)
+{
+    sampleRate = inSampleRate;
+    oscillator.prepare(sampleRate);
+    envelope.prepare(sampleRate);
+}
+
+// EN: Sets the waveform of the oscillator.
+// ES: Establece la forma de onda del oscilador.
+void OscillatorVoice::setWaveform(BandLimitedOscillator::Waveform inWaveform)
+{
+    oscillator.setWaveform(inWaveform);
+}
+
+// EN: Sets the pulse width of the oscillator.
+// ES: Establece el ancho de pulso del oscilador.
+void OscillatorVoice::setPulseWidth(float inPulseWidth)
+{
+    oscillator.setPulseWidth(inPulseWidth);
+}
+
+// EN: Sets the attack time.
+// ES: Establece el tiempo de ataque.
+void OscillatorVoice::setAttackTime(float inAttackTime)
+{
+    envelope.setAttackTime(inAttackTime);
+}
+
+// EN: Sets the decay time.
+// ES: Establece el tiempo de caída.
+void OscillatorVoice::setDecayTime(float inDecayTime)
+{
+    envelope.setDecayTime(inDecayTime);
+}
+
+// EN: Sets the sustain level.
+// ES: Establece el nivel de sostenimiento.
+void OscillatorVoice::setSustainLevel(float inSustainLevel)
+{
+    envelope.setSustainLevel(inSustainLevel);
+}
+
+// EN: Sets the release time.
+// ES: Establece el tiempo de liberación.
+void OscillatorVoice::setReleaseTime(float inReleaseTime)
+{
+    envelope.setReleaseTime(inReleaseTime);
+}
+
+// EN: An idle voice starts from phase 0 and silence; a sounding one continues from where it is. A velocity of 0
+//     releases the voice like stopNote (VoicePool already turns it into a note-off before choosing a slot).
+// ES: Una voz inactiva empieza desde la fase 0 y el silencio; una que suena continúa desde donde está. Una velocidad
+//     de 0 libera la voz como stopNote (VoicePool ya la convierte en un note-off antes de elegir una posición).
+void OscillatorVoice::startNote(int midiNote, float velocity)
+{
+    if (velocity <= 0.0f)
+    {
+        stopNote();
+        return;
+    }
+
+    if (!active)
+    {
+        oscillator.reset();
+        envelope.reset();
+    }
+
+    oscillator.setFrequency(440.0f * std::exp2((static_cast<float>(midiNote) - 69.0f) / 12.0f));
+    active = true;
+    envelope.noteOn(velocity);
+}
+
+// EN: Resets the oscillator and the envelope, so the next note starts like one on an idle voice.
+// ES: Reinicia el oscilador y la envolvente, así la siguiente nota empieza como una en una voz inactiva.
+void OscillatorVoice::reset()
+{
+    oscillator.reset();
+    envelope.reset();
+    active = false;
+}
+
+// EN: Releases the envelope.
+// ES: Libera la envolvente.
+void OscillatorVoice::stopNote()
+{
+    envelope.noteOff();
+}
+
+// EN: Returns whether the voice is sounding.
+// ES: Devuelve si la voz está sonando.
+bool OscillatorVoice::isActive() const
+{
+    return active;
+}
+
+// EN: Per chunk, the oscillator fills scratch, the envelope fills gains and their product is added to output.
+//     The voice stops once the envelope has released.
+// ES: Por tramo, el oscilador llena scratch, la envolvente llena gains y su producto se suma a output. La voz se
+//     detiene cuando la envolvente ha terminado la liberación.
+void OscillatorVoice::render(float* output, int numSamples)
+{
+    for (int start = 0; start < numSamples && active; start += BandLimitedOscillator::chunkSize)
+    {
+        const int n = juce::jmin(BandLimitedOscillator::chunkSize, numSamples - start);
+
+        oscillator.process(scratch.data(), n);
+        envelope.render(gains.data(), n);
+
+        juce::FloatVectorOperations::addWithMultiply(output + start, scratch.data(), gains.data(), n);
+
+        active = envelope.isActive();
+    }
+}
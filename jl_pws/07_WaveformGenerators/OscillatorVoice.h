@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    OscillatorVoice.h
+    Created: 19 Oct 2026 3:25:15am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+
+// EN: OscillatorVoice is a voice for VoicePool: a BandLimitedOscillator tuned to a MIDI note, with a linear ADSR
+//     Envelope as its gain. A note started while the voice still sounds (a retrigger or a stolen voice) attacks
+//     from the current gain and keeps the phase, so it does not click.
+// ES: OscillatorVoice es una voz para VoicePool: un BandLimitedOscillator afinado a una nota MIDI, con una Envelope
+//     ADSR lineal como ganancia. Una nota iniciada mientras la voz aún suena (un redisparo o una voz robada) ataca
+//     desde la ganancia actual y conserva la fase, así no produce clics.
+class OscillatorVoice
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    OscillatorVoice();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~OscillatorVoice();
+
+    // EN: Sets the sample rate.
+    // ES: Establece la frecuencia de muestreo.
+    void prepare(double inSampleRate);
+
+    // EN: Sets the waveform and the pulse width of the oscillator.
+    // ES: Establece la forma de onda y el ancho de pulso del oscilador.
+    void setWaveform(BandLimitedOscillator::Waveform inWaveform);
+    void setPulseWidth(float inPulseWidth);
+
+    // EN: Sets the attack, decay and release times in seconds, and the sustain level (0 to 1).
+    // ES: Establece los tiempos de ataque, caída y liberación en segundos, y el nivel de sostenimiento (0 a 1).
+    void setAttackTime(float inAttackTime);
+    void setDecayTime(float inDecayTime);
+    void setSustainLevel(float inSustainLevel);
+    void setReleaseTime(float inReleaseTime);
+
+    // EN: Silences the voice at once: phase 0, a closed envelope and not active.
+    // ES: Silencia la voz de inmediato: fase 0, envolvente cerrada y no activa.
+    void reset();
+
+    // EN: Starts a note with a gain equal to the velocity (0 to 1).
+    // ES: Empieza una nota con una ganancia igual a la velocidad (0 a 1).
+    void startNote(int midiNote, float velocity);
+
+    // EN: Starts the release.
+    // ES: Empieza la liberación.
+    void stopNote();
+
+    // EN: Returns false once the release has finished.
+    // ES: Devuelve false cuando la liberación ha terminado.
+    bool isActive() const;
+
+    // EN: Adds numSamples of the voice to output.
+    // ES: Suma numSamples de la voz a output.
+    void render(float* output, int numSamples);
+
+private:
+    BandLimitedOscillator oscillator;
+    Envelope envelope;
+    std::array<float, BandLimitedOscillator::chunkSize> scratch{};
+    std::array<float, BandLimitedOscillator::chunkSize> gains{};
+
+    double sampleRate{ 44100.0 };
+    bool active{ false };
+};
@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    PhaseAccumulator.cpp
+    Created: 19 Oct 2026 3:35:37am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "PhaseAccumulator.h"
+
+// EN: Constructor of PhaseAccumulator class.
+// ES: Constructor de la clase PhaseAccumulator.
+PhaseAccumulator::PhaseAccumulator()
+{
+}
+
+// EN: Destructor of PhaseAccumulator class.
+// ES: Destructor de la clase PhaseAccumulator.
+PhaseAccumulator::~PhaseAccumulator()
+{
+}
+
+// EN: Sets the sample rate and recalculates the increment.
+// ES: Establece la frecuencia de muestreo y recalcula el incremento.
+void PhaseAccumulator::prepare(double inSampleRate)
+{
+    sampleRate = inSampleRate;
+    setFrequency(frequency);
+}
+
+// EN: Sets the phase.
+// ES: Establece la fase.
+void PhaseAccumulator::reset(float inPhase)
+{
+    phase = toFixed(inPhase);
+}
+
+// EN: The increment is computed in double and rounded once to fixed point.
+// ES: El incremento se calcula en double y se redondea una vez a punto fijo.
+void PhaseAccumulator::setFrequency(double inFrequency)
+{
+    frequency = inFrequency;
+
+    if (sampleRate > 0.0)
+        increment = toFixed(frequency / sampleRate);
+}
+
+// EN: Every phase of the block is start + i * increment in integer arithmetic, so the samples do not depend on
+//     each other and the loop vectorizes.
+// ES: Cada fase del bloque es inicio + i * incremento en aritmética entera, así las muestras no dependen unas de
+//     otras y el bucle se vectoriza.
+void PhaseAccumulator::process(float* phases, int numSamples)
+{
+    const uint32_t start = phase;
+    const uint32_t step = increment;
+
+    for (int i = 0; i < numSamples; i++)
+        phases[i] = toCycles(start + static_cast<uint32_t>(i) * step);
+
+    phase = start + static_cast<uint32_t>(numSamples) * step;
+}
+
+// EN: Returns the current phase and advances it.
+// ES: Devuelve la fase actual y la avanza.
+float PhaseAccumulator::getNextPhase()
+{
+    const float current = toCycles(phase);
+    phase += increment;
+    return current;
+}
+
+// EN: Returns the phase in cycles.
+// ES: Devuelve la fase en ciclos.
+float PhaseAccumulator::getPhase() const
+{
+    return toCycles(phase);
+}
+
+// EN: Returns the increment in cycles per sample; a backwards phase gives a value near 1.
+// ES: Devuelve el incremento en ciclos por muestra; una fase que retrocede da un valor cercano a 1.
+float PhaseAccumulator::getIncrement() const
+{
+    return static_cast<float>(increment / cycleLength);
+}
+
+// EN: Returns the fixed-point phase.
+// ES: Devuelve la fase en punto fijo.
+uint32_t PhaseAccumulator::getFixedPhase() const
+{
+    return phase;
+}
+
+// EN: Returns the fixed-point increment.
+// ES: Devuelve el incremento en punto fijo.
+uint32_t PhaseAccumulator::getFixedIncrement() const
+{
+    return increment;
+}
+
+// EN: Sets the fixed-point phase.
+// ES: Establece la fase en punto fijo.
+void PhaseAccumulator::setFixedPhase(uint32_t inPhase)
+{
+    phase = inPhase;
+}
+
+// EN: The fraction is scaled to 2^32 and rounded; a fraction that rounds up to a whole cycle wraps to 0 in the cast.
+// ES: La fracción se escala a 2^32 y se redondea; una fracción que se redondea a un ciclo completo se ajusta a 0 en la conversión.
+uint32_t PhaseAccumulator::toFixed(double cycles)
+{
+    const double fraction = cycles - std::floor(cycles);
+    return static_cast<uint32_t>(static_cast<uint64_t>(fraction * cycleLength + 0.5));
+}
+
+// EN: The top 24 bits are converted exactly, so the result is always below 1.
+// ES: Los 24 bits superiores se convierten de forma exacta, así el resultado siempre es menor que 1.
+float PhaseAccumulator::toCycles(uint32_t fixedPhase)
+{
+    return static_cast<float>(fixedPhase >> 8) * (1.0f / 16777216.0f);
+}
+
+// EN: With x = cycles - 0.5, sin(2 pi cycles) = -sin(2 pi x). |x| is folded around 0.25 into y in [0, 0.25], where
+//     sin(2 pi y) is the Taylor series up to degree 11 in Horner form (error below 6e-8 at the end of the range).
+// ES: Con x = cycles - 0.5, sin(2 pi cycles) = -sin(2 pi x). |x| se pliega alrededor de 0.25 en y en [0, 0.25], donde
+//     sin(2 pi y) es la serie de Taylor hasta grado 11 en forma de Horner (error por debajo de 6e-8 al final del rango).
+float PhaseAccumulator::sine(float cycles)
+{
+    const float x = cycles - 0.5f;
+    const float y = 0.25f - std::abs(std::abs(x) - 0.25f);
+
+    const float r = juce::MathConstants<float>::twoPi * y;
+    const float r2 = r * r;
+
+    const float value = r * (1.0f - r2 * (1.0f / 6.0f) * (1.0f - r2 * (1.0f / 20.0f) * (1.0f - r2 * (1.0f / 42.0f)
+                      * (1.0f - r2 * (1.0f / 72.0f) * (1.0f - r2 * (1.0f / 110.0f))))));
+
+    return x < 0.0f ? value : -value;
+}
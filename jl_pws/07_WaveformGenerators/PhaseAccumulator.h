@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    PhaseAccumulator.h
+    Created: 19 Oct 2026 3:35:37am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <cstdint>
+
+// EN: PhaseAccumulator is the phase core of the waveform generators. The phase is a 32-bit fixed-point fraction of
+//     a cycle (2^32 is one cycle), so it wraps by integer overflow: it never drifts, never needs a comparison to
+//     wrap and stays exact over renders of any length. The frequency resolution is sampleRate / 2^32 (about
+//     0.00001 Hz at 44.1 kHz). Phases are given to the waveforms as floats in [0, 1) with 24 bits of resolution.
+//     sine() evaluates sin(2 pi phase) with a folded polynomial instead of sinf; it has no branches or tables, so
+//     loops over channels, voices or samples vectorize.
+// ES: PhaseAccumulator es el núcleo de fase de los generadores de forma de onda. La fase es una fracción de ciclo en
+//     punto fijo de 32 bits (2^32 es un ciclo), así se ajusta por desbordamiento entero: nunca se desvía, nunca
+//     necesita una comparación para ajustarse y se mantiene exacta en generaciones de cualquier duración. La
+//     resolución de frecuencia es sampleRate / 2^32 (unos 0.00001 Hz a 44.1 kHz). Las fases se entregan a las formas
+//     de onda como floats en [0, 1) con 24 bits de resolución.
+//     sine() evalúa sin(2 pi fase) con un polinomio plegado en lugar de sinf; no tiene ramas ni tablas, así los
+//     bucles sobre canales, voces o muestras se vectorizan.
+class PhaseAccumulator
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    PhaseAccumulator();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~PhaseAccumulator();
+
+    // EN: Sets the sample rate and recalculates the increment.
+    // ES: Establece la frecuencia de muestreo y recalcula el incremento.
+    void prepare(double inSampleRate);
+
+    // EN: Sets the phase in cycles (wrapped to [0, 1)).
+    // ES: Establece la fase en ciclos (ajustada a [0, 1)).
+    void reset(float inPhase = 0.0f);
+
+    // EN: Sets the frequency in Hz. Negative frequencies run the phase backwards.
+    // ES: Establece la frecuencia en Hz. Las frecuencias negativas hacen retroceder la fase.
+    void setFrequency(double inFrequency);
+
+    // EN: Writes the phases (0 to 1) of the next numSamples samples and advances the phase.
+    // ES: Escribe las fases (0 a 1) de las siguientes numSamples muestras y avanza la fase.
+    void process(float* phases, int numSamples);
+
+    // EN: Returns the current phase (0 to 1) and advances it by one sample.
+    // ES: Devuelve la fase actual (0 a 1) y la avanza una muestra.
+    float getNextPhase();
+
+    // EN: Returns the phase (0 to 1) and the increment (cycles per sample).
+    // ES: Devuelve la fase (0 a 1) y el incremento (ciclos por muestra).
+    float getPhase() const;
+    float getIncrement() const;
+
+    // EN: Fixed-point access, for generators that run their own loop over the phase.
+    // ES: Acceso en punto fijo, para generadores que recorren la fase con su propio bucle.
+    uint32_t getFixedPhase() const;
+    uint32_t getFixedIncrement() const;
+    void setFixedPhase(uint32_t inPhase);
+
+    // EN: Converts cycles to fixed point, keeping the fractional part.
+    // ES: Convierte ciclos a punto fijo, conservando la parte fraccionaria.
+    static uint32_t toFixed(double cycles);
+
+    // EN: Converts a fixed-point phase to cycles in [0, 1).
+    // ES: Convierte una fase en punto fijo a ciclos en [0, 1).
+    static float toCycles(uint32_t fixedPhase);
+
+    // EN: sin(2 pi cycles) for cycles in [0, 1), with an error below 1e-6.
+    // ES: sin(2 pi cycles) para cycles en [0, 1), con un error por debajo de 1e-6.
+    static float sine(float cycles);
+
+    static constexpr double cycleLength = 4294967296.0;
+
+private:
+    double sampleRate{ 44100.0 };
+    double frequency{ 0.0 };
+
+    uint32_t phase{ 0 };
+    uint32_t increment{ 0 };
+};
@@ -12,76 +12,114 @@
 
 // EN: Sets the frequency of the sawtooth wave.
 // ES: Establece la frecuencia de la onda diente de sierra.
-void SawtoothWave::setFrequency(double inFrequency)
+template <typename SampleType>
+void SawtoothWave_T<SampleType>::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+
+    for (auto& acc : accumulator)
+        acc.setFrequency(frequency);
+}
+
+// EN: Moves the phase of one channel by the change of its offset, so the offset can change while it plays.
+// ES: Mueve la fase de un canal según el cambio de su desfase, así el desfase puede cambiar mientras suena.
+template <typename SampleType>
+void SawtoothWave_T<SampleType>::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+    const uint32_t offset = PhaseAccumulator::toFixed(inPhaseOffset);
+
+    accumulator[index].setFixedPhase(accumulator[index].getFixedPhase() + offset - phaseOffset[index]);
+    phaseOffset[index] = offset;
 }
 
 // EN: Prepares the generator by setting the sample rate and initializing phase variables.
 // ES: Prepara el generador configurando la frecuencia de muestreo e inicializando las variables de fase.
-void SawtoothWave::prepare(double theSampleRate)
+template <typename SampleType>
+void SawtoothWave_T<SampleType>::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate);
 
-    // EN: Initialize the time and deltaTime arrays for both channels.
-    // ES: Inicializa los arreglos de tiempo y deltaTime para ambos canales.
-    for (int i = 0; i < 2; i++)
+    // EN: Restart the fixed-point phase of both channels at their offsets; it wraps by itself, so it never jumps or drifts.
+    // ES: Reinicia la fase en punto fijo de ambos canales en sus desfases; se ajusta sola, así nunca salta ni se desvía.
+    for (int channel = 0; channel < 2; channel++)
     {
-        time[i] = 0.0f;
-        deltaTime[i] = 1.0f / sampleRate;
+        accumulator[channel].prepare(theSampleRate);
+        accumulator[channel].setFixedPhase(phaseOffset[channel]);
     }
 }
 
 // EN: Generates a sawtooth wave and writes the samples to the audio buffer.
 // ES: Genera una onda diente de sierra y escribe las muestras en el b�fer de audio.
-void SawtoothWave::process(juce::AudioBuffer<float>& buffer)
+template <typename SampleType>
+void SawtoothWave_T<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
     // EN: Loop through each channel in the buffer.
     // ES: Recorre cada canal en el b�fer.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // EN: The second channel only needs its own pass when its phase offset differs from the first one.
+    // ES: El segundo canal solo necesita su propia pasada cuando su desfase es distinto del primero.
+    const bool spread = numChannels > 1 && phaseOffset[1] != phaseOffset[0];
+    const int numRendered = spread ? 2 : juce::jmin(numChannels, 1);
+
+    for (int channel = 0; channel < numRendered; channel++)
     {
+        // EN: The fixed-point phase is advanced here and stored back, so the double version reads all its bits.
+        // ES: La fase en punto fijo se avanza aquí y se guarda de vuelta, así la versión double lee todos sus bits.
+        uint32_t phase = accumulator[channel].getFixedPhase();
+        const uint32_t increment = accumulator[channel].getFixedIncrement();
+        SampleType* output = buffer.getWritePointer(channel);
+
         // EN: Loop through each sample in the current channel.
         // ES: Recorre cada muestra en el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        for (int i = 0; i < numSamples; i++)
         {
-            float outSample = 0.0f;
-
-            // EN: Calculate the duration of a full wave period.
-            // ES: Calcula la duraci�n de un per�odo completo de la onda.
-            float fullPeriodTime = 1.0f / frequency;
-
-            // EN: Find the current time position within the wave period.
-            // ES: Encuentra la posici�n de tiempo actual dentro del per�odo de la onda.
-            float localTime = fmod(time[channel], fullPeriodTime);
+            // EN: Phase of the sample within the period (0 to 1), normalized to the range [-1, 1].
+            // ES: Fase de la muestra dentro del período (0 a 1), normalizada al rango [-1, 1].
+            output[i] = toCycles(phase) * static_cast<SampleType>(2.0) - static_cast<SampleType>(1.0);
+            phase += increment;
+        }
 
-            // EN: Generate the sawtooth wave value normalized to the range [-1, 1].
-            // ES: Genera el valor de la onda diente de sierra normalizado al rango [-1, 1].
-            outSample = (localTime / fullPeriodTime) * 2.0f - 1.0f;
+        accumulator[channel].setFixedPhase(phase);
+    }
 
-            // EN: Write the generated sample to the audio buffer.
-            // ES: Escribe la muestra generada en el b�fer de audio.
-            buffer.setSample(channel, i, outSample);
+    // EN: A channel that was not rendered follows the phase of the first one and the remaining channels are copies.
+    // ES: Un canal que no se generó sigue la fase del primero y los canales restantes son copias.
+    if (!spread)
+        accumulator[1].setFixedPhase(accumulator[0].getFixedPhase());
 
-            // EN: Increment the phase time for the channel.
-            // ES: Incrementa el tiempo de fase para el canal.
-            time[channel] += deltaTime[channel];
+    for (int channel = numRendered; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+}
 
-            // EN: Reset the time to 0 if it exceeds 1 (one full second).
-            // ES: Reinicia el tiempo a 0 si excede 1 (un segundo completo).
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
-        }
-    }
+// EN: double divides the whole 32-bit phase by the cycle length (exact), float reuses the 24-bit conversion.
+// ES: double divide la fase completa de 32 bits por la longitud del ciclo (exacto), float reutiliza la conversión de 24 bits.
+template <typename SampleType>
+SampleType SawtoothWave_T<SampleType>::toCycles(uint32_t fixedPhase)
+{
+    if constexpr (std::is_same_v<SampleType, double>)
+        return static_cast<double>(fixedPhase) / PhaseAccumulator::cycleLength;
+    else
+        return PhaseAccumulator::toCycles(fixedPhase);
 }
 
 // EN: Constructor for the SawtoothWave class. No specific initialization needed.
 // ES: Constructor de la clase SawtoothWave. No se necesita inicializaci�n espec�fica.
-SawtoothWave::SawtoothWave()
+template <typename SampleType>
+SawtoothWave_T<SampleType>::SawtoothWave_T()
 {
 }
 
 // EN: Destructor for the SawtoothWave class. No specific cleanup needed.
 // ES: Destructor de la clase SawtoothWave. No se necesita limpieza espec�fica.
-SawtoothWave::~SawtoothWave()
+template <typename SampleType>
+SawtoothWave_T<SampleType>::~SawtoothWave_T()
 {
-}
\ No newline at end of file
+}
+
+// EN: The two sample types the generator is built for.
+// ES: Los dos tipos de muestra para los que se compila el generador.
+template class SawtoothWave_T<float>;
+template class SawtoothWave_T<double>;
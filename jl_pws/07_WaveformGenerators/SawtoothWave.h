@@ -11,30 +11,47 @@
 #pragma once
 //#include <JuceHeader.h>
 
-class SawtoothWave
+// EN: Sawtooth wave generator driven by a fixed-point phase accumulator per channel.
+//     SampleType is float or double; PrecisionBenchmark.h explains when to use double.
+// ES: Generador de onda diente de sierra movido por un acumulador de fase en punto fijo por canal.
+//     SampleType es float o double; PrecisionBenchmark.h explica cuándo usar double.
+template <typename SampleType>
+class SawtoothWave_T
 {
 public:
     // EN: Sets the frequency of the sawtooth wave.
     // ES: Establece la frecuencia de la onda diente de sierra.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Prepares the wave generator by setting the sample rate.
     // ES: Prepara el generador de ondas configurando la frecuencia de muestreo.
     void prepare(double theSampleRate);
 
     // EN: Generates the sawtooth wave and processes the audio buffer.
     // ES: Genera la onda diente de sierra y procesa el b�fer de audio.
-    void process(juce::AudioBuffer<float>& buffer);
+    void process(juce::AudioBuffer<SampleType>& buffer);
 
     // EN: Constructor for the SawtoothWave class.
     // ES: Constructor de la clase SawtoothWave.
-    SawtoothWave();
+    SawtoothWave_T();
 
     // EN: Destructor for the SawtoothWave class.
     // ES: Destructor de la clase SawtoothWave.
-    ~SawtoothWave();
+    ~SawtoothWave_T();
 
 private:
+    // EN: Converts a fixed-point phase to cycles in [0, 1). double keeps all 32 bits, float keeps the 24 bits of
+    //     PhaseAccumulator::toCycles so the value never rounds up to 1.
+    // ES: Convierte una fase en punto fijo a ciclos en [0, 1). double conserva los 32 bits, float conserva los 24 bits
+    //     de PhaseAccumulator::toCycles para que el valor nunca se redondee a 1.
+    static SampleType toCycles(uint32_t fixedPhase);
+
     // EN: The frequency of the sawtooth wave.
     // ES: La frecuencia de la onda diente de sierra.
     float frequency{ 100.0f };
@@ -43,11 +60,15 @@ private:
     // ES: La frecuencia de muestreo para el procesamiento de audio.
     float sampleRate{ 44100 };
 
-    // EN: Keeps track of the phase (time) for each channel.
-    // ES: Lleva un registro de la fase (tiempo) para cada canal.
-    float time[2]{};
+    // EN: Fixed-point phase accumulator for each channel.
+    // ES: Acumulador de fase en punto fijo para cada canal.
+    PhaseAccumulator accumulator[2];
 
-    // EN: The increment in phase per sample for each channel.
-    // ES: El incremento en la fase por muestra para cada canal.
-    float deltaTime[2]{};
+    // EN: Fixed-point phase offset of each channel.
+    // ES: Desfase en punto fijo de cada canal.
+    uint32_t phaseOffset[2]{};
 };
+
+// EN: The float version keeps the original name; SawtoothWave_T<double> is the double version.
+// ES: La versión float conserva el nombre original; SawtoothWave_T<double> es la versión double.
+using SawtoothWave = SawtoothWave_T<float>;
@@ -10,20 +10,21 @@
 
 //#include "SawtoothWave2.h"
 
-// EN: Sets the frequency of the sawtooth wave and calculates the phase increment based on the sample rate.
-// ES: Establece la frecuencia de la onda diente de sierra y calcula el incremento de fase basado en la frecuencia de muestreo.
+// EN: Sets the frequency of the sawtooth wave on the oscillators, which calculate the phase increment.
+// ES: Establece la frecuencia de la onda diente de sierra en los osciladores, que calculan el incremento de fase.
 void SawtoothWave2::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
 
-    // EN: Ensure the sample rate is valid before calculating the phase increment.
-    // ES: Asegura que la frecuencia de muestreo sea v�lida antes de calcular el incremento de fase.
-    if (sampleRate > 0.0f)
-    {
-        // EN: Calculate phase increment: the fraction of the wave to advance per sample.
-        // ES: Calcula el incremento de fase: la fracci�n de la onda que avanza por muestra.
-        phaseIncrement = 1.0f / (sampleRate / frequency);
-    }
+    for (auto& osc : oscillator)
+        osc.setFrequency(frequency);
+}
+
+// EN: Sets the phase offset of one channel.
+// ES: Establece el desfase de un canal.
+void SawtoothWave2::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    oscillator[juce::jlimit(0, 1, channel)].setPhaseOffset(inPhaseOffset);
 }
 
 // EN: Prepares the generator by setting the sample rate.
@@ -31,42 +32,33 @@ void SawtoothWave2::setFrequency(double inFrequency)
 void SawtoothWave2::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate);
+
+    for (auto& osc : oscillator)
+        osc.prepare(theSampleRate);
 }
 
-// EN: Processes the audio buffer by generating a sawtooth wave for each sample and channel.
-// ES: Procesa el b�fer de audio generando una onda diente de sierra para cada muestra y canal.
-void SawtoothWave2::process(juce::AudioBuffer<float>& buffer)
+// EN: Processes the audio buffer by generating a band-limited sawtooth wave, rendered once and copied to the channels with the same phase offset.
+// ES: Procesa el búfer de audio generando una onda diente de sierra de banda limitada, generada una vez y copiada a los canales con el mismo desfase.
+void SawtoothWave2::process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer, const float* syncBuffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // EN: Loop through channels. | ES: Iterar a trav�s de los canales.
-    {
-        for (int i = 0; i < buffer.getNumSamples(); i++) // EN: Loop through samples. | ES: Iterar a trav�s de las muestras.
-        {
-            float outSample = 0.0f;
-
-            // EN: Generate the sawtooth waveform by scaling the phase value to [-1.0, 1.0].
-            // ES: Genera la onda diente de sierra escalando el valor de fase a [-1.0, 1.0].
-            outSample = 2.0f * phase[channel] - 1.0f;
-
-            // EN: Write the generated sample into the buffer.
-            // ES: Escribe la muestra generada en el b�fer.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Increment the phase for the current channel.
-            // ES: Incrementa la fase para el canal actual.
-            phase[channel] += phaseIncrement;
+    // EN: The oscillator writes the whole block, with PolyBLEP correcting the step at the end of each cycle.
+    // ES: El oscilador escribe el bloque completo, con PolyBLEP corrigiendo el salto al final de cada ciclo.
+    BandLimitedOscillator::processChannels(oscillator, buffer, frequencyBuffer, nullptr, phaseModBuffer, syncBuffer);
+}
 
-            // EN: Wrap the phase back to 0.0 if it exceeds 1.0 (cyclic behavior).
-            // ES: Reinicia la fase a 0.0 si excede 1.0 (comportamiento c�clico).
-            if (phase[channel] >= 1.0f)
-                phase[channel] = 0.0f;
-        }
-    }
+// EN: Processes the audio buffer with the fixed frequency.
+// ES: Procesa el buffer de audio con la frecuencia fija.
+void SawtoothWave2::process(juce::AudioBuffer<float>& buffer)
+{
+    process(buffer, nullptr);
 }
 
-// EN: Constructor for the SawtoothWave2 class (no additional setup required here).
-// ES: Constructor de la clase SawtoothWave2 (no requiere configuraci�n adicional aqu�).
+// EN: Constructor for the SawtoothWave2 class (selects the waveform of the oscillators).
+// ES: Constructor de la clase SawtoothWave2 (selecciona la forma de onda de los osciladores).
 SawtoothWave2::SawtoothWave2()
 {
+    for (auto& osc : oscillator)
+        osc.setWaveform(BandLimitedOscillator::Waveform::Sawtooth);
 }
 
 // EN: Destructor for the SawtoothWave2 class (no cleanup required here).
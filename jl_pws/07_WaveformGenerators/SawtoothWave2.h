@@ -18,6 +18,12 @@ public:
     // ES: Establece la frecuencia de la onda diente de sierra.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Prepares the generator by setting the sample rate and initializing variables.
     // ES: Prepara el generador configurando la frecuencia de muestreo e inicializando las variables.
     void prepare(double theSampleRate);
@@ -26,6 +32,14 @@ public:
     // ES: Procesa el b�fer de audio generando una onda diente de sierra.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Processes the audio buffer with per-sample modulation. The buffers are optional (nullptr), shared by the
+    //     channels and hold one value per sample: frequencyBuffer in Hz, phaseModBuffer in cycles and syncBuffer
+    //     with the hard sync reset positions (see BandLimitedOscillator::process).
+    // ES: Procesa el buffer de audio con modulación por muestra. Los buffers son opcionales (nullptr), compartidos
+    //     por los canales y tienen un valor por muestra: frequencyBuffer en Hz, phaseModBuffer en ciclos y
+    //     syncBuffer con las posiciones de reinicio del sync duro (ver BandLimitedOscillator::process).
+    void process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer = nullptr, const float* syncBuffer = nullptr);
+
     // EN: Constructor for the SawtoothWave2 class.
     // ES: Constructor de la clase SawtoothWave2.
     SawtoothWave2();
@@ -43,11 +57,7 @@ private:
     // ES: Frecuencia de muestreo del audio (en Hz).
     float sampleRate{ 44100 };
 
-    // EN: Amount to increment the phase on each sample (calculated based on frequency and sample rate).
-    // ES: Cantidad para incrementar la fase en cada muestra (calculada en base a la frecuencia y la frecuencia de muestreo).
-    float phaseIncrement{};
-
-    // EN: Array to store the phase value for each channel.
-    // ES: Arreglo para almacenar el valor de fase para cada canal.
-    float phase[2]{};
+    // EN: Band-limited (PolyBLEP) oscillator for each channel.
+    // ES: Oscilador de banda limitada (PolyBLEP) para cada canal.
+    BandLimitedOscillator oscillator[2];
 };
\ No newline at end of file
@@ -14,14 +14,30 @@
 // ES: Establece la frecuencia de la onda seno en Hz.
 void SineWave::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+
+    for (auto& osc : oscillator)
+        osc.setFrequency(frequency); // EN: The oscillator computes the phase increment. | ES: El oscilador calcula el incremento de fase.
+}
+
+// EN: Sets the phase offset of one channel, added to the initial phase.
+// ES: Establece el desfase de un canal, sumado a la fase inicial.
+void SineWave::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+
+    phaseOffset[index] = inPhaseOffset;
+    oscillator[index].setPhaseOffset(phi / twoPi + phaseOffset[index]);
 }
 
 // EN: Sets the initial phase of the sine wave.
 // ES: Establece la fase inicial de la onda seno.
 void SineWave::setPhase(double setPhase)
 {
-    phi = setPhase;
+    phi = static_cast<float>(setPhase);
+
+    for (int channel = 0; channel < 2; channel++)
+        oscillator[channel].setPhaseOffset(phi / twoPi + phaseOffset[channel]); // EN: Radians to cycles. | ES: Radianes a ciclos.
 }
 
 // EN: Prepares the sine wave generator with the specified sample rate.
@@ -30,47 +46,35 @@ void SineWave::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate); // EN: Set the sample rate. | ES: Configura la tasa de muestreo.
 
-    // EN: Initialize time and deltaTime for each channel.
-    // ES: Inicializa time y deltaTime para cada canal.
-    for (int i = 0; i < 2; i++)
+    // EN: Restart the phase of each channel; the oscillator keeps it in cycles, so it never drifts or jumps.
+    // ES: Reinicia la fase de cada canal; el oscilador la guarda en ciclos, así nunca se desvía ni salta.
+    for (auto& osc : oscillator)
     {
-        time[i] = 0.0f;               // EN: Reset the time for the channel. | ES: Reinicia el tiempo para el canal.
-        deltaTime[i] = 1.0f / sampleRate; // EN: Compute the phase increment per sample. | ES: Calcula el incremento de fase por muestra.
+        osc.prepare(theSampleRate);
+        osc.reset();
     }
 }
 
-// EN: Processes the buffer to generate the sine wave signal.
-// ES: Procesa el buffer para generar la se�al de onda seno.
-void SineWave::process(juce::AudioBuffer<float>& buffer)
+// EN: Processes the buffer to generate the sine wave signal, rendered once and copied to the channels with the same phase offset.
+// ES: Procesa el buffer para generar la señal de onda seno, generada una vez y copiada a los canales con el mismo desfase.
+void SineWave::process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer, const float* syncBuffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // EN: Loop through each channel. | ES: Recorre cada canal.
-    {
-        for (int i = 0; i < buffer.getNumSamples(); i++) // EN: Loop through each sample. | ES: Recorre cada muestra.
-        {
-            // EN: Generate the sine wave sample with frequency, time, and phase.
-            // ES: Genera la muestra de onda seno con frecuencia, tiempo y fase.
-            float outSample = sinf(twoPi * frequency * time[channel] + phi);
-
-            // EN: Set the generated sample into the buffer.
-            // ES: Coloca la muestra generada en el buffer.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Increment the time for the current channel.
-            // ES: Incrementa el tiempo para el canal actual.
-            time[channel] += deltaTime[channel];
+    BandLimitedOscillator::processChannels(oscillator, buffer, frequencyBuffer, nullptr, phaseModBuffer, syncBuffer);
+}
 
-            // EN: Wrap the time value to avoid overflow.
-            // ES: Ajusta el valor de tiempo para evitar desbordamientos.
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
-        }
-    }
+// EN: Processes the buffer with the fixed frequency.
+// ES: Procesa el buffer con la frecuencia fija.
+void SineWave::process(juce::AudioBuffer<float>& buffer)
+{
+    process(buffer, nullptr);
 }
 
 // EN: Constructor for the SineWave class. Initializes default values.
 // ES: Constructor de la clase SineWave. Inicializa valores por defecto.
 SineWave::SineWave()
 {
+    for (auto& osc : oscillator)
+        osc.setWaveform(BandLimitedOscillator::Waveform::Sine);
 }
 
 // EN: Destructor for the SineWave class. Releases any allocated resources (if any).
@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda seno en Hz.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Sets the initial phase of the sine wave.
     // ES: Establece la fase inicial de la onda seno.
     void setPhase(double setPhase);
@@ -32,6 +38,14 @@ public:
     // ES: Procesa el buffer de audio, generando la se�al de onda seno.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Processes the audio buffer with per-sample modulation. The buffers are optional (nullptr), shared by the
+    //     channels and hold one value per sample: frequencyBuffer in Hz, phaseModBuffer in cycles and syncBuffer
+    //     with the hard sync reset positions (see BandLimitedOscillator::process).
+    // ES: Procesa el buffer de audio con modulación por muestra. Los buffers son opcionales (nullptr), compartidos
+    //     por los canales y tienen un valor por muestra: frequencyBuffer en Hz, phaseModBuffer en ciclos y
+    //     syncBuffer con las posiciones de reinicio del sync duro (ver BandLimitedOscillator::process).
+    void process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer = nullptr, const float* syncBuffer = nullptr);
+
     // EN: Constructor for the SineWave class.
     // ES: Constructor de la clase SineWave.
     SineWave();
@@ -43,8 +57,8 @@ public:
 private:
     float sampleRate{ 44100.0f };         // EN: Sample rate in Hz. | ES: Tasa de muestreo en Hz.
     float twoPi{ juce::MathConstants<float>::twoPi }; // EN: Constant for 2PI. | ES: Constante para 2PI.
-    float time[2]{};                     // EN: Array to store the current time for each channel. | ES: Arreglo para almacenar el tiempo actual de cada canal.
-    float deltaTime[2]{};                 // EN: Array to store the phase increment per sample for each channel. | ES: Arreglo para almacenar el incremento de fase por muestra de cada canal.
     float frequency{ 0.0f };              // EN: Frequency of the sine wave in Hz. | ES: Frecuencia de la onda seno en Hz.
     float phi{ 0.0f };                    // EN: Phase offset of the sine wave. | ES: Desfase de la onda seno.
+    float phaseOffset[2]{};               // EN: Phase offset of each channel in cycles. | ES: Desfase de cada canal en ciclos.
+    BandLimitedOscillator oscillator[2];  // EN: The sine oscillator for each channel. | ES: El oscilador seno de cada canal.
 };
\ No newline at end of file
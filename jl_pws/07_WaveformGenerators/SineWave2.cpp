@@ -10,71 +10,69 @@
 
 //#include "SineWave2.h"
 
-// EN: Sets the frequency of the sine wave and updates the phase increment based on the current sample rate.
-// ES: Establece la frecuencia de la onda seno y actualiza el incremento de fase basado en la tasa de muestreo actual.
+// EN: Sets the frequency of the sine wave; the oscillators update their phase increment based on the current sample rate.
+// ES: Establece la frecuencia de la onda seno; los osciladores actualizan su incremento de fase basado en la tasa de muestreo actual.
 void SineWave2::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
-    // EN: Calculate the phase increment using the formula: 2π * frequency / sampleRate.
-    // ES: Calcula el incremento de fase usando la fórmula: 2π * frecuencia / tasa de muestreo.
-    phaseIncrement = twoPi * frequency / sampleRate;
+    frequency = static_cast<float>(inFrequency);
+
+    for (auto& osc : oscillator)
+        osc.setFrequency(frequency);
 }
 
-// EN: Sets the initial phase offset of the sine wave.
-// ES: Establece el desplazamiento de fase inicial de la onda seno.
+// EN: Sets the phase offset of one channel, added to the initial phase.
+// ES: Establece el desfase de un canal, sumado a la fase inicial.
+void SineWave2::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+
+    phaseOffset[index] = inPhaseOffset;
+    oscillator[index].setPhaseOffset(phi / twoPi + phaseOffset[index]);
+}
+
+// EN: Sets the initial phase offset of the sine wave (in radians, converted to cycles for the oscillators).
+// ES: Establece el desplazamiento de fase inicial de la onda seno (en radianes, convertido a ciclos para los osciladores).
 void SineWave2::setPhase(double setPhase)
 {
-    phi = setPhase;
+    phi = static_cast<float>(setPhase);
+
+    for (int channel = 0; channel < 2; channel++)
+        oscillator[channel].setPhaseOffset(phi / twoPi + phaseOffset[channel]);
 }
 
-// EN: Prepares the sine wave generator with a given sample rate.
-// ES: Prepara el generador de onda seno con una tasa de muestreo dada.
+// EN: Prepares the sine wave generator with a given sample rate and restarts the phase of each channel at 0.
+// ES: Prepara el generador de onda seno con una tasa de muestreo dada y reinicia la fase de cada canal en 0.
 void SineWave2::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate);
 
-    // EN: Initialize the phase for each channel to 0.
-    // ES: Inicializa la fase para cada canal en 0.
-    for (int i = 0; i < 2; i++)
+    for (auto& osc : oscillator)
     {
-        phase[i] = 0.0f;
+        osc.prepare(theSampleRate);
+        osc.reset();
     }
 }
 
-// EN: Processes the audio buffer, generating a sine wave for each sample in each channel.
-// ES: Procesa el buffer de audio, generando una onda seno para cada muestra en cada canal.
-void SineWave2::process(juce::AudioBuffer<float>& buffer)
+// EN: Processes the audio buffer, generating a whole block of the sine wave once and copying it to the channels with the same phase offset.
+// ES: Procesa el buffer de audio, generando un bloque completo de la onda seno una vez y copiándolo a los canales con el mismo desfase.
+void SineWave2::process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer, const float* syncBuffer)
 {
-    // EN: Loop through all the channels in the buffer.
-    // ES: Itera a través de todos los canales del buffer.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
-    {
-        // EN: Loop through all the samples in the current channel.
-        // ES: Itera a través de todas las muestras del canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            // EN: Calculate the sine wave value using the current phase and phase offset (phi).
-            // ES: Calcula el valor de la onda seno usando la fase actual y el desplazamiento de fase (phi).
-            float outSample = sinf(phase[channel] + phi);
-
-            // EN: Write the sine wave value to the buffer at the current sample index.
-            // ES: Escribe el valor de la onda seno en el buffer en el índice de muestra actual.
-            buffer.setSample(channel, i, outSample);
-
-            // EN: Update the phase for the channel and wrap it to stay within [0, 2π].
-            // ES: Actualiza la fase del canal y la ajusta para mantenerse dentro del rango [0, 2π].
-            phase[channel] += phaseIncrement;
+    BandLimitedOscillator::processChannels(oscillator, buffer, frequencyBuffer, nullptr, phaseModBuffer, syncBuffer);
+}
 
-            if (phase[channel] >= twoPi)
-                phase[channel] -= twoPi; // EN: Wrap phase to avoid overflow. | ES: Ajusta la fase para evitar desbordamientos.
-        }
-    }
+// EN: Processes the audio buffer with the fixed frequency.
+// ES: Procesa el buffer de audio con la frecuencia fija.
+void SineWave2::process(juce::AudioBuffer<float>& buffer)
+{
+    process(buffer, nullptr);
 }
 
 // EN: Constructor for the SineWave2 class.
 // ES: Constructor de la clase SineWave2.
 SineWave2::SineWave2()
 {
+    for (auto& osc : oscillator)
+        osc.setWaveform(BandLimitedOscillator::Waveform::Sine);
 }
 
 // EN: Destructor for the SineWave2 class.
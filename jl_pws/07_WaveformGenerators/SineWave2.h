@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda seno en Hz.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Sets the initial phase of the sine wave.
     // ES: Establece la fase inicial de la onda seno.
     void setPhase(double setPhase);
@@ -32,6 +38,14 @@ public:
     // ES: Procesa un buffer de audio para generar la se�al de onda seno.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Processes the audio buffer with per-sample modulation. The buffers are optional (nullptr), shared by the
+    //     channels and hold one value per sample: frequencyBuffer in Hz, phaseModBuffer in cycles and syncBuffer
+    //     with the hard sync reset positions (see BandLimitedOscillator::process).
+    // ES: Procesa el buffer de audio con modulación por muestra. Los buffers son opcionales (nullptr), compartidos
+    //     por los canales y tienen un valor por muestra: frequencyBuffer en Hz, phaseModBuffer en ciclos y
+    //     syncBuffer con las posiciones de reinicio del sync duro (ver BandLimitedOscillator::process).
+    void process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer = nullptr, const float* syncBuffer = nullptr);
+
     // EN: Constructor for the SineWave2 class. Initializes default values.
     // ES: Constructor de la clase SineWave2. Inicializa valores por defecto.
     SineWave2();
@@ -45,6 +59,6 @@ private:
     float twoPi{ juce::MathConstants<float>::twoPi }; // EN: The constant value 2PI. | ES: El valor constante 2PI.
     float frequency{ 0.0f };             // EN: The frequency of the sine wave in Hz. | ES: La frecuencia de la onda seno en Hz.
     float phi{ 0.0f };                   // EN: The initial phase of the sine wave. | ES: La fase inicial de la onda seno.
-    float phaseIncrement{};              // EN: The phase increment per sample, based on the frequency. | ES: El incremento de fase por muestra, basado en la frecuencia.
-    float phase[2]{};                    // EN: The current phase for each channel (stereo support). | ES: La fase actual para cada canal (soporte est�reo).
+    float phaseOffset[2]{};              // EN: Phase offset of each channel in cycles. | ES: Desfase de cada canal en ciclos.
+    BandLimitedOscillator oscillator[2]; // EN: The sine oscillator for each channel (stereo support). | ES: El oscilador seno para cada canal (soporte estéreo).
 };
\ No newline at end of file
@@ -14,7 +14,21 @@
 // ES: Establece la frecuencia de la onda cuadrada.
 void SquareWave::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+
+    for (auto& acc : accumulator)
+        acc.setFrequency(frequency);
+}
+
+// EN: Moves the phase of one channel by the change of its offset, so the offset can change while it plays.
+// ES: Mueve la fase de un canal según el cambio de su desfase, así el desfase puede cambiar mientras suena.
+void SquareWave::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+    const uint32_t offset = PhaseAccumulator::toFixed(inPhaseOffset);
+
+    accumulator[index].setFixedPhase(accumulator[index].getFixedPhase() + offset - phaseOffset[index]);
+    phaseOffset[index] = offset;
 }
 
 // EN: Prepares the square wave generator by initializing the sample rate and time parameters.
@@ -23,12 +37,12 @@ void SquareWave::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate);
 
-    // EN: Initialize the time and deltaTime for each channel.
-    // ES: Inicializa los valores de tiempo y deltaTime para cada canal.
-    for (int i = 0; i < 2; i++)
+    // EN: Restart the fixed-point phase of both channels at their offsets; it wraps by itself, so it never jumps or drifts.
+    // ES: Reinicia la fase en punto fijo de ambos canales en sus desfases; se ajusta sola, así nunca salta ni se desvía.
+    for (int channel = 0; channel < 2; channel++)
     {
-        time[i] = 0.0f;
-        deltaTime[i] = 1.0f / sampleRate;
+        accumulator[channel].prepare(theSampleRate);
+        accumulator[channel].setFixedPhase(phaseOffset[channel]);
     }
 }
 
@@ -36,24 +50,27 @@ void SquareWave::prepare(double theSampleRate)
 // ES: Procesa el buffer de audio y lo llena con una se�al de onda cuadrada.
 void SquareWave::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // EN: The second channel only needs its own pass when its phase offset differs from the first one.
+    // ES: El segundo canal solo necesita su propia pasada cuando su desfase es distinto del primero.
+    const bool spread = numChannels > 1 && phaseOffset[1] != phaseOffset[0];
+    const int numRendered = spread ? 2 : juce::jmin(numChannels, 1);
+
+    for (int channel = 0; channel < numRendered; channel++)
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        for (int i = 0; i < numSamples; i++)
         {
-            // EN: Calculate the total period and half period of the square wave.
-            // ES: Calcula el per�odo total y el medio per�odo de la onda cuadrada.
-            float fullPeriodTime = 1.0f / frequency;       // EN: Duration of one full period. | ES: Duraci�n de un per�odo completo.
-            float halfPeriodTime = fullPeriodTime / 2.0f;  // EN: Duration of half the period. | ES: Duraci�n de medio per�odo.
-
-            // EN: Calculate the current time position within the current period.
-            // ES: Calcula la posici�n de tiempo actual dentro del per�odo actual.
-            float localTime = fmod(time[channel], fullPeriodTime);
+            // EN: Phase of the sample within the period (0 to 1); the accumulator advances it.
+            // ES: Fase de la muestra dentro del período (0 a 1); el acumulador la avanza.
+            const float value = accumulator[channel].getNextPhase();
 
             float outSample = 0.0f;
 
             // EN: Determine the output sample value based on the current time in the period.
             // ES: Determina el valor de la muestra de salida basado en el tiempo actual en el per�odo.
-            if (localTime < halfPeriodTime)
+            if (value < 0.5f)
                 outSample = 1.0f;  // EN: Positive part of the square wave. | ES: Parte positiva de la onda cuadrada.
             else
                 outSample = 0.0f;  // EN: Negative part of the square wave. | ES: Parte negativa de la onda cuadrada.
@@ -61,17 +78,16 @@ void SquareWave::process(juce::AudioBuffer<float>& buffer)
             // EN: Write the output sample to the buffer.
             // ES: Escribe la muestra de salida en el buffer.
             buffer.setSample(channel, i, outSample);
-
-            // EN: Increment the time for the current channel.
-            // ES: Incrementa el tiempo para el canal actual.
-            time[channel] += deltaTime[channel];
-
-            // EN: Reset the time if it exceeds 1.0 to keep it within a valid range.
-            // ES: Reinicia el tiempo si excede 1.0 para mantenerlo dentro de un rango v�lido.
-            if (time[channel] >= 1.0f)
-                time[channel] = 0.0f;
         }
     }
+
+    // EN: A channel that was not rendered follows the phase of the first one and the remaining channels are copies.
+    // ES: Un canal que no se generó sigue la fase del primero y los canales restantes son copias.
+    if (!spread)
+        accumulator[1].setFixedPhase(accumulator[0].getFixedPhase());
+
+    for (int channel = numRendered; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
 }
 
 // EN: Constructor for the SquareWave class.
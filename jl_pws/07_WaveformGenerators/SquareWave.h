@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda cuadrada.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Prepares the square wave generator by setting the sample rate.
     // ES: Prepara el generador de onda cuadrada configurando la tasa de muestreo.
     void prepare(double theSampleRate);
@@ -39,6 +45,6 @@ public:
 private:
     float frequency{ 0.0f };         // EN: Frequency of the square wave. | ES: Frecuencia de la onda cuadrada.
     float sampleRate{ 44100 };       // EN: Sample rate for the audio processing. | ES: Tasa de muestreo para el procesamiento de audio.
-    float time[2]{};                 // EN: Keeps track of the current time position for each channel. | ES: Mantiene la posici�n de tiempo actual para cada canal.
-    float deltaTime[2]{};            // EN: Change in time for each sample, based on the frequency. | ES: Cambio en el tiempo por muestra, basado en la frecuencia.
+    PhaseAccumulator accumulator[2]; // EN: Fixed-point phase for each channel. | ES: Fase en punto fijo para cada canal.
+    uint32_t phaseOffset[2]{};       // EN: Fixed-point phase offset of each channel. | ES: Desfase en punto fijo de cada canal.
 };
\ No newline at end of file
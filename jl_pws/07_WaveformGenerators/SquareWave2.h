@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda cuadrada.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Prepares the generator by setting the sample rate.
     // ES: Prepara el generador configurando la tasa de muestreo.
     void prepare(double theSampleRate);
@@ -28,6 +34,14 @@ public:
     // ES: Procesa un buffer de audio y lo llena con una se�al de onda cuadrada.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Processes the audio buffer with per-sample modulation. The buffers are optional (nullptr), shared by the
+    //     channels and hold one value per sample: frequencyBuffer in Hz, phaseModBuffer in cycles and syncBuffer
+    //     with the hard sync reset positions (see BandLimitedOscillator::process).
+    // ES: Procesa el buffer de audio con modulación por muestra. Los buffers son opcionales (nullptr), compartidos
+    //     por los canales y tienen un valor por muestra: frequencyBuffer en Hz, phaseModBuffer en ciclos y
+    //     syncBuffer con las posiciones de reinicio del sync duro (ver BandLimitedOscillator::process).
+    void process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer = nullptr, const float* syncBuffer = nullptr);
+
     // EN: Constructor for the SquareWave2 class.
     // ES: Constructor de la clase SquareWave2.
     SquareWave2();
@@ -45,11 +59,7 @@ private:
     // ES: Tasa de muestreo del audio en Hz.
     float sampleRate{ 44100 };
 
-    // EN: Phase increment for each sample, based on frequency and sample rate.
-    // ES: Incremento de fase para cada muestra, basado en la frecuencia y la tasa de muestreo.
-    float phaseIncrement{};
-
-    // EN: Phase value for each channel (up to stereo).
-    // ES: Valor de fase para cada canal (hasta est�reo).
-    float phase[2]{};
+    // EN: Band-limited (PolyBLEP) oscillator for each channel (up to stereo).
+    // ES: Oscilador de banda limitada (PolyBLEP) para cada canal (hasta estéreo).
+    BandLimitedOscillator oscillator[2];
 };
\ No newline at end of file
@@ -14,19 +14,35 @@
 // ES: Establece la frecuencia de la onda triangular.
 void TriangleWave::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
+
+    for (auto& acc : accumulator)
+        acc.setFrequency(frequency);
+}
+
+// EN: Moves the phase of one channel by the change of its offset, so the offset can change while it plays.
+// ES: Mueve la fase de un canal según el cambio de su desfase, así el desfase puede cambiar mientras suena.
+void TriangleWave::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    const int index = juce::jlimit(0, 1, channel);
+    const uint32_t offset = PhaseAccumulator::toFixed(inPhaseOffset);
+
+    accumulator[index].setFixedPhase(accumulator[index].getFixedPhase() + offset - phaseOffset[index]);
+    phaseOffset[index] = offset;
 }
 
-// EN: Prepares the triangle wave generator by setting the sample rate and initializing time and deltaTime arrays for each channel.
-// ES: Prepara el generador de onda triangular configurando la tasa de muestreo e inicializando los arreglos time y deltaTime para cada canal.
+// EN: Prepares the triangle wave generator by setting the sample rate and restarting the phase of each channel.
+// ES: Prepara el generador de onda triangular configurando la tasa de muestreo y reiniciando la fase de cada canal.
 void TriangleWave::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate); // EN: Set the sample rate. | ES: Configura la tasa de muestreo.
 
-    for (int i = 0; i < 2; i++) // EN: Initialize time and deltaTime for stereo channels. | ES: Inicializa time y deltaTime para los canales est�reo.
+    // EN: Restart the fixed-point phase of both channels at their offsets; it wraps by itself, so it never jumps or drifts.
+    // ES: Reinicia la fase en punto fijo de ambos canales en sus desfases; se ajusta sola, así nunca salta ni se desvía.
+    for (int channel = 0; channel < 2; channel++)
     {
-        time[i] = 0.0f;               // EN: Reset the time accumulator. | ES: Reinicia el acumulador de tiempo.
-        deltaTime[i] = 1.0f / sampleRate; // EN: Calculate the time increment per sample. | ES: Calcula el incremento de tiempo por muestra.
+        accumulator[channel].prepare(theSampleRate);
+        accumulator[channel].setFixedPhase(phaseOffset[channel]);
     }
 }
 
@@ -34,16 +50,22 @@ void TriangleWave::prepare(double theSampleRate)
 // ES: Procesa el buffer de audio para generar una onda triangular para cada muestra.
 void TriangleWave::process(juce::AudioBuffer<float>& buffer)
 {
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++) // EN: Iterate over channels. | ES: Itera sobre los canales.
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // EN: The second channel only needs its own pass when its phase offset differs from the first one.
+    // ES: El segundo canal solo necesita su propia pasada cuando su desfase es distinto del primero.
+    const bool spread = numChannels > 1 && phaseOffset[1] != phaseOffset[0];
+    const int numRendered = spread ? 2 : juce::jmin(numChannels, 1);
+
+    for (int channel = 0; channel < numRendered; channel++) // EN: Iterate over channels. | ES: Itera sobre los canales.
     {
-        for (int i = 0; i < buffer.getNumSamples(); i++) // EN: Iterate over samples. | ES: Itera sobre las muestras.
+        for (int i = 0; i < numSamples; i++) // EN: Iterate over samples. | ES: Itera sobre las muestras.
         {
             float res = 0.0f; // EN: Placeholder (unused). | ES: Variable auxiliar (no utilizada).
-            float fullPeriodTime = 1.0f / frequency; // EN: Calculate the period of the triangle wave. | ES: Calcula el per�odo de la onda triangular.
-            float localTime = fmod(time[channel], fullPeriodTime); // EN: Wrap time to the period of the wave. | ES: Ajusta el tiempo al per�odo de la onda.
             float outSample = 0.0f; // EN: Output sample value. | ES: Valor de la muestra de salida.
 
-            float value = localTime / fullPeriodTime; // EN: Normalize local time to a range [0, 1]. | ES: Normaliza el tiempo local al rango [0, 1].
+            const float value = accumulator[channel].getNextPhase(); // EN: Phase within the period [0, 1), advanced by the accumulator. | ES: Fase dentro del período [0, 1), avanzada por el acumulador.
 
             // EN: Generate the triangle wave based on the normalized value.
             // ES: Genera la onda triangular en funci�n del valor normalizado.
@@ -61,13 +83,16 @@ void TriangleWave::process(juce::AudioBuffer<float>& buffer)
             }
 
             buffer.setSample(channel, i, outSample); // EN: Write the sample to the buffer. | ES: Escribe la muestra en el buffer.
-
-            time[channel] += deltaTime[channel]; // EN: Increment time for the current channel. | ES: Incrementa el tiempo para el canal actual.
-
-            if (time[channel] >= 1.0f) // EN: Reset time if it exceeds 1 second. | ES: Reinicia el tiempo si excede 1 segundo.
-                time[channel] = 0.0f;
         }
     }
+
+    // EN: A channel that was not rendered follows the phase of the first one and the remaining channels are copies.
+    // ES: Un canal que no se generó sigue la fase del primero y los canales restantes son copias.
+    if (!spread)
+        accumulator[1].setFixedPhase(accumulator[0].getFixedPhase());
+
+    for (int channel = numRendered; channel < numChannels; channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
 }
 
 // EN: Constructor initializes the TriangleWave object.
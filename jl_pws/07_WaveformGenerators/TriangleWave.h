@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda triangular.
     void setFrequency(double inFrequecy);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Prepares the triangle wave generator by setting the sample rate.
     // ES: Prepara el generador de onda triangular configurando la tasa de muestreo.
     void prepare(double theSampleRate);
@@ -45,11 +51,11 @@ private:
     // ES: Tasa de muestreo del sistema de audio (por defecto es 44,100 Hz).
     float sampleRate{ 44100 };
 
-    // EN: Current time position for each channel, used to track the phase of the triangle wave.
-    // ES: Posici�n de tiempo actual para cada canal, utilizada para rastrear la fase de la onda triangular.
-    float time[2]{};
+    // EN: Fixed-point phase accumulator for each channel, which tracks the phase of the triangle wave.
+    // ES: Acumulador de fase en punto fijo para cada canal, que rastrea la fase de la onda triangular.
+    PhaseAccumulator accumulator[2];
 
-    // EN: Increment of time for each sample, calculated based on frequency and sample rate.
-    // ES: Incremento de tiempo para cada muestra, calculado en funci�n de la frecuencia y la tasa de muestreo.
-    float deltaTime[2]{};
+    // EN: Fixed-point phase offset of each channel.
+    // ES: Desfase en punto fijo de cada canal.
+    uint32_t phaseOffset[2]{};
 };
\ No newline at end of file
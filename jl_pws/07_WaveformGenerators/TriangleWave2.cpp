@@ -14,14 +14,17 @@
 // ES: Establece la frecuencia de la onda triangular y calcula el incremento de fase basado en la tasa de muestreo.
 void TriangleWave2::setFrequency(double inFrequency)
 {
-    frequency = inFrequency;
+    frequency = static_cast<float>(inFrequency);
 
-    // EN: Ensure sampleRate is valid before calculating the phase increment.
-    // ES: Asegurarse de que sampleRate sea v�lido antes de calcular el incremento de fase.
-    if (sampleRate > 0.0f)
-    {
-        phaseIncrement = frequency / sampleRate; // EN: Determines the step size per sample. ES: Determina el tama�o del paso por muestra.
-    }
+    for (auto& osc : oscillator)
+        osc.setFrequency(frequency); // EN: The oscillator determines the step size per sample. ES: El oscilador determina el tamaño del paso por muestra.
+}
+
+// EN: Sets the phase offset of one channel.
+// ES: Establece el desfase de un canal.
+void TriangleWave2::setPhaseOffset(int channel, float inPhaseOffset)
+{
+    oscillator[juce::jlimit(0, 1, channel)].setPhaseOffset(inPhaseOffset);
 }
 
 // EN: Sets the width (duty cycle) of the triangle wave. This value controls the balance between the rising and falling edges of the wave.
@@ -29,6 +32,9 @@ void TriangleWave2::setFrequency(double inFrequency)
 void TriangleWave2::setWidth(float inWidth)
 {
     width = inWidth;
+
+    for (auto& osc : oscillator)
+        osc.setPulseWidth(width); // EN: The peak of the triangle. ES: El pico del triángulo.
 }
 
 // EN: Prepares the wave generator by setting the sample rate.
@@ -36,54 +42,33 @@ void TriangleWave2::setWidth(float inWidth)
 void TriangleWave2::prepare(double theSampleRate)
 {
     sampleRate = static_cast<float>(theSampleRate); // EN: Store the sample rate for further calculations. ES: Almacena la tasa de muestreo para c�lculos posteriores.
+
+    for (auto& osc : oscillator)
+        osc.prepare(theSampleRate);
 }
 
-// EN: Processes the audio buffer and generates a triangle wave with the specified frequency and width.
-// ES: Procesa el buffer de audio y genera una onda triangular con la frecuencia y el ancho especificados.
-void TriangleWave2::process(juce::AudioBuffer<float>& buffer)
+// EN: Processes the audio buffer and generates a band-limited triangle wave with the specified frequency and width.
+// ES: Procesa el buffer de audio y genera una onda triangular de banda limitada con la frecuencia y el ancho especificados.
+void TriangleWave2::process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer, const float* syncBuffer)
 {
-    // EN: Loop through each audio channel.
-    // ES: Recorre cada canal de audio.
-    for (int channel = 0; channel < buffer.getNumChannels(); channel++)
-    {
-        // EN: Loop through each sample in the buffer.
-        // ES: Recorre cada muestra en el buffer.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            float outSample = 0.0f;
-
-            // EN: Generate the triangle wave with adjustable width.
-            // ES: Generar la onda triangular con un ancho ajustable.
-            if (phase[channel] < width)
-            {
-                // EN: First half of the wave (rising edge).
-                // ES: Primera mitad de la onda (borde ascendente).
-                outSample = (phase[channel] / width) * 2.0f - 1.0f;
-            }
-            else
-            {
-                // EN: Second half of the wave (falling edge).
-                // ES: Segunda mitad de la onda (borde descendente).
-                outSample = ((phase[channel] - width) / (1.0f - width)) * -2.0f + 1.0f;
-            }
-
-            // EN: Store the calculated sample value in the buffer.
-            // ES: Almacena el valor de muestra calculado en el buffer.
-            buffer.setSample(channel, i, outSample);
+    // EN: Generate the whole block: the wave rises until the width and falls after it, and PolyBLAMP smooths both corners.
+    // ES: Genera el bloque completo: la onda sube hasta el ancho y baja después, y PolyBLAMP suaviza ambas esquinas.
+    BandLimitedOscillator::processChannels(oscillator, buffer, frequencyBuffer, nullptr, phaseModBuffer, syncBuffer);
+}
 
-            // EN: Update the phase and wrap it within the range [0, 1).
-            // ES: Actualiza la fase y la mantiene dentro del rango [0, 1).
-            phase[channel] += phaseIncrement;
-            if (phase[channel] >= 1.0f)
-                phase[channel] -= 1.0f; // EN: Wrap phase back to the start. ES: Reinicia la fase al principio.
-        }
-    }
+// EN: Processes the audio buffer with the fixed frequency.
+// ES: Procesa el buffer de audio con la frecuencia fija.
+void TriangleWave2::process(juce::AudioBuffer<float>& buffer)
+{
+    process(buffer, nullptr);
 }
 
 // EN: Constructor initializes the TriangleWave2 object.
 // ES: El constructor inicializa el objeto TriangleWave2.
 TriangleWave2::TriangleWave2()
 {
+    for (auto& osc : oscillator)
+        osc.setWaveform(BandLimitedOscillator::Waveform::Triangle);
 }
 
 // EN: Destructor cleans up the TriangleWave2 object.
@@ -20,6 +20,12 @@ public:
     // ES: Establece la frecuencia de la onda triangular.
     void setFrequency(double inFrequency);
 
+    // EN: Sets the phase offset of a channel (0 or 1) in cycles, for stereo spread. Channels with the same
+    //     offset are rendered once and copied.
+    // ES: Establece el desfase de un canal (0 o 1) en ciclos, para apertura estéreo. Los canales con el mismo
+    //     desfase se generan una vez y se copian.
+    void setPhaseOffset(int channel, float inPhaseOffset);
+
     // EN: Sets the width (duty cycle) of the triangle wave.
     // ES: Establece el ancho (ciclo de trabajo) de la onda triangular.
     void setWidth(float inWidth);
@@ -32,6 +38,14 @@ public:
     // ES: Procesa el buffer de audio y lo llena con la onda triangular generada.
     void process(juce::AudioBuffer<float>& buffer);
 
+    // EN: Processes the audio buffer with per-sample modulation. The buffers are optional (nullptr), shared by the
+    //     channels and hold one value per sample: frequencyBuffer in Hz, phaseModBuffer in cycles and syncBuffer
+    //     with the hard sync reset positions (see BandLimitedOscillator::process).
+    // ES: Procesa el buffer de audio con modulación por muestra. Los buffers son opcionales (nullptr), compartidos
+    //     por los canales y tienen un valor por muestra: frequencyBuffer en Hz, phaseModBuffer en ciclos y
+    //     syncBuffer con las posiciones de reinicio del sync duro (ver BandLimitedOscillator::process).
+    void process(juce::AudioBuffer<float>& buffer, const float* frequencyBuffer, const float* phaseModBuffer = nullptr, const float* syncBuffer = nullptr);
+
     // EN: Constructor initializes the TriangleWave2 object.
     // ES: El constructor inicializa el objeto TriangleWave2.
     TriangleWave2();
@@ -49,15 +63,11 @@ private:
     // ES: La frecuencia de la onda triangular.
     float frequency{ 44100.0f };
 
-    // EN: The increment value for the phase, determined by the frequency and sample rate.
-    // ES: El valor de incremento para la fase, determinado por la frecuencia y la tasa de muestreo.
-    float phaseIncrement{};
-
     // EN: The width (duty cycle) of the triangle wave. Ranges between 0 and 1.
     // ES: El ancho (ciclo de trabajo) de la onda triangular. Oscila entre 0 y 1.
     float width{};
 
-    // EN: The phase accumulator for each channel (stereo support).
-    // ES: El acumulador de fase para cada canal (soporte est�reo).
-    float phase[2]{};
+    // EN: The band-limited (PolyBLAMP) oscillator for each channel (stereo support).
+    // ES: El oscilador de banda limitada (PolyBLAMP) para cada canal (soporte estéreo).
+    BandLimitedOscillator oscillator[2];
 };
\ No newline at end of file
@@ -0,0 +1,302 @@
+/*
+  ==============================================================================
+
+    VoicePool.h
+    Created: 19 Oct 2026 3:25:15am
+    Author:  Jhonatan López
+
+    notes: Voice and MaxVoices are fixed at compile time. Voice needs prepare(double), reset(), startNote(int, float),
+           stopNote(), isActive() and render(float*, int), which adds numSamples to the output.
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+// EN: VoicePool class owns MaxVoices preallocated voices and plays notes on them with sample-accurate timing.
+//     - noteOn/noteOff take an offset inside the next block. The events are kept sorted in a fixed array and
+//       the block is rendered in segments between them, so a note starts exactly on its sample.
+//     - The active voices are always the first numActive slots: when a voice finishes it is swapped with the
+//       last active one. Rendering walks a contiguous range of voices of one type with direct calls, no
+//       virtual functions and no checks for idle voices, and a group renderer can process the range at once.
+//     - When every voice is busy, the oldest released voice is stolen, or else the oldest voice. The voice is
+//       simply restarted with the new note.
+// ES: La clase VoicePool posee MaxVoices voces reservadas de antemano y toca notas con ellas con precisión de muestra.
+//     - noteOn/noteOff reciben un desplazamiento dentro del siguiente bloque. Los eventos se guardan ordenados en un
+//       array fijo y el bloque se genera en segmentos entre ellos, así una nota empieza exactamente en su muestra.
+//     - Las voces activas son siempre las primeras numActive posiciones: cuando una voz termina se intercambia con
+//       la última activa. La generación recorre un rango contiguo de voces de un solo tipo con llamadas directas,
+//       sin funciones virtuales ni comprobaciones de voces inactivas, y un generador de grupo puede procesar el
+//       rango de una vez.
+//     - Cuando todas las voces están ocupadas, se roba la voz liberada más antigua, o si no la voz más antigua. La
+//       voz simplemente se reinicia con la nueva nota.
+template <typename Voice, int MaxVoices>
+class VoicePool
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    VoicePool()
+    {
+        notes.fill(-1);
+    }
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~VoicePool() {}
+
+    // EN: Prepares every voice and clears the notes and the pending events.
+    // ES: Prepara cada voz y limpia las notas y los eventos pendientes.
+    void prepare(double inSampleRate)
+    {
+        for (auto& voice : voices)
+            voice.prepare(inSampleRate);
+
+        reset();
+    }
+
+    // EN: Silences every voice at once (each one is reset, so none keeps its envelope or phase) and drops the
+    //     pending events.
+    // ES: Silencia todas las voces de inmediato (cada una se reinicia, así ninguna conserva su envolvente ni su fase)
+    //     y descarta los eventos pendientes.
+    void reset()
+    {
+        for (auto& voice : voices)
+            voice.reset();
+
+        numActive = 0;
+        numEvents = 0;
+        notes.fill(-1);
+    }
+
+    // EN: Starts a note sampleOffset samples into the next block (offsets past the block move to later blocks).
+    //     A velocity of 0 is queued as a note-off, so it never takes or steals a slot.
+    // ES: Empieza una nota sampleOffset muestras dentro del siguiente bloque (los desplazamientos fuera del bloque pasan a bloques posteriores).
+    //     Una velocidad de 0 se encola como un note-off, así nunca ocupa ni roba una posición.
+    void noteOn(int note, float velocity, int sampleOffset = 0)
+    {
+        if (velocity <= 0.0f)
+        {
+            noteOff(note, sampleOffset);
+            return;
+        }
+
+        addEvent({ juce::jmax(0, sampleOffset), note, velocity, true });
+    }
+
+    // EN: Releases a note sampleOffset samples into the next block.
+    // ES: Libera una nota sampleOffset muestras dentro del siguiente bloque.
+    void noteOff(int note, int sampleOffset = 0)
+    {
+        addEvent({ juce::jmax(0, sampleOffset), note, 0.0f, false });
+    }
+
+    // EN: Writes the sum of the voices to output, calling render on each active voice.
+    // ES: Escribe la suma de las voces en output, llamando a render en cada voz activa.
+    void renderNextBlock(float* output, int numSamples)
+    {
+        renderNextBlock(output, numSamples, [](Voice* activeVoices, int count, float* destination, int length)
+        {
+            for (int v = 0; v < count; v++)
+                activeVoices[v].render(destination, length);
+        });
+    }
+
+    // EN: Writes the sum of the voices to output. renderGroup(Voice* voices, int count, float* output,
+    //     int numSamples) is called once per segment with the contiguous range of active voices.
+    // ES: Escribe la suma de las voces en output. renderGroup(Voice* voices, int count, float* output,
+    //     int numSamples) se llama una vez por segmento con el rango contiguo de voces activas.
+    template <typename GroupRenderer>
+    void renderNextBlock(float* output, int numSamples, GroupRenderer&& renderGroup)
+    {
+        juce::FloatVectorOperations::clear(output, numSamples);
+
+        int position = 0;
+        int e = 0;
+
+        while (position < numSamples)
+        {
+            while (e < numEvents && events[e].sampleOffset <= position)
+                handleEvent(events[e++]);
+
+            const int end = e < numEvents ? juce::jmin(numSamples, events[e].sampleOffset) : numSamples;
+
+            if (numActive > 0)
+            {
+                renderGroup(voices.data(), numActive, output + position, end - position);
+                removeFinishedVoices();
+            }
+
+            position = end;
+        }
+
+        // EN: Events after the block are kept for the next one.
+        // ES: Los eventos posteriores al bloque se guardan para el siguiente.
+        int remaining = 0;
+        for (; e < numEvents; e++)
+        {
+            events[remaining] = events[e];
+            events[remaining].sampleOffset -= numSamples;
+            remaining++;
+        }
+
+        numEvents = remaining;
+    }
+
+    // EN: Renders the first channel and copies it to the others.
+    // ES: Genera el primer canal y lo copia a los demás.
+    void process(juce::AudioBuffer<float>& buffer)
+    {
+        if (buffer.getNumChannels() == 0)
+            return;
+
+        const int numSamples = buffer.getNumSamples();
+        renderNextBlock(buffer.getWritePointer(0), numSamples);
+
+        for (int channel = 1; channel < buffer.getNumChannels(); channel++)
+            buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+    }
+
+    // EN: Returns the number of sounding voices.
+    // ES: Devuelve el número de voces que suenan.
+    int getNumActiveVoices() const
+    {
+        return numActive;
+    }
+
+    // EN: Returns a voice slot, to set its parameters. Slots are reordered as voices finish.
+    // ES: Devuelve una posición de voz, para establecer sus parámetros. Las posiciones se reordenan cuando las voces terminan.
+    Voice& getVoice(int index)
+    {
+        return voices[static_cast<size_t>(index)];
+    }
+
+    static constexpr int maxEvents = 256;
+
+private:
+    struct Event
+    {
+        int sampleOffset;
+        int note;
+        float velocity;
+        bool isNoteOn;
+    };
+
+    // EN: Inserts the event after the ones with the same or an earlier offset. Drops it if the queue is full.
+    // ES: Inserta el evento tras los que tienen el mismo desplazamiento o uno anterior. Lo descarta si la cola está llena.
+    void addEvent(const Event& event)
+    {
+        if (numEvents == maxEvents)
+            return;
+
+        int i = numEvents++;
+        while (i > 0 && events[i - 1].sampleOffset > event.sampleOffset)
+        {
+            events[i] = events[i - 1];
+            i--;
+        }
+
+        events[i] = event;
+    }
+
+    // EN: A note that is already held is restarted on its own voice; otherwise a free or stolen voice plays it.
+    //     A note off releases every held voice playing the note.
+    // ES: Una nota que ya está sostenida se reinicia en su propia voz; si no, la toca una voz libre o robada.
+    //     Un note off libera cada voz sostenida que toca la nota.
+    void handleEvent(const Event& event)
+    {
+        if (!event.isNoteOn)
+        {
+            for (int v = 0; v < numActive; v++)
+            {
+                if (notes[v] == event.note && !released[v])
+                {
+                    released[v] = true;
+                    voices[v].stopNote();
+                }
+            }
+            return;
+        }
+
+        int slot = -1;
+
+        for (int v = 0; v < numActive && slot < 0; v++)
+            if (notes[v] == event.note && !released[v])
+                slot = v;
+
+        if (slot < 0)
+            slot = numActive < MaxVoices ? numActive++ : findVoiceToSteal();
+
+        notes[slot] = event.note;
+        released[slot] = false;
+        startOrder[slot] = nextStartOrder++;
+        voices[slot].startNote(event.note, event.velocity);
+    }
+
+    // EN: The oldest released voice, or the oldest voice when none is released.
+    // ES: La voz liberada más antigua, o la voz más antigua cuando ninguna está liberada.
+    int findVoiceToSteal() const
+    {
+        int oldest = 0;
+        int oldestReleased = -1;
+
+        for (int v = 0; v < numActive; v++)
+        {
+            if (isOlder(v, oldest))
+                oldest = v;
+
+            if (released[v] && (oldestReleased < 0 || isOlder(v, oldestReleased)))
+                oldestReleased = v;
+        }
+
+        return oldestReleased >= 0 ? oldestReleased : oldest;
+    }
+
+    // EN: Compares start orders through their difference, so the counter can wrap around.
+    // ES: Compara los órdenes de inicio mediante su diferencia, así el contador puede dar la vuelta.
+    bool isOlder(int a, int b) const
+    {
+        return static_cast<int32_t>(startOrder[a] - startOrder[b]) < 0;
+    }
+
+    // EN: Swaps finished voices to the end of the active range.
+    // ES: Intercambia las voces terminadas al final del rango activo.
+    void removeFinishedVoices()
+    {
+        for (int v = numActive - 1; v >= 0; v--)
+        {
+            if (voices[v].isActive())
+                continue;
+
+            const int last = --numActive;
+
+            if (v != last)
+            {
+                std::swap(voices[v], voices[last]);
+                std::swap(notes[v], notes[last]);
+                std::swap(released[v], released[last]);
+                std::swap(startOrder[v], startOrder[last]);
+            }
+
+            notes[last] = -1;
+        }
+    }
+
+    std::array<Voice, MaxVoices> voices;
+
+    // EN: Note, release state and start order of each slot.
+    // ES: Nota, estado de liberación y orden de inicio de cada posición.
+    std::array<int, MaxVoices> notes{};
+    std::array<bool, MaxVoices> released{};
+    std::array<uint32_t, MaxVoices> startOrder{};
+    uint32_t nextStartOrder{ 0 };
+    int numActive{ 0 };
+
+    // EN: Pending events of the next block, sorted by offset.
+    // ES: Eventos pendientes del siguiente bloque, ordenados por desplazamiento.
+    std::array<Event, maxEvents> events{};
+    int numEvents{ 0 };
+};
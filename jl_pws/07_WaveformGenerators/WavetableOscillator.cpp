@@ -0,0 +1,281 @@
+/*
+  ==============================================================================
+
+    WavetableOscillator.cpp
+    Created: 19 Oct 2026 3:20:43am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "WavetableOscillator.h"
+
+// EN: Constructor of WavetableOscillator class. Fills the default sawtooth spectrum and full gain on every voice.
+// ES: Constructor de la clase WavetableOscillator. Llena el espectro de diente de sierra por defecto y ganancia completa en cada voz.
+WavetableOscillator::WavetableOscillator()
+{
+    harmonics.resize(maxHarmonics);
+
+    for (int h = 0; h < maxHarmonics; h++)
+        harmonics[static_cast<size_t>(h)] = 1.0f / static_cast<float>(h + 1);
+
+    gain.fill(1.0f);
+    targetGain.fill(1.0f);
+}
+
+// EN: Destructor of WavetableOscillator class.
+// ES: Destructor de la clase WavetableOscillator.
+WavetableOscillator::~WavetableOscillator()
+{
+}
+
+// EN: Allocates the levels and the FFT scratch buffer (the real-only inverse FFT works in place on 2N floats).
+// ES: Reserva los niveles y el buffer temporal de la FFT (la FFT inversa real trabaja en el mismo lugar sobre 2N floats).
+void WavetableOscillator::prepare(double inSampleRate)
+{
+    sampleRate = inSampleRate;
+
+    tables.assign(static_cast<size_t>(numLevels * levelStride), 0.0f);
+    spectrum.assign(static_cast<size_t>(2 * tableSize), 0.0f);
+
+    buildTables();
+}
+
+// EN: Keeps at most maxHarmonics amplitudes.
+// ES: Conserva como mucho maxHarmonics amplitudes.
+void WavetableOscillator::setHarmonics(const float* amplitudes, int numHarmonics)
+{
+    const int count = juce::jlimit(0, maxHarmonics, numHarmonics);
+    harmonics.assign(amplitudes, amplitudes + count);
+
+    if (!tables.empty())
+        buildTables();
+}
+
+// EN: Sets the table interpolation.
+// ES: Establece la interpolación de la tabla.
+void WavetableOscillator::setInterpolation(Interpolation inInterpolation)
+{
+    interpolation = inInterpolation;
+}
+
+// EN: Sets the number of active voices.
+// ES: Establece el número de voces activas.
+void WavetableOscillator::setNumVoices(int inNumVoices)
+{
+    numVoices = juce::jlimit(1, maxVoices, inNumVoices);
+}
+
+// EN: The increment is limited to the Nyquist frequency, where the last level is still a clean sine.
+// ES: El incremento se limita a la frecuencia de Nyquist, donde el último nivel sigue siendo un seno limpio.
+void WavetableOscillator::setVoiceFrequency(int voice, float inFrequency)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    increment[static_cast<size_t>(voice)] = juce::jlimit(0.0f, 0.5f, static_cast<float>(inFrequency / sampleRate));
+}
+
+// EN: Sets the gain the voice reaches at the end of the next block.
+// ES: Establece la ganancia que alcanza la voz al final del siguiente bloque.
+void WavetableOscillator::setVoiceGain(int voice, float inGain)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    targetGain[static_cast<size_t>(voice)] = inGain;
+}
+
+// EN: Sets the phase of a voice, wrapped to [0, 1).
+// ES: Establece la fase de una voz, ajustada a [0, 1).
+void WavetableOscillator::resetVoice(int voice, float inPhase)
+{
+    if (voice < 0 || voice >= maxVoices)
+        return;
+
+    phase[static_cast<size_t>(voice)] = inPhase - std::floor(inPhase);
+}
+
+// EN: A sine harmonic h of amplitude a is the bin X[h] = -i a N / 2 (JUCE's inverse transform divides by N).
+//     Then the guard samples are copied from the other end of each table.
+// ES: Un armónico seno h de amplitud a es el bin X[h] = -i a N / 2 (la transformada inversa de JUCE divide por N).
+//     Luego las muestras de guarda se copian del otro extremo de cada tabla.
+void WavetableOscillator::buildTables()
+{
+    juce::dsp::FFT fft(juce::roundToInt(std::log2(static_cast<double>(tableSize))));
+
+    const float binScale = 0.5f * static_cast<float>(tableSize);
+    float peak = 0.0f;
+
+    for (int level = 0; level < numLevels; level++)
+    {
+        const int highestHarmonic = juce::jmin(static_cast<int>(harmonics.size()), maxHarmonics >> level);
+
+        std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+
+        for (int h = 1; h <= highestHarmonic; h++)
+            spectrum[static_cast<size_t>(2 * h + 1)] = -binScale * harmonics[static_cast<size_t>(h - 1)];
+
+        fft.performRealOnlyInverseTransform(spectrum.data());
+
+        float* table = tables.data() + level * levelStride;
+        juce::FloatVectorOperations::copy(table + 1, spectrum.data(), tableSize);
+
+        table[0] = table[tableSize];
+        table[tableSize + 1] = table[1];
+        table[tableSize + 2] = table[2];
+
+        if (level == 0)
+            for (int n = 1; n <= tableSize; n++)
+                peak = juce::jmax(peak, std::abs(table[n]));
+    }
+
+    if (peak > 0.0f)
+        juce::FloatVectorOperations::multiply(tables.data(), 1.0f / peak, static_cast<int>(tables.size()));
+}
+
+// EN: The level position is log2(increment * tableSize): its integer part is the lower level and its fractional
+//     part the weight of the upper one. Below level 0 and above the last level a single level is used.
+// ES: La posición de nivel es log2(incremento * tableSize): su parte entera es el nivel inferior y su parte
+//     fraccionaria el peso del superior. Por debajo del nivel 0 y por encima del último se usa un solo nivel.
+void WavetableOscillator::updateVoices(int numSamples)
+{
+    const float rampScale = 1.0f / static_cast<float>(numSamples);
+
+    for (int v = 0; v < numVoices; v++)
+    {
+        const float position = increment[v] > 0.0f
+            ? juce::jlimit(0.0f, static_cast<float>(numLevels - 1), std::log2(increment[v] * static_cast<float>(tableSize)))
+            : 0.0f;
+
+        const int lower = juce::jmin(static_cast<int>(position), numLevels - 2);
+
+        lowerLevel[v] = tables.data() + lower * levelStride;
+        upperLevel[v] = tables.data() + (lower + 1) * levelStride;
+        levelMix[v] = position - static_cast<float>(lower);
+
+        gainStep[v] = (targetGain[v] - gain[v]) * rampScale;
+    }
+}
+
+// EN: Splits the block into groups of numLanes voices.
+// ES: Divide el bloque en grupos de numLanes voces.
+void WavetableOscillator::render(float* output, int numSamples)
+{
+    juce::FloatVectorOperations::clear(output, numSamples);
+
+    if (tables.empty() || numSamples <= 0)
+        return;
+
+    updateVoices(numSamples);
+
+    for (int firstVoice = 0; firstVoice < numVoices; firstVoice += numLanes)
+    {
+        const int lanes = juce::jmin(numLanes, numVoices - firstVoice);
+
+        if (interpolation == Interpolation::Cubic)
+            renderCubic(output, numSamples, firstVoice, lanes);
+        else
+            renderLinear(output, numSamples, firstVoice, lanes);
+    }
+
+    // EN: The ramps end exactly on the targets.
+    // ES: Las rampas terminan exactamente en los objetivos.
+    for (int v = 0; v < numVoices; v++)
+        gain[v] = targetGain[v];
+}
+
+// EN: Table index i + 1 holds sample i, so a read at position pos uses table[i + 1] and table[i + 2].
+// ES: El índice de tabla i + 1 guarda la muestra i, así una lectura en la posición pos usa table[i + 1] y table[i + 2].
+void WavetableOscillator::renderLinear(float* output, int numSamples, int firstVoice, int lanes)
+{
+    float* p = phase.data() + firstVoice;
+    const float* dt = increment.data() + firstVoice;
+    float* g = gain.data() + firstVoice;
+    const float* gStep = gainStep.data() + firstVoice;
+    const float* mix = levelMix.data() + firstVoice;
+    const float* const* lowerTable = lowerLevel.data() + firstVoice;
+    const float* const* upperTable = upperLevel.data() + firstVoice;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        float sum = 0.0f;
+
+        for (int l = 0; l < lanes; l++)
+        {
+            const float pos = p[l] * static_cast<float>(tableSize);
+            const int index = static_cast<int>(pos) + 1;
+            const float frac = pos - static_cast<float>(index - 1);
+
+            const float a = lowerTable[l][index] + frac * (lowerTable[l][index + 1] - lowerTable[l][index]);
+            const float b = upperTable[l][index] + frac * (upperTable[l][index + 1] - upperTable[l][index]);
+
+            sum += g[l] * (a + mix[l] * (b - a));
+
+            p[l] += dt[l];
+            p[l] -= p[l] >= 1.0f ? 1.0f : 0.0f;
+            g[l] += gStep[l];
+        }
+
+        output[i] += sum;
+    }
+}
+
+// EN: Catmull-Rom through table[i] .. table[i + 3] (samples i - 1 .. i + 2).
+// ES: Catmull-Rom a través de table[i] .. table[i + 3] (muestras i - 1 .. i + 2).
+void WavetableOscillator::renderCubic(float* output, int numSamples, int firstVoice, int lanes)
+{
+    float* p = phase.data() + firstVoice;
+    const float* dt = increment.data() + firstVoice;
+    float* g = gain.data() + firstVoice;
+    const float* gStep = gainStep.data() + firstVoice;
+    const float* mix = levelMix.data() + firstVoice;
+    const float* const* lowerTable = lowerLevel.data() + firstVoice;
+    const float* const* upperTable = upperLevel.data() + firstVoice;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        float sum = 0.0f;
+
+        for (int l = 0; l < lanes; l++)
+        {
+            const float pos = p[l] * static_cast<float>(tableSize);
+            const int index = static_cast<int>(pos);
+            const float frac = pos - static_cast<float>(index);
+
+            float levelOutput[2];
+            const float* levelTables[2] = { lowerTable[l] + index, upperTable[l] + index };
+
+            for (int k = 0; k < 2; k++)
+            {
+                const float* x = levelTables[k];
+                const float c1 = 0.5f * (x[2] - x[0]);
+                const float c2 = x[0] - 2.5f * x[1] + 2.0f * x[2] - 0.5f * x[3];
+                const float c3 = 0.5f * (x[3] - x[0]) + 1.5f * (x[1] - x[2]);
+                levelOutput[k] = ((c3 * frac + c2) * frac + c1) * frac + x[1];
+            }
+
+            sum += g[l] * (levelOutput[0] + mix[l] * (levelOutput[1] - levelOutput[0]));
+
+            p[l] += dt[l];
+            p[l] -= p[l] >= 1.0f ? 1.0f : 0.0f;
+            g[l] += gStep[l];
+        }
+
+        output[i] += sum;
+    }
+}
+
+// EN: Renders channel 0 and copies it to the other channels.
+// ES: Genera el canal 0 y lo copia a los demás canales.
+void WavetableOscillator::process(juce::AudioBuffer<float>& buffer)
+{
+    if (buffer.getNumChannels() == 0)
+        return;
+
+    const int numSamples = buffer.getNumSamples();
+    render(buffer.getWritePointer(0), numSamples);
+
+    for (int channel = 1; channel < buffer.getNumChannels(); channel++)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+}
@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    WavetableOscillator.h
+    Created: 19 Oct 2026 3:20:43am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: WavetableOscillator is a bank of voices that read one harmonic spectrum from band-limited wavetables, so a
+//     timbre with hundreds of partials costs a few table reads per sample instead of one sinf per partial.
+//     - The spectrum (the amplitude of each harmonic) is turned into numLevels mipmapped tables, one per octave,
+//       with an inverse FFT. Level k keeps the harmonics up to (tableSize / 4) >> k, so it never aliases while
+//       the phase increment is below 2^(k + 1) / tableSize.
+//     - Each voice picks its level from its frequency once per block, log2(increment * tableSize), and
+//       crossfades between that level and the next one by the fractional part, so sweeps have no steps.
+//     - Reads are linear or 4-point cubic (Catmull-Rom). The tables keep one guard sample before and two after,
+//       so reads never wrap.
+//     - The voices are rendered in groups of numLanes: per sample, the lanes of a group are read and summed in
+//       one loop over arrays, like the comb lanes of SchroederReverb.
+// ES: WavetableOscillator es un banco de voces que leen un espectro armónico de tablas de onda de banda limitada,
+//     así un timbre con cientos de parciales cuesta unas pocas lecturas de tabla por muestra en vez de un sinf por
+//     parcial.
+//     - El espectro (la amplitud de cada armónico) se convierte en numLevels tablas mipmap, una por octava, con una
+//       FFT inversa. El nivel k conserva los armónicos hasta (tableSize / 4) >> k, así nunca produce aliasing
+//       mientras el incremento de fase esté por debajo de 2^(k + 1) / tableSize.
+//     - Cada voz elige su nivel según su frecuencia una vez por bloque, log2(incremento * tableSize), y mezcla
+//       entre ese nivel y el siguiente según la parte fraccionaria, así los barridos no tienen saltos.
+//     - Las lecturas son lineales o cúbicas de 4 puntos (Catmull-Rom). Las tablas guardan una muestra de guarda
+//       antes y dos después, así las lecturas nunca dan la vuelta.
+//     - Las voces se generan en grupos de numLanes: por muestra, los carriles de un grupo se leen y suman en un
+//       bucle sobre arrays, como los carriles de peines de SchroederReverb.
+class WavetableOscillator
+{
+public:
+    enum class Interpolation
+    {
+        Linear,
+        Cubic
+    };
+
+    // EN: Constructor. The default spectrum is a sawtooth (1 / h) with every harmonic the tables can hold.
+    // ES: Constructor. El espectro por defecto es un diente de sierra (1 / h) con todos los armónicos que caben en las tablas.
+    WavetableOscillator();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~WavetableOscillator();
+
+    // EN: Sets the sample rate, allocates the tables and builds them from the current spectrum.
+    // ES: Establece la frecuencia de muestreo, reserva las tablas y las construye a partir del espectro actual.
+    void prepare(double inSampleRate);
+
+    // EN: Sets the amplitude of each harmonic (amplitudes[0] is the fundamental) and rebuilds the tables if the
+    //     oscillator is prepared. Call it outside the audio thread.
+    // ES: Establece la amplitud de cada armónico (amplitudes[0] es la fundamental) y reconstruye las tablas si el
+    //     oscilador está preparado. Debe llamarse fuera del hilo de audio.
+    void setHarmonics(const float* amplitudes, int numHarmonics);
+
+    // EN: Sets the table interpolation.
+    // ES: Establece la interpolación de la tabla.
+    void setInterpolation(Interpolation inInterpolation);
+
+    // EN: Sets the number of active voices (1 to maxVoices).
+    // ES: Establece el número de voces activas (1 a maxVoices).
+    void setNumVoices(int inNumVoices);
+
+    // EN: Sets the frequency of a voice in Hz.
+    // ES: Establece la frecuencia de una voz en Hz.
+    void setVoiceFrequency(int voice, float inFrequency);
+
+    // EN: Sets the gain of a voice. Gain changes are ramped over the next block.
+    // ES: Establece la ganancia de una voz. Los cambios de ganancia se hacen en rampa durante el siguiente bloque.
+    void setVoiceGain(int voice, float inGain);
+
+    // EN: Sets the phase of a voice (0 to 1).
+    // ES: Establece la fase de una voz (0 a 1).
+    void resetVoice(int voice, float inPhase = 0.0f);
+
+    // EN: Writes the sum of the active voices to output.
+    // ES: Escribe la suma de las voces activas en output.
+    void render(float* output, int numSamples);
+
+    // EN: Renders the first channel and copies it to the others.
+    // ES: Genera el primer canal y lo copia a los demás.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    static constexpr int tableSize = 4096;
+    static constexpr int numLevels = 11;
+    static constexpr int maxHarmonics = tableSize / 4;
+    static constexpr int maxVoices = 64;
+    static constexpr int numLanes = 8;
+
+private:
+    // EN: Builds every level from the spectrum with an inverse FFT and scales them all by the same factor, so
+    //     the fullest level peaks at 1.
+    // ES: Construye cada nivel a partir del espectro con una FFT inversa y los escala a todos por el mismo factor,
+    //     así el nivel más completo tiene un pico de 1.
+    void buildTables();
+
+    // EN: Picks the two levels, the crossfade and the gain ramp of each active voice for a block of numSamples.
+    // ES: Elige los dos niveles, la mezcla y la rampa de ganancia de cada voz activa para un bloque de numSamples.
+    void updateVoices(int numSamples);
+
+    // EN: Adds the lanes [firstVoice, firstVoice + lanes) to output with linear or cubic reads.
+    // ES: Suma los carriles [firstVoice, firstVoice + lanes) a output con lecturas lineales o cúbicas.
+    void renderLinear(float* output, int numSamples, int firstVoice, int lanes);
+    void renderCubic(float* output, int numSamples, int firstVoice, int lanes);
+
+    // EN: Samples stored per level: the table plus one guard sample before and two after.
+    // ES: Muestras guardadas por nivel: la tabla más una muestra de guarda antes y dos después.
+    static constexpr int levelStride = tableSize + 3;
+
+    double sampleRate{ 44100.0 };
+    Interpolation interpolation{ Interpolation::Linear };
+    int numVoices{ 1 };
+
+    // EN: Harmonic amplitudes, the levels one after the other, and the FFT scratch buffer.
+    // ES: Amplitudes de los armónicos, los niveles uno tras otro y el buffer temporal de la FFT.
+    std::vector<float> harmonics;
+    std::vector<float> tables;
+    std::vector<float> spectrum;
+
+    // EN: Voice state, stored lane by lane.
+    // ES: Estado de las voces, guardado carril por carril.
+    std::array<float, maxVoices> phase{};
+    std::array<float, maxVoices> increment{};
+    std::array<float, maxVoices> gain{};
+    std::array<float, maxVoices> targetGain{};
+    std::array<float, maxVoices> gainStep{};
+    std::array<float, maxVoices> levelMix{};
+    std::array<const float*, maxVoices> lowerLevel{};
+    std::array<const float*, maxVoices> upperLevel{};
+};
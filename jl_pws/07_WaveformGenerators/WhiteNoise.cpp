@@ -15,35 +15,222 @@
 void WhiteNoise::prepare(double theSampleRate)
 {
     sampleRate = theSampleRate;
+    updateBrownCoefficient();
+    updateVelvetSegment();
+    reset();
 }
 
-// EN: Fills the audio buffer with white noise samples.
-// ES: Llena el buffer de audio con muestras de ruido blanco.
+// EN: Fills each channel with its own stream and advances the counter. White and velvet noise have no state, so
+//     they fill every channel; pink and brown keep state for maxChannels channels and clear the ones past it.
+// ES: Llena cada canal con su propia secuencia y avanza el contador. Los ruidos blanco y velvet no tienen estado,
+//     así llenan todos los canales; rosa y marrón guardan estado para maxChannels canales y limpian los siguientes.
 void WhiteNoise::process(juce::AudioBuffer<float>& buffer)
 {
-    // EN: Loop through each channel in the audio buffer.
-    // ES: Iterar a trav�s de cada canal en el buffer de audio.
+    const int numSamples = buffer.getNumSamples();
+    const bool stateful = noiseType == NoiseType::Pink || noiseType == NoiseType::Brown;
+
     for (int channel = 0; channel < buffer.getNumChannels(); channel++)
     {
-        // EN: Loop through each sample in the current channel.
-        // ES: Iterar a trav�s de cada muestra en el canal actual.
-        for (int i = 0; i < buffer.getNumSamples(); i++)
+        if (!stateful || channel < maxChannels)
+            render(buffer.getWritePointer(channel), numSamples, channel);
+        else
+            buffer.clear(channel, 0, numSamples);
+    }
+
+    counter += static_cast<uint32_t>(numSamples);
+}
+
+// EN: Sets the noise type.
+// ES: Establece el tipo de ruido.
+void WhiteNoise::setNoiseType(NoiseType inNoiseType)
+{
+    noiseType = inNoiseType;
+}
+
+// EN: Sets the seed and restarts the streams.
+// ES: Establece la semilla y reinicia las secuencias.
+void WhiteNoise::setSeed(uint32_t inSeed)
+{
+    seed = inSeed;
+    reset();
+}
+
+// EN: The pink rows start at zero, so pink noise fades in over the first 2^numPinkRows samples.
+// ES: Las filas rosas empiezan en cero, así el ruido rosa entra durante las primeras 2^numPinkRows muestras.
+void WhiteNoise::reset()
+{
+    counter = 0;
+
+    for (auto& rows : pinkRows)
+        rows.fill(0.0f);
+
+    pinkSum.fill(0.0f);
+    brownState.fill(0.0f);
+}
+
+// EN: Sets the velvet density in pulses per second.
+// ES: Establece la densidad velvet en pulsos por segundo.
+void WhiteNoise::setVelvetDensity(float inDensity)
+{
+    velvetDensity = juce::jmax(1.0f, inDensity);
+    updateVelvetSegment();
+}
+
+// EN: Renders one channel of the selected noise type.
+// ES: Genera un canal del tipo de ruido seleccionado.
+void WhiteNoise::render(float* output, int numSamples, int channel)
+{
+    jassert(channel < maxChannels || noiseType == NoiseType::White || noiseType == NoiseType::Velvet);
+
+    switch (noiseType)
+    {
+        case NoiseType::White:  renderWhite(output, numSamples, getKey(channel, 1)); break;
+        case NoiseType::Pink:   renderPink(output, numSamples, channel); break;
+        case NoiseType::Brown:  renderBrown(output, numSamples, channel); break;
+        case NoiseType::Velvet: renderVelvet(output, numSamples, channel); break;
+    }
+}
+
+// EN: lowbias32 integer hash.
+// ES: Hash entero lowbias32.
+uint32_t WhiteNoise::hash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// EN: The arithmetic shift keeps the sign, so the result is exact in float.
+// ES: El desplazamiento aritmético conserva el signo, así el resultado es exacto en float.
+float WhiteNoise::toBipolar(uint32_t x)
+{
+    return static_cast<float>(static_cast<int32_t>(x) >> 8) * (1.0f / 8388608.0f);
+}
+
+// EN: Different streams start from different hashed seeds; channels are offset within each.
+// ES: Las distintas secuencias empiezan desde semillas con hash distintas; los canales se desplazan dentro de cada una.
+uint32_t WhiteNoise::getKey(int channel, uint32_t stream) const
+{
+    return hash(hash(seed ^ (stream * 0x9e3779b9u)) + static_cast<uint32_t>(channel));
+}
+
+// EN: sample n = hash(hash(n) ^ key). The first hash spreads the counter and the key keeps the channels apart;
+//     every iteration is independent, so the compiler vectorizes the loop.
+// ES: muestra n = hash(hash(n) ^ key). El primer hash dispersa el contador y la clave separa los canales;
+//     cada iteración es independiente, así el compilador vectoriza el bucle.
+void WhiteNoise::renderWhite(float* output, int numSamples, uint32_t key) const
+{
+    const uint32_t start = counter;
+
+    for (int i = 0; i < numSamples; i++)
+        output[i] = toBipolar(hash(hash(start + static_cast<uint32_t>(i)) ^ key));
+}
+
+// EN: The white samples are rendered first (vectorized); then the row picked by the trailing zeros of the counter
+//     is replaced and the running sum updated. The result is scaled by 1 / (numPinkRows + 1) so it stays in [-1, 1].
+// ES: Primero se generan las muestras blancas (vectorizado); luego se reemplaza la fila que eligen los ceros finales
+//     del contador y se actualiza la suma acumulada. El resultado se escala por 1 / (numPinkRows + 1) para quedar en [-1, 1].
+void WhiteNoise::renderPink(float* output, int numSamples, int channel)
+{
+    renderWhite(output, numSamples, getKey(channel, 1));
+
+    const uint32_t rowKey = getKey(channel, 2);
+    const float scale = 1.0f / static_cast<float>(numPinkRows + 1);
+    auto& rows = pinkRows[static_cast<size_t>(channel)];
+    float sum = pinkSum[static_cast<size_t>(channel)];
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        const uint32_t n = counter + static_cast<uint32_t>(i);
+
+        if ((n & ((1u << numPinkRows) - 1u)) != 0)
         {
-            // EN: Generate a random value between -1.0f and 1.0f.
-            // ES: Generar un valor aleatorio entre -1.0f y 1.0f.
-            float outSample = randomGenerator.nextFloat() * 2.0f - 1.0f;
+            size_t row = 0;
+            while (((n >> row) & 1u) == 0)
+                row++;
 
-            // EN: Assign the generated value to the buffer.
-            // ES: Asignar el valor generado al buffer.
-            buffer.setSample(channel, i, outSample);
+            const float value = toBipolar(hash(hash(n) ^ rowKey));
+            sum += value - rows[row];
+            rows[row] = value;
         }
+
+        output[i] = (output[i] + sum) * scale;
+    }
+
+    pinkSum[static_cast<size_t>(channel)] = sum;
+}
+
+// EN: y = a y + (1 - a) white, scaled to the same RMS as the pink noise.
+// ES: y = a y + (1 - a) blanco, escalado al mismo RMS que el ruido rosa.
+void WhiteNoise::renderBrown(float* output, int numSamples, int channel)
+{
+    renderWhite(output, numSamples, getKey(channel, 1));
+
+    float state = brownState[static_cast<size_t>(channel)];
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        state = brownCoefficient * state + (1.0f - brownCoefficient) * output[i];
+        output[i] = state * brownGain;
     }
+
+    brownState[static_cast<size_t>(channel)] = state;
+}
+
+// EN: Segment m covers samples [m L, (m + 1) L). Its pulse position and sign come from hash(hash(m) ^ key), so
+//     only the segments that overlap the block are visited.
+// ES: El segmento m cubre las muestras [m L, (m + 1) L). La posición y el signo de su pulso salen de
+//     hash(hash(m) ^ key), así solo se visitan los segmentos que se solapan con el bloque.
+void WhiteNoise::renderVelvet(float* output, int numSamples, int channel) const
+{
+    juce::FloatVectorOperations::clear(output, numSamples);
+
+    if (numSamples <= 0)
+        return;
+
+    const uint32_t key = getKey(channel, 3);
+    const uint64_t segment = static_cast<uint64_t>(velvetSegment);
+    const uint64_t start = counter;
+    const uint64_t end = start + static_cast<uint64_t>(numSamples);
+
+    for (uint64_t m = start / segment; m * segment < end; m++)
+    {
+        const uint32_t h = hash(hash(static_cast<uint32_t>(m)) ^ key);
+        const uint64_t position = m * segment + ((static_cast<uint64_t>(h) * segment) >> 32);
+
+        if (position >= start && position < end)
+            output[position - start] = (h & 1u) != 0 ? 1.0f : -1.0f;
+    }
+}
+
+// EN: One-pole coefficient for brownCornerFrequency, and the gain that matches the pink RMS,
+//     sqrt((1 + a) / (1 - a)) / sqrt(numPinkRows + 1).
+// ES: Coeficiente de un polo para brownCornerFrequency, y la ganancia que iguala el RMS rosa,
+//     sqrt((1 + a) / (1 - a)) / sqrt(numPinkRows + 1).
+void WhiteNoise::updateBrownCoefficient()
+{
+    const double a = std::exp(-juce::MathConstants<double>::twoPi * brownCornerFrequency / sampleRate);
+
+    brownCoefficient = static_cast<float>(a);
+    brownGain = static_cast<float>(std::sqrt((1.0 + a) / (1.0 - a) / (numPinkRows + 1)));
+}
+
+// EN: The segment length is rounded to whole samples.
+// ES: La longitud del segmento se redondea a muestras enteras.
+void WhiteNoise::updateVelvetSegment()
+{
+    velvetSegment = juce::jmax(1, juce::roundToInt(sampleRate / velvetDensity));
 }
 
 // EN: Constructor. Initializes the WhiteNoise object.
 // ES: Constructor. Inicializa el objeto WhiteNoise.
 WhiteNoise::WhiteNoise()
 {
+    updateBrownCoefficient();
+    updateVelvetSegment();
 }
 
 // EN: Destructor. Cleans up the WhiteNoise object.
@@ -10,9 +10,29 @@
 
 #pragma once
 //#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
 
 // EN: The WhiteNoise class generates white noise audio signals.
+//     - Every sample is a hash of a sample counter and a per-channel key (two rounds of the lowbias32 integer
+//       hash), so samples do not depend on each other: the loop that fills a channel has no carried state and
+//       vectorizes, producing 8 to 16 values per step. Each channel has its own stream and the same seed always
+//       gives the same output. The counter repeats after 2^32 samples (about 24 hours at 48 kHz).
+//     - Pink noise is Voss-McCartney: numPinkRows random rows, row k refreshed every 2^(k+1) samples (the
+//       trailing zeros of the counter pick the row), summed with the white sample.
+//     - Brown noise is white noise through a leaky integrator with its corner at brownCornerFrequency.
+//     - Velvet noise places one pulse of +1 or -1 at a random position in each segment of sampleRate / density
+//       samples and is zero elsewhere, so it only computes one hash per pulse.
 // ES: La clase WhiteNoise genera se�ales de ruido blanco.
+//     - Cada muestra es un hash de un contador de muestras y una clave por canal (dos rondas del hash entero
+//       lowbias32), así las muestras no dependen unas de otras: el bucle que llena un canal no arrastra estado y se
+//       vectoriza, produciendo de 8 a 16 valores por paso. Cada canal tiene su propia secuencia y la misma semilla
+//       siempre da la misma salida. El contador se repite tras 2^32 muestras (unas 24 horas a 48 kHz).
+//     - El ruido rosa es Voss-McCartney: numPinkRows filas aleatorias, la fila k se renueva cada 2^(k+1) muestras
+//       (los ceros finales del contador eligen la fila), sumadas con la muestra blanca.
+//     - El ruido marrón es ruido blanco a través de un integrador con fugas con su esquina en brownCornerFrequency.
+//     - El ruido velvet coloca un pulso de +1 o -1 en una posición aleatoria de cada segmento de
+//       sampleRate / densidad muestras y es cero en el resto, así solo calcula un hash por pulso.
 
 class WhiteNoise
 {
@@ -33,12 +53,83 @@ public:
     // ES: Procesa el buffer de audio llen�ndolo con ruido blanco.
     void process(juce::AudioBuffer<float>& buffer);
 
+    enum class NoiseType
+    {
+        White,
+        Pink,
+        Brown,
+        Velvet
+    };
+
+    // EN: Sets the noise type.
+    // ES: Establece el tipo de ruido.
+    void setNoiseType(NoiseType inNoiseType);
+
+    // EN: Sets the seed and restarts the streams, so the same seed gives the same output.
+    // ES: Establece la semilla y reinicia las secuencias, así la misma semilla da la misma salida.
+    void setSeed(uint32_t inSeed);
+
+    // EN: Restarts the streams and clears the pink and brown state.
+    // ES: Reinicia las secuencias y limpia el estado del ruido rosa y marrón.
+    void reset();
+
+    // EN: Sets the number of velvet pulses per second.
+    // ES: Establece el número de pulsos velvet por segundo.
+    void setVelvetDensity(float inDensity);
+
+    // EN: Fills numSamples of output with the noise of a channel, starting at the current counter. The
+    //     counter is advanced by process, after every channel is filled. Pink and brown noise keep state only
+    //     for channels below maxChannels.
+    // ES: Llena numSamples de output con el ruido de un canal, empezando en el contador actual. El contador
+    //     lo avanza process, después de llenar todos los canales. Los ruidos rosa y marrón solo guardan estado
+    //     para los canales por debajo de maxChannels.
+    void render(float* output, int numSamples, int channel);
+
+    static constexpr int maxChannels = 8;
+    static constexpr int numPinkRows = 12;
+    static constexpr float brownCornerFrequency = 20.0f;
+
 private:
+    // EN: lowbias32 integer hash (C. Wellons), a bijection with good avalanche.
+    // ES: Hash entero lowbias32 (C. Wellons), una biyección con buena avalancha.
+    static uint32_t hash(uint32_t x);
+
+    // EN: Maps the top 24 bits to a float in [-1, 1).
+    // ES: Convierte los 24 bits superiores en un float en [-1, 1).
+    static float toBipolar(uint32_t x);
+
+    // EN: Stream key of a channel for one use (white samples, pink rows or velvet pulses).
+    // ES: Clave de secuencia de un canal para un uso (muestras blancas, filas rosas o pulsos velvet).
+    uint32_t getKey(int channel, uint32_t stream) const;
+
+    // EN: Render one channel of each noise type from the current counter.
+    // ES: Generan un canal de cada tipo de ruido desde el contador actual.
+    void renderWhite(float* output, int numSamples, uint32_t key) const;
+    void renderPink(float* output, int numSamples, int channel);
+    void renderBrown(float* output, int numSamples, int channel);
+    void renderVelvet(float* output, int numSamples, int channel) const;
+
+    // EN: Recalculate the values that depend on the sample rate.
+    // ES: Recalculan los valores que dependen de la frecuencia de muestreo.
+    void updateBrownCoefficient();
+    void updateVelvetSegment();
+
     // EN: Stores the current sample rate of the audio processing system.
     // ES: Almacena la tasa de muestreo actual del sistema de procesamiento de audio.
-    double sampleRate;
+    double sampleRate{ 44100.0 };
+
+    NoiseType noiseType{ NoiseType::White };
+    uint32_t seed{ 0 };
+    uint32_t counter{ 0 };
+
+    // EN: Pink rows and their running sum, and brown integrator state, per channel.
+    // ES: Filas rosas y su suma acumulada, y estado del integrador marrón, por canal.
+    std::array<std::array<float, numPinkRows>, maxChannels> pinkRows{};
+    std::array<float, maxChannels> pinkSum{};
+    std::array<float, maxChannels> brownState{};
+    float brownCoefficient{ 0.0f };
+    float brownGain{ 0.0f };
 
-    // EN: Random number generator used to produce white noise samples.
-    // ES: Generador de n�meros aleatorios usado para producir muestras de ruido blanco.
-    juce::Random randomGenerator;
+    float velvetDensity{ 2000.0f };
+    int velvetSegment{ 22 };
 };
\ No newline at end of file
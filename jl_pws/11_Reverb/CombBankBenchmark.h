@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    CombBankBenchmark.h
+    Created: 19 Oct 2026 4:24:53am
+    Author:  Jhonatan López
+
+    notes: Run it outside the audio thread, it allocates its buffers.
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: CombBankBenchmark runs the comb bank of SchroederReverb (8 combs stored as lanes and updated in one loop)
+//     and 8 independent Freeverb comb objects, each with its own buffer and called one after the other, over the
+//     same white noise with the same lengths, damping and feedback. It reports the cost per sample of each one
+//     and the largest difference between their outputs, so the lane layout is justified by numbers and checked
+//     against the plain form.
+// ES: CombBankBenchmark ejecuta el banco de peines de SchroederReverb (8 peines guardados como carriles y
+//     actualizados en un bucle) y 8 objetos peine de Freeverb independientes, cada uno con su propio buffer y
+//     llamados uno tras otro, sobre el mismo ruido blanco con las mismas longitudes, amortiguación y
+//     realimentación. Informa del coste por muestra de cada uno y de la mayor diferencia entre sus salidas, así la
+//     disposición en carriles se justifica con números y se comprueba contra la forma simple.
+class CombBankBenchmark
+{
+public:
+    // EN: Times are in nanoseconds per sample for the whole bank of 8 combs. The difference is the peak absolute
+    //     difference between the two outputs.
+    // ES: Los tiempos están en nanosegundos por muestra para el banco completo de 8 peines. La diferencia es la
+    //     diferencia absoluta de pico entre las dos salidas.
+    struct Result
+    {
+        double bankNanoseconds{ 0.0 };
+        double combsNanoseconds{ 0.0 };
+        double maxDifference{ 0.0 };
+    };
+
+    // EN: Compares both forms for numBlocks blocks of blockSize samples, e.g.
+    //         const auto result = CombBankBenchmark::compare(48000.0);
+    //     Only the comb processing is timed.
+    // ES: Compara ambas formas durante numBlocks bloques de blockSize muestras, p. ej.
+    //         const auto result = CombBankBenchmark::compare(48000.0);
+    //     Solo se mide el procesamiento de los peines.
+    static Result compare(double sampleRate = 44100.0, float roomSize = 0.5f, float damping = 0.5f,
+                          int blockSize = 512, int numBlocks = 2000)
+    {
+        SchroederReverb reverb;
+        reverb.setRoomSize(roomSize);
+        reverb.setDamping(damping);
+        reverb.prepare(sampleRate, blockSize, 1);
+
+        auto& bank = reverb.combs[0];
+
+        std::array<Comb, SchroederReverb::numCombs> combs;
+        for (int l = 0; l < SchroederReverb::numCombs; l++)
+            combs[static_cast<size_t>(l)].buffer.assign(static_cast<size_t>(bank.length[static_cast<size_t>(l)]), 0.0f);
+
+        std::vector<float> input(static_cast<size_t>(blockSize));
+        std::vector<float> bankOutput(static_cast<size_t>(blockSize));
+        std::vector<float> combsOutput(static_cast<size_t>(blockSize));
+        juce::Random random(1);
+
+        juce::int64 bankTicks = 0;
+        juce::int64 combsTicks = 0;
+        double maxDifference = 0.0;
+
+        for (int block = 0; block < numBlocks; block++)
+        {
+            for (auto& x : input)
+                x = (random.nextFloat() - 0.5f) * SchroederReverb::fixedGain;
+
+            const juce::int64 start = juce::Time::getHighResolutionTicks();
+            reverb.processCombs(bank, input.data(), bankOutput.data(), blockSize);
+            const juce::int64 middle = juce::Time::getHighResolutionTicks();
+
+            for (int i = 0; i < blockSize; i++)
+            {
+                float sum = 0.0f;
+
+                for (auto& comb : combs)
+                    sum += comb.process(input[static_cast<size_t>(i)], reverb.damp, reverb.feedback);
+
+                combsOutput[static_cast<size_t>(i)] = sum;
+            }
+
+            const juce::int64 end = juce::Time::getHighResolutionTicks();
+
+            bankTicks += middle - start;
+            combsTicks += end - middle;
+
+            for (int i = 0; i < blockSize; i++)
+                maxDifference = juce::jmax(maxDifference, static_cast<double>(std::abs(bankOutput[static_cast<size_t>(i)] - combsOutput[static_cast<size_t>(i)])));
+        }
+
+        const double samples = static_cast<double>(blockSize) * numBlocks;
+        const double nanosecondsPerTick = 1.0e9 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+
+        Result result;
+        result.bankNanoseconds = static_cast<double>(bankTicks) * nanosecondsPerTick / samples;
+        result.combsNanoseconds = static_cast<double>(combsTicks) * nanosecondsPerTick / samples;
+        result.maxDifference = maxDifference;
+        return result;
+    }
+
+private:
+    // EN: One Freeverb comb as a separate object: d = buffer[index], state = (1 - damp) d + damp state,
+    //     buffer[index] = x + feedback state, and d is the output.
+    // ES: Un peine de Freeverb como objeto separado: d = buffer[index], state = (1 - damp) d + damp state,
+    //     buffer[index] = x + feedback state, y d es la salida.
+    struct Comb
+    {
+        float process(float input, float damp, float feedback)
+        {
+            const float delayed = buffer[static_cast<size_t>(index)];
+            filterState = (1.0f - damp) * delayed + damp * filterState;
+            buffer[static_cast<size_t>(index)] = input + feedback * filterState;
+
+            if (++index == static_cast<int>(buffer.size()))
+                index = 0;
+
+            return delayed;
+        }
+
+        std::vector<float> buffer;
+        int index{ 0 };
+        float filterState{ 0.0f };
+    };
+};
@@ -0,0 +1,391 @@
+/*
+  ==============================================================================
+
+    FDNReverb.cpp
+    Created: 19 Oct 2026 3:06:18am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "FDNReverb.h"
+
+// EN: Constructor of FDNReverb class.
+// ES: Constructor de la clase FDNReverb.
+FDNReverb::FDNReverb()
+{
+}
+
+// EN: Destructor of FDNReverb class.
+// ES: Destructor de la clase FDNReverb.
+FDNReverb::~FDNReverb()
+{
+}
+
+// EN: Every line gets room for the longest length at maxSize plus the modulation depth and the interpolation
+//     taps, rounded up to a power of two so indices wrap with a mask. Then one allocation is carved up.
+// ES: Cada línea recibe espacio para la longitud más larga con maxSize más la profundidad de modulación y los
+//     puntos de interpolación, redondeado a una potencia de dos para envolver los índices con una máscara.
+//     Después se reparte una única reserva.
+void FDNReverb::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    juce::ignoreUnused(inSamplesPerBlock, inChannels);
+
+    sampleRate = inSampleRate;
+
+    const int modulationSamples = static_cast<int>(std::ceil(maxModulationMs * 0.001 * sampleRate));
+    const int longestLine = static_cast<int>(std::ceil(longestLineMs * maxSize * 0.001 * sampleRate));
+    const int lineCapacity = nextPowerOfTwo(nextPrime(longestLine) + modulationSamples + 4);
+
+    int diffuserCapacity[2][numDiffusers];
+    size_t totalSize = static_cast<size_t>(lineCapacity) * maxLines;
+
+    for (int channel = 0; channel < 2; channel++)
+    {
+        for (int k = 0; k < numDiffusers; k++)
+        {
+            const int delay = juce::jmax(1, static_cast<int>(std::round(diffuserMs[channel][k] * 0.001 * sampleRate)));
+            diffuserCapacity[channel][k] = nextPowerOfTwo(delay + 1);
+            diffusers[channel][k].delay = delay;
+            diffusers[channel][k].g = diffuserGain[k];
+            totalSize += static_cast<size_t>(diffuserCapacity[channel][k]);
+        }
+    }
+
+    memory.assign(totalSize, 0.0f);
+
+    float* next = memory.data();
+
+    for (auto& line : lines)
+    {
+        line.data = next;
+        line.mask = lineCapacity - 1;
+        next += lineCapacity;
+    }
+
+    for (int channel = 0; channel < 2; channel++)
+    {
+        for (int k = 0; k < numDiffusers; k++)
+        {
+            diffusers[channel][k].data = next;
+            diffusers[channel][k].mask = diffuserCapacity[channel][k] - 1;
+            next += diffuserCapacity[channel][k];
+        }
+    }
+
+    updateLengths();
+    reset();
+}
+
+// EN: Clears the memory and restarts the LFOs with their phases spread over one cycle.
+// ES: Limpia la memoria y reinicia los LFO con sus fases repartidas en un ciclo.
+void FDNReverb::reset()
+{
+    std::fill(memory.begin(), memory.end(), 0.0f);
+
+    for (int i = 0; i < maxLines; i++)
+    {
+        lines[i].writeIndex = 0;
+        lines[i].lowpass = 0.0f;
+        lines[i].currentDelay = lines[i].baseDelay;
+        lines[i].delayStep = 0.0f;
+        lines[i].lfoPhase = static_cast<double>(i) / maxLines;
+    }
+
+    for (auto& channelDiffusers : diffusers)
+        for (auto& diffuser : channelDiffusers)
+            diffuser.writeIndex = 0;
+
+    samplesUntilUpdate = 0;
+}
+
+// EN: Sets the number of delay lines. Lines that are switched on start empty.
+// ES: Establece el número de líneas de retardo. Las líneas que se activan empiezan vacías.
+void FDNReverb::setNumLines(int inNumLines)
+{
+    const int newNumLines = inNumLines > 8 ? 16 : 8;
+
+    for (int i = numLines; i < newNumLines; i++)
+    {
+        if (lines[i].data != nullptr)
+            std::fill(lines[i].data, lines[i].data + lines[i].mask + 1, 0.0f);
+
+        lines[i].lowpass = 0.0f;
+    }
+
+    numLines = newNumLines;
+    updateLengths();
+}
+
+// EN: Sets the decay time.
+// ES: Establece el tiempo de decaimiento.
+void FDNReverb::setDecayTime(float inSeconds)
+{
+    decayTime = juce::jmax(0.05f, inSeconds);
+    updateGains();
+}
+
+// EN: Sets the high-frequency damping.
+// ES: Establece la amortiguación de agudos.
+void FDNReverb::setDamping(float inDamping)
+{
+    damping = juce::jlimit(0.0f, 0.95f, inDamping);
+}
+
+// EN: Sets the room size.
+// ES: Establece el tamaño de la sala.
+void FDNReverb::setSize(float inSize)
+{
+    size = juce::jlimit(0.25f, maxSize, inSize);
+    updateLengths();
+}
+
+// EN: Sets the modulation rate and depth.
+// ES: Establece la velocidad y la profundidad de la modulación.
+void FDNReverb::setModulation(float inRateHz, float inDepthMs)
+{
+    modulationRate = juce::jmax(0.0f, inRateHz);
+    modulationDepthMs = juce::jlimit(0.0f, maxModulationMs, inDepthMs);
+}
+
+// EN: Sets the control update interval in samples.
+// ES: Establece el intervalo de actualización de control en muestras.
+void FDNReverb::setUpdateInterval(int inSamples)
+{
+    updateInterval = juce::jlimit(1, 256, inSamples);
+}
+
+// EN: Sets the dry/wet mix.
+// ES: Establece la mezcla seco/húmedo.
+void FDNReverb::setMix(float inMix)
+{
+    mix = juce::jlimit(0.0f, 1.0f, inMix);
+}
+
+// EN: Lengths are spread exponentially between the shortest and longest line and moved to the next prime.
+// ES: Las longitudes se reparten exponencialmente entre la línea más corta y la más larga y se llevan al primo siguiente.
+void FDNReverb::updateLengths()
+{
+    for (int i = 0; i < numLines; i++)
+    {
+        const float position = static_cast<float>(i) / (numLines - 1);
+        const float ms = shortestLineMs * std::pow(longestLineMs / shortestLineMs, position) * size;
+
+        lines[i].baseDelay = static_cast<float>(nextPrime(static_cast<int>(ms * 0.001 * sampleRate)));
+    }
+
+    updateGains();
+}
+
+// EN: A line of L samples must lose 60 dB over decayTime seconds: g = 10^(-3 L / (RT60 fs)).
+// ES: Una línea de L muestras debe perder 60 dB en decayTime segundos: g = 10^(-3 L / (RT60 fs)).
+void FDNReverb::updateGains()
+{
+    for (int i = 0; i < numLines; i++)
+        lines[i].gain = static_cast<float>(std::pow(10.0, -3.0 * lines[i].baseDelay / (decayTime * sampleRate)));
+}
+
+// EN: Computes where each LFO will be at the next control update and the per-sample step to get there.
+// ES: Calcula dónde estará cada LFO en la siguiente actualización de control y el paso por muestra para llegar.
+void FDNReverb::updateModulation()
+{
+    const double phaseStep = modulationRate * updateInterval / sampleRate;
+    const float depth = static_cast<float>(modulationDepthMs * 0.001 * sampleRate);
+
+    for (int i = 0; i < numLines; i++)
+    {
+        auto& line = lines[i];
+
+        line.lfoPhase += phaseStep;
+        if (line.lfoPhase >= 1.0)
+            line.lfoPhase -= 1.0;
+
+        const float target = line.baseDelay + depth * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * line.lfoPhase));
+        line.delayStep = (target - line.currentDelay) / updateInterval;
+    }
+}
+
+// EN: Lagrange weights for the points at -1, 0, 1 and 2 around the fractional position f.
+// ES: Pesos de Lagrange para los puntos en -1, 0, 1 y 2 alrededor de la posición fraccionaria f.
+float FDNReverb::readLagrange(const DelayLine& line, float delaySamples)
+{
+    const float position = static_cast<float>(line.writeIndex) - delaySamples;
+    const float floorPosition = std::floor(position);
+    const int index = static_cast<int>(floorPosition);
+    const float f = position - floorPosition;
+
+    const float xm1 = line.data[(index - 1) & line.mask];
+    const float x0 = line.data[index & line.mask];
+    const float x1 = line.data[(index + 1) & line.mask];
+    const float x2 = line.data[(index + 2) & line.mask];
+
+    const float fm1 = f - 1.0f;
+    const float fm2 = f - 2.0f;
+    const float fp1 = f + 1.0f;
+
+    return -f * fm1 * fm2 * (1.0f / 6.0f) * xm1
+           + fp1 * fm1 * fm2 * 0.5f * x0
+           - fp1 * f * fm2 * 0.5f * x1
+           + fp1 * f * fm1 * (1.0f / 6.0f) * x2;
+}
+
+// EN: Four allpasses in series.
+// ES: Cuatro pasa todo en serie.
+float FDNReverb::diffuse(int channel, float input)
+{
+    float x = input;
+
+    for (auto& d : diffusers[channel])
+    {
+        const float delayed = d.data[(d.writeIndex - d.delay) & d.mask];
+        const float y = -d.g * x + delayed;
+
+        d.data[d.writeIndex] = x + d.g * y;
+        d.writeIndex = (d.writeIndex + 1) & d.mask;
+
+        x = y;
+    }
+
+    return x;
+}
+
+// EN: Fast Walsh-Hadamard transform: log2 N passes of butterflies, then 1 / sqrt(N) keeps it lossless.
+// ES: Transformada rápida de Walsh-Hadamard: log2 N pasadas de mariposas, luego 1 / sqrt(N) la mantiene sin pérdidas.
+void FDNReverb::hadamard(std::array<float, maxLines>& values) const
+{
+    for (int half = 1; half < numLines; half *= 2)
+    {
+        for (int start = 0; start < numLines; start += 2 * half)
+        {
+            for (int j = start; j < start + half; j++)
+            {
+                const float a = values[j];
+                const float b = values[j + half];
+                values[j] = a + b;
+                values[j + half] = a - b;
+            }
+        }
+    }
+
+    const float scale = 1.0f / std::sqrt(static_cast<float>(numLines));
+
+    for (int i = 0; i < numLines; i++)
+        values[i] *= scale;
+}
+
+// EN: Per sample: diffuse the input, read and damp every line, mix with the Hadamard matrix and write back
+//     with the left input on even lines and the right input on odd lines. Even lines feed the left output
+//     and odd lines the right output.
+// ES: Por muestra: difunde la entrada, lee y amortigua cada línea, mezcla con la matriz de Hadamard y escribe
+//     de vuelta con la entrada izquierda en las líneas pares y la derecha en las impares. Las líneas pares
+//     alimentan la salida izquierda y las impares la derecha.
+void FDNReverb::process(juce::AudioBuffer<float>& buffer)
+{
+    if (memory.empty() || buffer.getNumChannels() == 0)
+        return;
+
+    juce::ScopedNoDenormals noDenormals;
+
+    const int numSamples = buffer.getNumSamples();
+    const bool isStereo = buffer.getNumChannels() > 1;
+
+    float* left = buffer.getWritePointer(0);
+    float* right = isStereo ? buffer.getWritePointer(1) : nullptr;
+
+    const float outputGain = std::sqrt(2.0f / numLines);
+    const float lowpassCoefficient = 1.0f - damping;
+
+    std::array<float, maxLines> values{};
+
+    for (int n = 0; n < numSamples; n++)
+    {
+        if (samplesUntilUpdate <= 0)
+        {
+            updateModulation();
+            samplesUntilUpdate = updateInterval;
+        }
+        samplesUntilUpdate--;
+
+        const float inLeft = left[n];
+        const float inRight = isStereo ? right[n] : inLeft;
+
+        const float diffusedLeft = diffuse(0, inLeft);
+        const float diffusedRight = diffuse(1, inRight);
+
+        float wetLeft = 0.0f;
+        float wetRight = 0.0f;
+
+        for (int i = 0; i < numLines; i++)
+        {
+            auto& line = lines[i];
+
+            line.currentDelay += line.delayStep;
+            const float delayed = readLagrange(line, line.currentDelay);
+
+            line.lowpass += lowpassCoefficient * (delayed - line.lowpass);
+            values[i] = line.lowpass * line.gain;
+
+            if ((i & 1) == 0)
+                wetLeft += values[i];
+            else
+                wetRight += values[i];
+        }
+
+        hadamard(values);
+
+        for (int i = 0; i < numLines; i++)
+        {
+            auto& line = lines[i];
+
+            line.data[line.writeIndex] = values[i] + ((i & 1) == 0 ? diffusedLeft : diffusedRight);
+            line.writeIndex = (line.writeIndex + 1) & line.mask;
+        }
+
+        wetLeft *= outputGain;
+        wetRight *= outputGain;
+
+        if (isStereo)
+        {
+            left[n] = (1.0f - mix) * inLeft + mix * wetLeft;
+            right[n] = (1.0f - mix) * inRight + mix * wetRight;
+        }
+        else
+        {
+            left[n] = (1.0f - mix) * inLeft + mix * 0.5f * (wetLeft + wetRight);
+        }
+    }
+}
+
+// EN: Smallest power of two that is at least value.
+// ES: Menor potencia de dos que es al menos value.
+int FDNReverb::nextPowerOfTwo(int value)
+{
+    int result = 1;
+
+    while (result < value)
+        result *= 2;
+
+    return result;
+}
+
+// EN: Smallest prime that is at least value (trial division, only called outside the sample loop).
+// ES: Menor primo que es al menos value (división por tanteo, solo se llama fuera del bucle de muestras).
+int FDNReverb::nextPrime(int value)
+{
+    for (int candidate = juce::jmax(2, value);; candidate++)
+    {
+        bool isPrime = true;
+
+        for (int divisor = 2; divisor * divisor <= candidate; divisor++)
+        {
+            if (candidate % divisor == 0)
+            {
+                isPrime = false;
+                break;
+            }
+        }
+
+        if (isPrime)
+            return candidate;
+    }
+}
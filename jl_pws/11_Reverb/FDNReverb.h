@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    FDNReverb.h
+    Created: 19 Oct 2026 3:06:18am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: FDNReverb is a feedback delay network reverb with 8 or 16 delay lines.
+//     - Input: each channel goes through four Schroeder allpasses (the DirectFormII_APF structure with a delay
+//       line instead of one sample) before entering the network.
+//     - Mixing: the line outputs are mixed with a normalized Hadamard matrix, computed in place with N log2 N
+//       butterflies (add/subtract pairs) over a fixed-size array that the compiler vectorizes.
+//     - Damping: every line has a broadband gain set from the decay time and its own length, plus a one-pole
+//       low-pass, so the highs decay faster.
+//     - Modulation: each line's read position is moved by a slow LFO and read with third-order Lagrange
+//       interpolation to avoid metallic ringing.
+//     - Control rate: the LFO targets are recomputed every updateInterval samples and ramped in between, so the
+//       sound does not depend on the host block size.
+//     All the lines and allpasses live in a single contiguous allocation made in prepare.
+// ES: FDNReverb es una reverberación de red de retardos realimentada con 8 o 16 líneas de retardo.
+//     - Entrada: cada canal pasa por cuatro pasa todo de Schroeder (la estructura de DirectFormII_APF con una
+//       línea de retardo en vez de una muestra) antes de entrar en la red.
+//     - Mezcla: las salidas de las líneas se mezclan con una matriz de Hadamard normalizada, calculada en el mismo
+//       lugar con N log2 N mariposas (pares suma/resta) sobre un arreglo de tamaño fijo que el compilador vectoriza.
+//     - Amortiguación: cada línea tiene una ganancia de banda ancha calculada desde el tiempo de decaimiento y su
+//       propia longitud, más un pasa bajos de un polo, así los agudos decaen antes.
+//     - Modulación: la posición de lectura de cada línea se mueve con un LFO lento y se lee con interpolación de
+//       Lagrange de tercer orden para evitar resonancias metálicas.
+//     - Tasa de control: los objetivos del LFO se recalculan cada updateInterval muestras y se interpolan entre
+//       medias, así el sonido no depende del tamaño de bloque del host.
+//     Todas las líneas y pasa todo viven en una única reserva de memoria contigua hecha en prepare.
+class FDNReverb
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    FDNReverb();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~FDNReverb();
+
+    // EN: Allocates the memory for the largest size and the maximum modulation depth.
+    // ES: Reserva la memoria para el tamaño más grande y la profundidad de modulación máxima.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears every line, allpass and filter.
+    // ES: Limpia todas las líneas, pasa todo y filtros.
+    void reset();
+
+    // EN: Processes the buffer in place. Mono buffers are fed to both network inputs.
+    // ES: Procesa el buffer en el mismo lugar. Los buffers mono alimentan ambas entradas de la red.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    // EN: Sets the number of delay lines: 8 or 16.
+    // ES: Establece el número de líneas de retardo: 8 o 16.
+    void setNumLines(int inNumLines);
+
+    // EN: Sets the decay time (RT60) in seconds.
+    // ES: Establece el tiempo de decaimiento (RT60) en segundos.
+    void setDecayTime(float inSeconds);
+
+    // EN: Sets the high-frequency damping (0 = bright, 1 = dark).
+    // ES: Establece la amortiguación de agudos (0 = brillante, 1 = oscuro).
+    void setDamping(float inDamping);
+
+    // EN: Scales the delay lengths (0.25 to 2).
+    // ES: Escala las longitudes de retardo (0.25 a 2).
+    void setSize(float inSize);
+
+    // EN: Sets the modulation rate in Hz and depth in milliseconds (up to maxModulationMs).
+    // ES: Establece la velocidad de modulación en Hz y la profundidad en milisegundos (hasta maxModulationMs).
+    void setModulation(float inRateHz, float inDepthMs);
+
+    // EN: Sets how many samples pass between control updates (1 to 256).
+    // ES: Establece cuántas muestras pasan entre actualizaciones de control (1 a 256).
+    void setUpdateInterval(int inSamples);
+
+    // EN: Sets the dry/wet mix (0 to 1).
+    // ES: Establece la mezcla seco/húmedo (0 a 1).
+    void setMix(float inMix);
+
+    static constexpr int maxLines = 16;
+    static constexpr int numDiffusers = 4;
+    static constexpr float maxSize = 2.0f;
+    static constexpr float maxModulationMs = 2.0f;
+
+private:
+    // EN: One line of the network. data points into memory; the capacity is a power of two (mask).
+    // ES: Una línea de la red. data apunta a memory; la capacidad es una potencia de dos (mask).
+    struct DelayLine
+    {
+        float* data{ nullptr };
+        int mask{ 0 };
+        int writeIndex{ 0 };
+        float baseDelay{ 0.0f };
+        float currentDelay{ 0.0f };
+        float delayStep{ 0.0f };
+        float gain{ 0.0f };
+        float lowpass{ 0.0f };
+        double lfoPhase{ 0.0 };
+    };
+
+    // EN: Schroeder allpass: y = -g x + d, buffer = x + g y, with d the delayed buffer value.
+    // ES: Pasa todo de Schroeder: y = -g x + d, buffer = x + g y, con d el valor retardado del buffer.
+    struct Diffuser
+    {
+        float* data{ nullptr };
+        int mask{ 0 };
+        int writeIndex{ 0 };
+        int delay{ 0 };
+        float g{ 0.0f };
+    };
+
+    // EN: Recomputes the line lengths from the size (prime lengths, so the echoes do not line up).
+    // ES: Recalcula las longitudes de las líneas desde el tamaño (longitudes primas, para que los ecos no coincidan).
+    void updateLengths();
+
+    // EN: Recomputes the broadband gain of each line from the decay time.
+    // ES: Recalcula la ganancia de banda ancha de cada línea desde el tiempo de decaimiento.
+    void updateGains();
+
+    // EN: Advances the LFOs by one control period and sets the per-sample ramp of each line.
+    // ES: Avanza los LFO un periodo de control y establece la rampa por muestra de cada línea.
+    void updateModulation();
+
+    // EN: Reads a line at a fractional delay with third-order Lagrange interpolation.
+    // ES: Lee una línea con un retardo fraccionario usando interpolación de Lagrange de tercer orden.
+    static float readLagrange(const DelayLine& line, float delaySamples);
+
+    // EN: Runs one sample through the allpass chain of a channel.
+    // ES: Pasa una muestra por la cadena de pasa todo de un canal.
+    float diffuse(int channel, float input);
+
+    // EN: In-place normalized Hadamard transform of the first numLines values.
+    // ES: Transformada de Hadamard normalizada en el mismo lugar de los primeros numLines valores.
+    void hadamard(std::array<float, maxLines>& values) const;
+
+    static int nextPowerOfTwo(int value);
+    static int nextPrime(int value);
+
+    // EN: Shortest and longest line at size 1 in ms, and the input allpass lengths (ms) and gains per channel,
+    //     slightly different so left and right decorrelate.
+    // ES: Línea más corta y más larga con tamaño 1 en ms, y las longitudes (ms) y ganancias de los pasa todo de
+    //     entrada por canal, algo distintas para decorrelacionar izquierda y derecha.
+    static constexpr float shortestLineMs = 23.0f;
+    static constexpr float longestLineMs = 97.0f;
+    static constexpr float diffuserMs[2][numDiffusers] = { { 4.77f, 3.60f, 12.73f, 9.31f },
+                                                           { 4.93f, 3.71f, 12.27f, 9.53f } };
+    static constexpr float diffuserGain[numDiffusers] = { 0.75f, 0.75f, 0.625f, 0.625f };
+
+    double sampleRate{ 48000.0 };
+
+    // EN: Single allocation that backs every line and allpass.
+    // ES: Única reserva que respalda todas las líneas y pasa todo.
+    std::vector<float> memory;
+
+    std::array<DelayLine, maxLines> lines;
+    std::array<std::array<Diffuser, numDiffusers>, 2> diffusers;
+
+    int numLines{ 8 };
+    float decayTime{ 2.0f };
+    float damping{ 0.3f };
+    float size{ 1.0f };
+    float modulationRate{ 0.3f };
+    float modulationDepthMs{ 0.5f };
+    float mix{ 0.3f };
+
+    int updateInterval{ 32 };
+    int samplesUntilUpdate{ 0 };
+};
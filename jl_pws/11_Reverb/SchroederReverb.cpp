@@ -0,0 +1,280 @@
+/*
+  ==============================================================================
+
+    SchroederReverb.cpp
+    Created: 19 Oct 2026 3:07:55am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+//#include "SchroederReverb.h"
+
+// EN: Constructor of SchroederReverb class.
+// ES: Constructor de la clase SchroederReverb.
+SchroederReverb::SchroederReverb()
+{
+}
+
+// EN: Destructor of SchroederReverb class.
+// ES: Destructor de la clase SchroederReverb.
+SchroederReverb::~SchroederReverb()
+{
+}
+
+// EN: Lengths are scaled from 44.1 kHz and the right channel adds stereoSpread. All the lines are carved out of
+//     one allocation.
+// ES: Las longitudes se escalan desde 44.1 kHz y el canal derecho suma stereoSpread. Todas las líneas salen de
+//     una única reserva.
+void SchroederReverb::prepare(double inSampleRate, int inSamplesPerBlock, int inChannels)
+{
+    juce::ignoreUnused(inChannels);
+
+    sampleRate = inSampleRate;
+    maxBlockSize = juce::jmax(1, inSamplesPerBlock);
+
+    const double scale = sampleRate / 44100.0;
+    size_t totalSize = 0;
+
+    for (int channel = 0; channel < maxChannels; channel++)
+    {
+        const int spread = channel * stereoSpread;
+
+        for (int l = 0; l < numCombs; l++)
+        {
+            combs[channel].length[l] = juce::jmax(1, static_cast<int>(std::round((combTunings[l] + spread) * scale)));
+            totalSize += static_cast<size_t>(combs[channel].length[l]);
+        }
+
+        for (int k = 0; k < numAllpasses; k++)
+        {
+            allpasses[channel][k].length = juce::jmax(1, static_cast<int>(std::round((allpassTunings[k] + spread) * scale)));
+            totalSize += static_cast<size_t>(allpasses[channel][k].length);
+        }
+    }
+
+    memory.assign(totalSize, 0.0f);
+
+    float* next = memory.data();
+
+    for (int channel = 0; channel < maxChannels; channel++)
+    {
+        for (int l = 0; l < numCombs; l++)
+        {
+            combs[channel].data[l] = next;
+            next += combs[channel].length[l];
+        }
+
+        for (auto& allpass : allpasses[channel])
+        {
+            allpass.data = next;
+            next += allpass.length;
+        }
+    }
+
+    monoInput.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    delayedSpan.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+
+    for (auto& w : wet)
+        w.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+
+    reset();
+}
+
+// EN: Clears the combs, the allpasses and the damping filters.
+// ES: Limpia los peines, los pasa todo y los filtros de amortiguación.
+void SchroederReverb::reset()
+{
+    std::fill(memory.begin(), memory.end(), 0.0f);
+
+    for (auto& bank : combs)
+    {
+        bank.index.fill(0);
+        bank.filterState.fill(0.0f);
+    }
+
+    for (auto& channelAllpasses : allpasses)
+        for (auto& allpass : channelAllpasses)
+            allpass.index = 0;
+}
+
+// EN: Freeverb's mapping: feedback = 0.7 + 0.28 room.
+// ES: El mapeo de Freeverb: realimentación = 0.7 + 0.28 sala.
+void SchroederReverb::setRoomSize(float inRoomSize)
+{
+    roomSize = juce::jlimit(0.0f, 1.0f, inRoomSize);
+    feedback = 0.7f + 0.28f * roomSize;
+}
+
+// EN: Freeverb's mapping: the one-pole coefficient is 0.4 damping.
+// ES: El mapeo de Freeverb: el coeficiente del filtro de un polo es 0.4 amortiguación.
+void SchroederReverb::setDamping(float inDamping)
+{
+    damping = juce::jlimit(0.0f, 1.0f, inDamping);
+    damp = 0.4f * damping;
+}
+
+// EN: Sets the stereo width.
+// ES: Establece la anchura estéreo.
+void SchroederReverb::setWidth(float inWidth)
+{
+    width = juce::jlimit(0.0f, 1.0f, inWidth);
+}
+
+// EN: Sets the dry/wet mix.
+// ES: Establece la mezcla seco/húmedo.
+void SchroederReverb::setMix(float inMix)
+{
+    mix = juce::jlimit(0.0f, 1.0f, inMix);
+}
+
+// EN: The block is split into runs in which no lane wraps, so each lane is a plain pointer indexed by the sample
+//     and nothing is wrapped or stored per sample. Per sample the lanes are gathered, updated and scattered in
+//     separate loops over the 8 combs, so the damping and feedback math is a straight loop over arrays:
+//         d = buffer[index], state = (1 - damp) d + damp state, buffer[index] = x + feedback state.
+// ES: El bloque se divide en tramos en los que ningún carril da la vuelta, así cada carril es un puntero simple
+//     indexado por la muestra y no se ajusta ni se guarda nada por muestra. Por muestra los carriles se leen,
+//     actualizan y escriben en bucles separados sobre los 8 peines, así las cuentas de amortiguación y
+//     realimentación son un bucle directo sobre arrays:
+//         d = buffer[index], state = (1 - damp) d + damp state, buffer[index] = x + feedback state.
+void SchroederReverb::processCombs(CombBank& bank, const float* input, float* output, int numSamples)
+{
+    const float damp1 = damp;
+    const float damp2 = 1.0f - damp;
+    const float fb = feedback;
+
+    std::array<float, numCombs> delayed;
+    std::array<float, numCombs> state = bank.filterState;
+    std::array<float*, numCombs> line;
+
+    for (int start = 0; start < numSamples;)
+    {
+        int runSize = numSamples - start;
+
+        for (int l = 0; l < numCombs; l++)
+        {
+            runSize = juce::jmin(runSize, bank.length[l] - bank.index[l]);
+            line[l] = bank.data[l] + bank.index[l];
+        }
+
+        for (int i = 0; i < runSize; i++)
+        {
+            const float x = input[start + i];
+
+            for (int l = 0; l < numCombs; l++)
+                delayed[l] = line[l][i];
+
+            for (int l = 0; l < numCombs; l++)
+                state[l] = damp2 * delayed[l] + damp1 * state[l];
+
+            for (int l = 0; l < numCombs; l++)
+                line[l][i] = x + fb * state[l];
+
+            float sum = 0.0f;
+            for (int l = 0; l < numCombs; l++)
+                sum += delayed[l];
+
+            output[start + i] = sum;
+        }
+
+        for (int l = 0; l < numCombs; l++)
+            bank.index[l] = DelayLineBlock::wrap(bank.index[l] + runSize, bank.length[l]);
+
+        start += runSize;
+    }
+
+    bank.filterState = state;
+}
+
+// EN: DirectFormII_APF with an M-sample delay and a single state w: w = x - g w[n-M], y = g w + w[n-M].
+//     A span of at most M samples only reads w values from before the span, so it is read, updated and
+//     written back as whole vectors.
+// ES: DirectFormII_APF con un retardo de M muestras y un único estado w: w = x - g w[n-M], y = g w + w[n-M].
+//     Un tramo de como mucho M muestras solo lee valores de w anteriores al tramo, así se lee, actualiza y
+//     escribe de vuelta como vectores completos.
+void SchroederReverb::processAllpass(Allpass& allpass, float* samples, int numSamples)
+{
+    float* delayed = delayedSpan.data();
+
+    for (int start = 0; start < numSamples; start += allpass.length)
+    {
+        const int spanSize = juce::jmin(allpass.length, numSamples - start);
+        float* x = samples + start;
+
+        juce::FloatVectorOperations::clear(delayed, spanSize);
+        DelayLineBlock::addWithMultiply(delayed, allpass.data, allpass.length, allpass.index, 1.0f, spanSize);
+
+        // EN: x becomes w, which is stored, then y = g w + w[n-M].
+        // ES: x pasa a ser w, que se guarda, luego y = g w + w[n-M].
+        juce::FloatVectorOperations::addWithMultiply(x, delayed, -allpassGain, spanSize);
+        DelayLineBlock::write(allpass.data, allpass.length, allpass.index, x, spanSize);
+
+        juce::FloatVectorOperations::multiply(x, allpassGain, spanSize);
+        juce::FloatVectorOperations::add(x, delayed, spanSize);
+
+        allpass.index = DelayLineBlock::wrap(allpass.index + spanSize, allpass.length);
+    }
+}
+
+// EN: Splits the buffer into blocks of at most maxBlockSize samples.
+// ES: Divide el buffer en bloques de como máximo maxBlockSize muestras.
+void SchroederReverb::process(juce::AudioBuffer<float>& buffer)
+{
+    if (maxBlockSize == 0 || buffer.getNumChannels() == 0)
+        return;
+
+    juce::ScopedNoDenormals noDenormals;
+
+    for (int start = 0; start < buffer.getNumSamples(); start += maxBlockSize)
+        processBlock(buffer, start, juce::jmin(maxBlockSize, buffer.getNumSamples() - start));
+}
+
+// EN: 1. Sums the input to mono and attenuates it by fixedGain.
+//     2. Each channel runs its comb bank and its allpass chain.
+//     3. Mixes the wet channels by the width (Freeverb's wet1/wet2) with the dry input.
+// ES: 1. Suma la entrada a mono y la atenúa por fixedGain.
+//     2. Cada canal pasa por su banco de peines y su cadena de pasa todo.
+//     3. Mezcla los canales húmedos según la anchura (wet1/wet2 de Freeverb) con la entrada seca.
+void SchroederReverb::processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    const int channels = juce::jmin(buffer.getNumChannels(), maxChannels);
+
+    float* mono = monoInput.data();
+    juce::FloatVectorOperations::copy(mono, buffer.getReadPointer(0, startSample), numSamples);
+
+    if (channels > 1)
+        juce::FloatVectorOperations::add(mono, buffer.getReadPointer(1, startSample), numSamples);
+
+    juce::FloatVectorOperations::multiply(mono, fixedGain, numSamples);
+
+    for (int channel = 0; channel < channels; channel++)
+    {
+        processCombs(combs[channel], mono, wet[channel].data(), numSamples);
+
+        for (auto& allpass : allpasses[channel])
+            processAllpass(allpass, wet[channel].data(), numSamples);
+    }
+
+    const float wetGain = wetScale * mix;
+    const float dryGain = 1.0f - mix;
+
+    if (channels == 1)
+    {
+        float* channelData = buffer.getWritePointer(0, startSample);
+        juce::FloatVectorOperations::multiply(channelData, dryGain, numSamples);
+        juce::FloatVectorOperations::addWithMultiply(channelData, wet[0].data(), wetGain, numSamples);
+        return;
+    }
+
+    const float wet1 = wetGain * (0.5f + 0.5f * width);
+    const float wet2 = wetGain * (0.5f - 0.5f * width);
+
+    for (int channel = 0; channel < channels; channel++)
+    {
+        float* channelData = buffer.getWritePointer(channel, startSample);
+
+        juce::FloatVectorOperations::multiply(channelData, dryGain, numSamples);
+        juce::FloatVectorOperations::addWithMultiply(channelData, wet[channel].data(), wet1, numSamples);
+        juce::FloatVectorOperations::addWithMultiply(channelData, wet[1 - channel].data(), wet2, numSamples);
+    }
+}
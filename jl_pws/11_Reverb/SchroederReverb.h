@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+    SchroederReverb.h
+    Created: 19 Oct 2026 3:07:55am
+    Author:  Jhonatan López
+
+  ==============================================================================
+*/
+
+#pragma once
+//#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// EN: SchroederReverb is a Freeverb-style reverb, a cheaper companion to FDNReverb: the mono input feeds 8
+//     parallel comb filters with a one-pole low-pass in the feedback path, followed by 4 series allpasses per
+//     channel. The right channel uses the same lengths plus a small stereo spread.
+//     - The 8 combs of a channel are processed as lanes: their states, lengths and positions are kept in arrays
+//       of 8, and each sample runs the damping and feedback math of all 8 lanes in one loop that the compiler
+//       can vectorize, instead of 8 separate comb objects. CombBankBenchmark measures both forms.
+//     - The allpasses use the DirectFormII_APF equation with a delay of M samples,
+//       H(z) = (g + z^-M) / (1 + g z^-M), and run span-wise: a block is split into spans of at most M samples,
+//       so every delayed value of a span was written before it and the span is computed with
+//       FloatVectorOperations.
+// ES: SchroederReverb es una reverb al estilo Freeverb, una compañera más barata de FDNReverb: la entrada mono
+//     alimenta 8 filtros peine en paralelo con un pasa bajos de un polo en la realimentación, seguidos de 4 pasa
+//     todo en serie por canal. El canal derecho usa las mismas longitudes más una pequeña separación estéreo.
+//     - Los 8 peines de un canal se procesan como carriles: sus estados, longitudes y posiciones se guardan en
+//       arrays de 8, y cada muestra hace las cuentas de amortiguación y realimentación de los 8 carriles en un
+//       bucle que el compilador puede vectorizar, en vez de 8 objetos peine separados. CombBankBenchmark mide
+//       ambas formas.
+//     - Los pasa todo usan la ecuación de DirectFormII_APF con un retardo de M muestras,
+//       H(z) = (g + z^-M) / (1 + g z^-M), y se procesan por tramos: un bloque se divide en tramos de como mucho M
+//       muestras, así cada valor retardado de un tramo se escribió antes que él y el tramo se calcula con
+//       FloatVectorOperations.
+class SchroederReverb
+{
+public:
+    // EN: Constructor.
+    // ES: Constructor.
+    SchroederReverb();
+
+    // EN: Destructor.
+    // ES: Destructor.
+    ~SchroederReverb();
+
+    // EN: Scales the Freeverb lengths to the sample rate and allocates every comb, allpass and scratch buffer.
+    // ES: Escala las longitudes de Freeverb a la frecuencia de muestreo y reserva todos los peines, pasa todo y buffers temporales.
+    void prepare(double inSampleRate, int inSamplesPerBlock, int inChannels);
+
+    // EN: Clears the combs, the allpasses and the damping filters.
+    // ES: Limpia los peines, los pasa todo y los filtros de amortiguación.
+    void reset();
+
+    // EN: Processes the buffer in place. Only the first two channels are processed.
+    // ES: Procesa el buffer en el mismo lugar. Solo se procesan los dos primeros canales.
+    void process(juce::AudioBuffer<float>& buffer);
+
+    // EN: Sets the room size (0 to 1), which sets the comb feedback.
+    // ES: Establece el tamaño de la sala (0 a 1), que fija la realimentación de los peines.
+    void setRoomSize(float inRoomSize);
+
+    // EN: Sets the high-frequency damping (0 to 1).
+    // ES: Establece la amortiguación de agudos (0 a 1).
+    void setDamping(float inDamping);
+
+    // EN: Sets the stereo width of the wet signal (0 mono, 1 full width).
+    // ES: Establece la anchura estéreo de la señal húmeda (0 mono, 1 anchura completa).
+    void setWidth(float inWidth);
+
+    // EN: Sets the dry/wet mix (0 to 1).
+    // ES: Establece la mezcla seco/húmedo (0 a 1).
+    void setMix(float inMix);
+
+    static constexpr int numCombs = 8;
+    static constexpr int numAllpasses = 4;
+    static constexpr int maxChannels = 2;
+
+private:
+    // EN: The benchmark runs processCombs directly.
+    // ES: El benchmark ejecuta processCombs directamente.
+    friend class CombBankBenchmark;
+
+    // EN: The 8 combs of one channel, stored lane by lane.
+    // ES: Los 8 peines de un canal, guardados carril por carril.
+    struct CombBank
+    {
+        std::array<float*, numCombs> data{};
+        std::array<int, numCombs> length{};
+        std::array<int, numCombs> index{};
+        std::array<float, numCombs> filterState{};
+    };
+
+    // EN: One allpass of M samples. The circular buffer holds exactly M samples, so reads and writes share index.
+    // ES: Un pasa todo de M muestras. El buffer circular guarda exactamente M muestras, así lecturas y escrituras comparten index.
+    struct Allpass
+    {
+        float* data{ nullptr };
+        int length{ 0 };
+        int index{ 0 };
+    };
+
+    // EN: Runs numSamples of input through the comb bank of a channel and writes the sum of the 8 combs to output.
+    // ES: Pasa numSamples de entrada por el banco de peines de un canal y escribe la suma de los 8 peines en output.
+    void processCombs(CombBank& bank, const float* input, float* output, int numSamples);
+
+    // EN: Runs samples in place through one allpass, in spans of at most its length.
+    // ES: Pasa samples en el mismo lugar por un pasa todo, en tramos de como mucho su longitud.
+    void processAllpass(Allpass& allpass, float* samples, int numSamples);
+
+    // EN: Processes at most maxBlockSize samples starting at startSample.
+    // ES: Procesa como máximo maxBlockSize muestras empezando en startSample.
+    void processBlock(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+    // EN: Freeverb tunings at 44.1 kHz, in samples.
+    // ES: Afinaciones de Freeverb a 44.1 kHz, en muestras.
+    static constexpr int combTunings[numCombs] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+    static constexpr int allpassTunings[numAllpasses] = { 556, 441, 341, 225 };
+    static constexpr int stereoSpread = 23;
+
+    // EN: Input attenuation before the combs and wet make-up gain after the allpasses (Freeverb's fixedgain and scalewet).
+    // ES: Atenuación de la entrada antes de los peines y ganancia de compensación húmeda tras los pasa todo (fixedgain y scalewet de Freeverb).
+    static constexpr float fixedGain = 0.015f;
+    static constexpr float wetScale = 3.0f;
+    static constexpr float allpassGain = 0.5f;
+
+    double sampleRate{ 44100.0 };
+    int maxBlockSize{ 0 };
+
+    // EN: Single allocation that backs every comb and allpass.
+    // ES: Única reserva que respalda todos los peines y pasa todo.
+    std::vector<float> memory;
+
+    std::array<CombBank, maxChannels> combs;
+    std::array<std::array<Allpass, numAllpasses>, maxChannels> allpasses;
+
+    // EN: Block scratch buffers: mono input, one allpass span, and the wet signal of each channel.
+    // ES: Buffers temporales del bloque: entrada mono, un tramo de pasa todo y la señal húmeda de cada canal.
+    std::vector<float> monoInput;
+    std::vector<float> delayedSpan;
+    std::array<std::vector<float>, maxChannels> wet;
+
+    float roomSize{ 0.5f };
+    float damping{ 0.5f };
+    float width{ 1.0f };
+    float mix{ 0.3f };
+
+    // EN: Values derived from the parameters.
+    // ES: Valores derivados de los parámetros.
+    float feedback{ 0.84f };
+    float damp{ 0.2f };
+};
@@ -10,16 +10,21 @@
 #include "jl_pws.h"
 
 //1. Mathematical Operations
+#include "./01_MathOperations/SineOscillatorBank.cpp"
 #include "./01_MathOperations/AdditiveSynth.cpp"
 #include "./01_MathOperations/Subtraction.cpp"
 
 //2. Signal Modulation
+#include "./02_SignalModulation/ControlRateRamp.cpp"
 #include "./02_SignalModulation/AmpModulation.cpp"
 #include "./02_SignalModulation/AutoPan.cpp"
 #include "./02_SignalModulation/RingModulation.cpp"
+#include "./02_SignalModulation/Envelope.cpp"
+#include "./02_SignalModulation/MorphShapeTable.cpp"
 #include "./02_SignalModulation/MorphLFO.cpp"
 #include "./02_SignalModulation/MorphWave.cpp"
 #include "./02_SignalModulation/LFO.cpp"
+#include "./02_SignalModulation/ModulationMatrix.cpp"
 
 //3. Distortion
 #include "./03_Distortion/ArctangentDistortion.cpp"
@@ -37,6 +42,8 @@
 #include "./03_Distortion/SlewRateDistortion.cpp"
 
 //4. Delay and Echo Effects
+#include "./04_DelayEchoFx/DelayLineBlock.cpp"
+#include "./04_DelayEchoFx/DelayStorage.cpp"
 #include "./04_DelayEchoFx/SimpleDelay.cpp"
 #include "./04_DelayEchoFx/SimpleDelay2.cpp"
 #include "./04_DelayEchoFx/SimpleDelay3.cpp"
@@ -46,6 +53,7 @@
 #include "./04_DelayEchoFx/EchoFeedBackAndFordward.cpp"
 #include "./04_DelayEchoFx/EchoFeedBackAndFordward2.cpp"
 #include "./04_DelayEchoFx/EchoStereo.cpp"
+#include "./04_DelayEchoFx/MultiTapDelay.cpp"
 
 //5. Time-Based Effects
 #include "./05_TimeBasedFx/ChorusEffect.cpp"
@@ -55,12 +63,21 @@
 #include "./05_TimeBasedFx/BarberPoleFlangerEffect2.cpp"
 #include "./05_TimeBasedFx/FlangerEffect.cpp"
 #include "./05_TimeBasedFx/FeedbackFlangerEffect.cpp"
+#include "./05_TimeBasedFx/PhaserEffect.cpp"
 
 //6. Filters
 
+//Filter Analysis
+#include "./06_Filters/Analysis/TransferFunction.cpp"
+#include "./06_Filters/Analysis/FilterResponse.cpp"
+
 //FIR Filters
 #include "./06_Filters/FIR/FIR_LPF.cpp"
 #include "./06_Filters/FIR/FIR_LPF2.cpp"
+#include "./06_Filters/FIR/FIR_Polyphase.cpp"
+#include "./06_Filters/FIR/FIR_Decimator.cpp"
+#include "./06_Filters/FIR/FIR_Interpolator.cpp"
+#include "./06_Filters/FIR/FIR_Resampler.cpp"
 
 //IIR Filters
 #include "./06_Filters/IIR/IIR_APF.cpp"
@@ -107,6 +124,8 @@
 #include "./06_Filters/DirectForm/DirectFormII_NestedAPF.cpp"
 
 // 7. Waveform Generators
+#include "./07_WaveformGenerators/PhaseAccumulator.cpp"
+#include "./07_WaveformGenerators/BandLimitedOscillator.cpp"
 #include "./07_WaveformGenerators/DutyCicleWave.cpp"
 #include "./07_WaveformGenerators/ImpulseTrain.cpp"
 #include "./07_WaveformGenerators/SineWave.cpp"
@@ -118,6 +137,8 @@
 #include "./07_WaveformGenerators/TriangleWave.cpp"
 #include "./07_WaveformGenerators/TriangleWave2.cpp"
 #include "./07_WaveformGenerators/WhiteNoise.cpp"
+#include "./07_WaveformGenerators/WavetableOscillator.cpp"
+#include "./07_WaveformGenerators/OscillatorVoice.cpp"
 
 // 8. Spatial Effects
 #include "./08_SpatialFx/Pan.cpp"
@@ -136,4 +157,8 @@
 
 // 10. Miscellaneous
 #include "10_Miscellaneous/WetDry.cpp"
-#include "10_Miscellaneous/Input.cpp"
\ No newline at end of file
+#include "10_Miscellaneous/Input.cpp"
+
+// 11. Reverb
+#include "11_Reverb/FDNReverb.cpp"
+#include "11_Reverb/SchroederReverb.cpp"
\ No newline at end of file
@@ -28,16 +28,21 @@
 #include <juce_dsp/juce_dsp.h>
 
 //1. Mathematical Operations
+#include "./01_MathOperations/SineOscillatorBank.h"
 #include "./01_MathOperations/AdditiveSynth.h"
 #include "./01_MathOperations/Subtraction.h"
 
 //2. Signal Modulation
+#include "./02_SignalModulation/ControlRateRamp.h"
 #include "./02_SignalModulation/AmpModulation.h"
 #include "./02_SignalModulation/AutoPan.h"
 #include "./02_SignalModulation/RingModulation.h"
+#include "./02_SignalModulation/Envelope.h"
+#include "./02_SignalModulation/MorphShapeTable.h"
 #include "./02_SignalModulation/MorphLFO.h"
 #include "./02_SignalModulation/MorphWave.h"
 #include "./02_SignalModulation/LFO.h"
+#include "./02_SignalModulation/ModulationMatrix.h"
 
 //3. Distortion
 #include "./03_Distortion/ArctangentDistortion.h"
@@ -55,6 +60,8 @@
 #include "./03_Distortion/SlewRateDistortion.h"
 
 //4. Delay and Echo Effects
+#include "./04_DelayEchoFx/DelayLineBlock.h"
+#include "./04_DelayEchoFx/DelayStorage.h"
 #include "./04_DelayEchoFx/SimpleDelay.h"
 #include "./04_DelayEchoFx/SimpleDelay2.h"
 #include "./04_DelayEchoFx/SimpleDelay3.h"
@@ -64,6 +71,7 @@
 #include "./04_DelayEchoFx/EchoFeedBackAndFordward.h"
 #include "./04_DelayEchoFx/EchoFeedBackAndFordward2.h"
 #include "./04_DelayEchoFx/EchoStereo.h"
+#include "./04_DelayEchoFx/MultiTapDelay.h"
 
 //5. Time-Based Effects
 #include "./05_TimeBasedFx/ChorusEffect.h"
@@ -73,12 +81,22 @@
 #include "./05_TimeBasedFx/BarberPoleFlangerEffect2.h"
 #include "./05_TimeBasedFx/FlangerEffect.h"
 #include "./05_TimeBasedFx/FeedbackFlangerEffect.h"
+#include "./05_TimeBasedFx/PhaserEffect.h"
 
 //6. Filters
 
+//Filter Analysis
+#include "./06_Filters/Analysis/TransferFunction.h"
+#include "./06_Filters/Analysis/FilterResponse.h"
+#include "./06_Filters/Analysis/PrecisionBenchmark.h"
+
 //FIR Filters
 #include "./06_Filters/FIR/FIR_LPF.h"
 #include "./06_Filters/FIR/FIR_LPF2.h"
+#include "./06_Filters/FIR/FIR_Polyphase.h"
+#include "./06_Filters/FIR/FIR_Decimator.h"
+#include "./06_Filters/FIR/FIR_Interpolator.h"
+#include "./06_Filters/FIR/FIR_Resampler.h"
 
 //IIR Filters
 #include "./06_Filters/IIR/IIR_APF.h"
@@ -124,7 +142,12 @@
 #include "./06_Filters/DirectForm/DirectFormII_APF.h"
 #include "./06_Filters/DirectForm/DirectFormII_NestedAPF.h"
 
+// Parametric EQ
+#include "./06_Filters/ParametricEQ/ParametricEQ.h"
+
 // 7. Waveform Generators
+#include "./07_WaveformGenerators/PhaseAccumulator.h"
+#include "./07_WaveformGenerators/BandLimitedOscillator.h"
 #include "./07_WaveformGenerators/DutyCicleWave.h"
 #include "./07_WaveformGenerators/ImpulseTrain.h"
 #include "./07_WaveformGenerators/SineWave.h"
@@ -136,6 +159,9 @@
 #include "./07_WaveformGenerators/TriangleWave.h"
 #include "./07_WaveformGenerators/TriangleWave2.h"
 #include "./07_WaveformGenerators/WhiteNoise.h"
+#include "./07_WaveformGenerators/WavetableOscillator.h"
+#include "./07_WaveformGenerators/OscillatorVoice.h"
+#include "./07_WaveformGenerators/VoicePool.h"
 
 // 8. Spatial Effects
 #include "./08_SpatialFx/Pan.h"
@@ -155,3 +181,8 @@
 // 10. Miscellaneous
 #include "./10_Miscellaneous/WetDry.h"
 #include "./10_Miscellaneous/Input.h"
+
+// 11. Reverb
+#include "./11_Reverb/FDNReverb.h"
+#include "./11_Reverb/SchroederReverb.h"
+#include "./11_Reverb/CombBankBenchmark.h"